@@ -0,0 +1,145 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs.h>
+#include <yuni/core/dictionary.h>
+#include <yuni/datetime/timestamp.h>
+#include <vector>
+
+using namespace Yuni;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Number of lookups for each measure
+static const uint lookupCount = 5 * 1000 * 1000;
+//! Minimum number of insertions for each measure (the table is built several times if needed)
+static const uint insertCount = 1000 * 1000;
+
+//! Prevent the compiler from discarding the results
+static volatile uint64 sink = 0;
+
+
+static void report(const char* name, const char* what, uint count, sint64 start)
+{
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	if (duration <= 0)
+		duration = 1;
+	uint64 ns = (static_cast<uint64>(duration) * 1000000u) / count;
+	logs.info() << "  " << name << "\t" << what << ":\t" << ns << " ns/op";
+}
+
+
+/*!
+** \brief Insertions then lookups (hits and misses) with string keys
+**
+** The lookups are made with an AnyString (like an URL coming from a request).
+*/
+template<class TableT>
+static void measureStrings(const char* name, const std::vector<String>& keys, const std::vector<String>& missing)
+{
+	const uint count = static_cast<uint>(keys.size());
+	const uint rounds = (insertCount + count - 1) / count;
+	sint64 start = DateTime::NowMilliSeconds();
+	TableT table;
+	for (uint r = 0; r != rounds; ++r)
+	{
+		table.clear();
+		for (uint i = 0; i != count; ++i)
+			table[keys[i]] = i;
+	}
+	report(name, "insert", rounds * count, start);
+
+	start = DateTime::NowMilliSeconds();
+	uint64 sum = 0;
+	for (uint i = 0; i != lookupCount; ++i)
+	{
+		AnyString key = keys[i % keys.size()];
+		auto it = table.find(key);
+		if (it != table.end())
+			sum += it->second;
+	}
+	report(name, "find (hit)", lookupCount, start);
+
+	start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i != lookupCount; ++i)
+	{
+		AnyString key = missing[i % missing.size()];
+		sum += table.count(key);
+	}
+	report(name, "find (miss)", lookupCount, start);
+	sink = sink + sum;
+}
+
+
+/*!
+** \brief Insertions then lookups with integer keys
+*/
+template<class TableT>
+static void measureIntegers(const char* name, uint count)
+{
+	const uint rounds = (insertCount + count - 1) / count;
+	sint64 start = DateTime::NowMilliSeconds();
+	TableT table;
+	for (uint r = 0; r != rounds; ++r)
+	{
+		table.clear();
+		for (uint i = 0; i != count; ++i)
+			table[static_cast<uint64>(i) * 7919u] = i;
+	}
+	report(name, "insert", rounds * count, start);
+
+	start = DateTime::NowMilliSeconds();
+	uint64 sum = 0;
+	for (uint i = 0; i != lookupCount; ++i)
+	{
+		auto it = table.find(static_cast<uint64>(i % count) * 7919u);
+		if (it != table.end())
+			sum += it->second;
+	}
+	report(name, "find (hit)", lookupCount, start);
+	sink = sink + sum;
+}
+
+
+
+
+int main()
+{
+	const uint sizes[] = { 16, 1000, 100 * 1000, 1000 * 1000 };
+	for (uint size: sizes)
+	{
+		std::vector<String> keys;
+		std::vector<String> missing;
+		keys.reserve(size);
+		missing.reserve(size);
+		for (uint i = 0; i != size; ++i)
+		{
+			keys.push_back(String() << "/api/v1/users/" << i << "/profile");
+			missing.push_back(String() << "/api/v1/users/" << i << "/settings");
+		}
+
+		logs.info();
+		logs.info() << size << " string keys";
+		measureStrings<Dictionary<String, uint>::Ordered>("std::map          ", keys, missing);
+		measureStrings<Dictionary<String, uint>::Hash>("std::unordered_map", keys, missing);
+		measureStrings<Dictionary<String, uint>::Flat>("Hash::Flat        ", keys, missing);
+
+		logs.info();
+		logs.info() << size << " integer keys";
+		measureIntegers<Dictionary<uint64, uint>::Ordered>("std::map          ", size);
+		measureIntegers<Dictionary<uint64, uint>::Hash>("std::unordered_map", size);
+		measureIntegers<Dictionary<uint64, uint>::Flat>("Hash::Flat        ", size);
+	}
+	return 0;
+}
@@ -0,0 +1,130 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs.h>
+#include <yuni/core/hash/buffer.h>
+#include <yuni/datetime/timestamp.h>
+#include <vector>
+
+using namespace Yuni;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Amount of data to hash for each measure
+static const uint64 volume = 1024 * 1024 * 1024;
+
+//! Prevent the compiler from discarding the results
+static volatile uint64 sink = 0;
+
+
+//! The former hash of CString (SDBM)
+static size_t HashSDBM(const char* p, uint size)
+{
+	size_t hash = 0;
+	const char* end = p + size;
+	for (; p != end; ++p)
+		hash = static_cast<uint>(*p) + (hash << 6) + (hash << 16) - hash;
+	return hash;
+}
+
+
+static size_t HashBuffer(const char* p, uint size)
+{
+	return Hash::Buffer(p, size);
+}
+
+
+
+
+/*!
+** \brief Hash a set of keys of the same length until `volume` bytes have been processed
+*/
+static void measure(const char* name, size_t (*hash)(const char*, uint), const std::vector<String>& keys)
+{
+	uint keysize = keys.front().size();
+	uint64 rounds = volume / (keysize * keys.size()) + 1;
+
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint64 r = 0; r != rounds; ++r)
+	{
+		for (auto& key: keys)
+			sink = sink + hash(key.data(), key.size());
+	}
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	if (duration <= 0)
+		duration = 1;
+
+	uint64 count = rounds * keys.size();
+	uint64 mbps = (count * keysize * 1000u) / (static_cast<uint64>(duration) * 1024u * 1024u);
+	uint64 nsPerKey = (static_cast<uint64>(duration) * 1000000u) / count;
+	logs.info() << "  " << name << "\t" << keysize << " bytes:\t" << mbps << " MiB/s\t" << nsPerKey << " ns/key";
+}
+
+
+/*!
+** \brief Distribution of similar keys within a table indexed by the lowest bits
+*/
+static void distribution(const char* name, size_t (*hash)(const char*, uint))
+{
+	enum { bucketCount = 1 << 16 };
+	std::vector<uint> buckets(bucketCount, 0);
+	String key;
+	for (uint i = 0; i != bucketCount; ++i)
+	{
+		key.clear() << "/api/v1/users/" << i << "/profile";
+		++buckets[hash(key.data(), key.size()) & (bucketCount - 1)];
+	}
+	uint empty = 0;
+	uint longest = 0;
+	for (uint count: buckets)
+	{
+		if (count == 0)
+			++empty;
+		if (count > longest)
+			longest = count;
+	}
+	logs.info() << "  " << name << "\tempty buckets: " << empty << " / " << static_cast<uint>(bucketCount)
+		<< " (ideal: ~" << static_cast<uint>(bucketCount * 368 / 1000) << "), longest chain: " << longest;
+}
+
+
+
+
+int main()
+{
+	// realistic key lengths: identifiers, URLs, paths, and a few large buffers
+	const uint sizes[] = { 4, 8, 16, 24, 32, 48, 64, 128, 256, 1024, 16 * 1024 };
+	for (uint size: sizes)
+	{
+		std::vector<String> keys;
+		for (uint i = 0; i != 64; ++i)
+		{
+			String key;
+			while (key.size() < size)
+				key << "key" << i << '/';
+			key.truncate(size);
+			keys.push_back(key);
+		}
+
+		logs.info();
+		measure("sdbm  ", &HashSDBM, keys);
+		measure("wyhash", &HashBuffer, keys);
+	}
+
+	logs.info();
+	logs.info() << "distribution (65536 keys like /api/v1/users/<n>/profile, 65536 buckets)";
+	distribution("sdbm  ", &HashSDBM);
+	distribution("wyhash", &HashBuffer);
+	return 0;
+}
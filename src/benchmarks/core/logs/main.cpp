@@ -0,0 +1,124 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs.h>
+#include <yuni/core/system/suspend.h>
+#include <yuni/thread/utility.h>
+#include <yuni/io/file.h>
+#include <yuni/datetime/timestamp.h>
+#include <vector>
+
+using namespace Yuni;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Number of messages for each measure
+static const uint messageCount = 1000 * 1000;
+
+//! Temporary log file
+static const char* const filename = "yn-bench-core-logs.log";
+
+
+typedef Logs::Logger<Logs::File<> >  SyncLogger;
+typedef Logs::Logger<Logs::AsyncFile<> >  AsyncLogger;
+typedef Logs::Logger<Logs::AsyncFile<>, Logs::Time<Logs::VerbosityLevel<Logs::Message<> > >,
+	Policy::SingleThreaded>  AsyncLockFreeLogger;
+typedef Logs::Logger<Logs::BinaryFile<>, Logs::NullDecorator, Policy::SingleThreaded>  BinaryLogger;
+
+
+/*!
+** \brief Cost of the formatting of a message by a list of decorators
+*/
+template<class DecoratorsT>
+static void measureDecorators(const char* name)
+{
+	DecoratorsT decorators;
+	Clob buffer;
+	uint64 total = 0;
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i != messageCount; ++i)
+	{
+		buffer.clear();
+		decorators.template internalDecoratorAddPrefix<Logs::File<>, Logs::Verbosity::Notice>(buffer,
+			"request completed");
+		total += buffer.size();
+	}
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	if (duration <= 0)
+		duration = 1;
+	logs.info() << "  " << name << "\t" << ((static_cast<uint64>(duration) * 1000000u) / messageCount)
+		<< " ns/msg\t(" << (total / messageCount) << " bytes)";
+}
+
+
+/*!
+** \brief Log from several threads at once
+**
+** The time spent by the producers is measured first (latency seen by the
+** application), then the time until all messages are in the file.
+*/
+template<class LoggerT>
+static void measure(const char* name, uint threadCount)
+{
+	IO::File::Delete(filename);
+	LoggerT logger;
+	logger.logfile(filename);
+
+	const uint perThread = messageCount / threadCount;
+	sint64 start = DateTime::NowMilliSeconds();
+	std::vector<Thread::IThread::Ptr> threads;
+	for (uint t = 0; t != threadCount; ++t)
+	{
+		threads.push_back(spawn([&logger, perThread, t] () {
+			for (uint i = 0; i != perThread; ++i)
+				logger.notice() << Logs::Literal("thread ") << t << Logs::Literal(": request ") << i
+					<< Logs::Literal(" completed in ") << (i % 1000) << Logs::Literal("us");
+		}));
+	}
+	for (auto& thread: threads)
+		thread->wait();
+	sint64 produced = DateTime::NowMilliSeconds() - start;
+	logger.closeLogfile();
+	sint64 written = DateTime::NowMilliSeconds() - start;
+
+	if (produced <= 0)
+		produced = 1;
+	uint64 ns = (static_cast<uint64>(produced) * 1000000u) / (perThread * threadCount);
+	logs.info() << "  " << name << "\t" << threadCount << " thread(s):\t" << ns << " ns/msg\t(all written in "
+		<< written << "ms)";
+}
+
+
+
+
+int main()
+{
+	logs.info() << "decorators";
+	measureDecorators<Logs::Time<Logs::VerbosityLevel<Logs::Message<> > > >("Logs::Time                  ");
+	measureDecorators<Logs::PreciseTime<Logs::VerbosityLevel<Logs::Message<> > > >("Logs::PreciseTime           ");
+	measureDecorators<Logs::PreciseTime<Logs::VerbosityLevel<Logs::Message<> >, Logs::TimePrecision::nanoseconds> >(
+		"Logs::PreciseTime (ns)      ");
+
+	const uint threadCounts[] = { 1, 4, 8 };
+	for (uint count: threadCounts)
+	{
+		logs.info();
+		measure<SyncLogger>("Logs::File                  ", count);
+		measure<AsyncLogger>("Logs::AsyncFile             ", count);
+		measure<AsyncLockFreeLogger>("Logs::AsyncFile (lock-free) ", count);
+		measure<BinaryLogger>("Logs::BinaryFile            ", count);
+	}
+	IO::File::Delete(filename);
+	return 0;
+}
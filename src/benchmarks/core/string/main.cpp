@@ -0,0 +1,108 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs.h>
+#include <yuni/datetime/timestamp.h>
+#include <yuni/private/core/string/search.h>
+
+using namespace Yuni;
+using namespace Yuni::Private::CStringImpl;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Amount of data to scan for each measure
+static const uint64 volume = 512 * 1024 * 1024;
+
+//! Prevent the compiler from discarding the results
+static volatile uintptr_t sink = 0;
+
+
+
+
+/*!
+** \brief Run a search primitive on the whole haystack until `volume` bytes have been processed
+*/
+template<class F>
+static void measure(const SearchKernels& kernels, const char* what, const String& haystack, const F& callback)
+{
+	uint rounds = static_cast<uint>(volume / haystack.size());
+	if (rounds == 0)
+		rounds = 1;
+
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i != rounds; ++i)
+		sink = sink + callback(kernels, haystack.c_str(), haystack.size());
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	if (duration <= 0)
+		duration = 1;
+
+	uint64 mbps = (static_cast<uint64>(rounds) * haystack.size() * 1000u) / (static_cast<uint64>(duration) * 1024u * 1024u);
+	logs.info() << "  " << kernels.name << "\t" << what << "\t" << haystack.size() << " bytes:\t"
+		<< mbps << " MiB/s";
+}
+
+
+
+
+int main()
+{
+	// the kernels to compare
+	const SearchKernels* all[] =
+	{
+		SearchKernelsFor(SearchISA::scalar),
+		SearchKernelsFor(SearchISA::sse2),
+		SearchKernelsFor(SearchISA::avx2),
+	};
+	logs.info() << "selected kernels: " << BestSearchKernels().name;
+
+	const uint sizes[] = { 16, 64, 256, 4096, 1024 * 1024 };
+	for (uint size: sizes)
+	{
+		// text with many partial matches (the first byte of the substring), the needle being at the very end
+		String haystack;
+		haystack.reserve(size + 32);
+		while (haystack.size() < size)
+			haystack << "lorem ipsum, Dolor Sit amet ";
+		haystack.truncate(size - 8);
+		haystack << "# needle";
+
+		logs.info();
+		logs.info() << "haystack: " << size << " bytes";
+		for (const SearchKernels* kernels: all)
+		{
+			if (not kernels)
+				continue;
+
+			measure(*kernels, "find(char)      ", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return reinterpret_cast<uintptr_t>(k.findChar(s, len, '#'));
+			});
+			measure(*kernels, "ifind(char)     ", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return reinterpret_cast<uintptr_t>(k.ifindChar(s, len, '#'));
+			});
+			measure(*kernels, "find_first_of   ", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return reinterpret_cast<uintptr_t>(k.findFirstOf(s, len, "#;!?", 4));
+			});
+			measure(*kernels, "find(substring) ", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return reinterpret_cast<uintptr_t>(k.find(s, len, " needle", 7));
+			});
+			measure(*kernels, "ifind(substring)", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return reinterpret_cast<uintptr_t>(k.ifind(s, len, " NEEDLE", 7));
+			});
+			measure(*kernels, "countChar       ", haystack, [](const SearchKernels& k, const char* s, uint len) {
+				return static_cast<uintptr_t>(k.countChar(s, len, 'm'));
+			});
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,157 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs.h>
+#include <yuni/datetime/timestamp.h>
+#include <yuni/private/core/string/utf8.h>
+#include <vector>
+
+using namespace Yuni;
+using namespace Yuni::Private::CStringImpl;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Amount of data to process for each measure
+static const uint64 volume = 256 * 1024 * 1024;
+
+//! Prevent the compiler from discarding the results
+static volatile uintptr_t sink = 0;
+
+
+
+
+/*!
+** \brief Run a routine on the whole text until `volume` bytes have been processed
+*/
+template<class F>
+static void measure(const char* name, const char* what, const String& text, const F& callback)
+{
+	uint rounds = static_cast<uint>(volume / text.size());
+	if (rounds == 0)
+		rounds = 1;
+
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i != rounds; ++i)
+		sink = sink + callback(text);
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	if (duration <= 0)
+		duration = 1;
+
+	uint64 mbps = (static_cast<uint64>(rounds) * text.size() * 1000u) / (static_cast<uint64>(duration) * 1024u * 1024u);
+	logs.info() << "  " << name << "\t" << what << "\t" << text.size() << " bytes:\t" << mbps << " MiB/s";
+}
+
+
+//! The validation before the vectorized kernels (one code point at a time)
+static uintptr_t perCharValidate(const String& text)
+{
+	String::Size offset = 0;
+	UTF8::Char c;
+	UTF8::Error e;
+	while (UTF8::errNone == (e = text.utf8next<false>(offset, c)))
+	{}
+	return (e == UTF8::errOutOfBound) ? 1 : 0;
+}
+
+
+//! The count before the vectorized kernels
+static uintptr_t perCharCount(const String& text)
+{
+	uintptr_t r = 0;
+	for (uint i = 0; i != text.size(); ++i)
+	{
+		if ((text[i] & 0xc0) != 0x80)
+			++r;
+	}
+	return r;
+}
+
+
+
+
+int main()
+{
+	// the kernels to compare
+	const UTF8Kernels* all[] =
+	{
+		UTF8KernelsFor(SearchISA::scalar),
+		UTF8KernelsFor(SearchISA::sse2),
+		UTF8KernelsFor(SearchISA::avx2),
+	};
+	logs.info() << "selected kernels: " << BestUTF8Kernels().name;
+
+	// ASCII only, mostly ASCII, and mostly multibyte texts
+	const char* const samples[] =
+	{
+		"The quick brown fox jumps over the lazy dog. ",
+		"Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter. ",
+		"いろはにほへと ちりぬるを わかよたれそ つねならむ 😀 ",
+	};
+	const uint sizes[] = { 64, 4096, 1024 * 1024 };
+
+	std::vector<uint32> utf32;
+	std::vector<uint16> utf16;
+	std::vector<char> utf8;
+
+	for (const char* sample: samples)
+	{
+		for (uint size: sizes)
+		{
+			String text;
+			text.reserve(size + 128);
+			while (text.size() < size)
+				text << sample;
+
+			utf32.resize(text.size());
+			utf16.resize(text.size());
+			utf8.resize(text.size() * 4);
+			size_t n32 = BestUTF8Kernels().toUTF32(utf32.data(), text.c_str(), text.size());
+			size_t n16 = BestUTF8Kernels().toUTF16(utf16.data(), text.c_str(), text.size());
+
+			logs.info();
+			logs.info() << "text: " << text.size() << " bytes, " << text.utf8size() << " code points ("
+				<< AnyString(sample, 20) << "...)";
+
+			measure("per-char", "validate ", text, &perCharValidate);
+			measure("per-char", "count    ", text, &perCharCount);
+			for (const UTF8Kernels* kernels: all)
+			{
+				if (not kernels)
+					continue;
+				const UTF8Kernels& k = *kernels;
+
+				measure(k.name, "validate ", text, [&](const String& s) -> uintptr_t {
+					uint offset;
+					return static_cast<uintptr_t>(k.validate(s.c_str(), s.size(), offset));
+				});
+				measure(k.name, "count    ", text, [&](const String& s) -> uintptr_t {
+					return k.count(s.c_str(), s.size());
+				});
+				measure(k.name, "to UTF-32", text, [&](const String& s) -> uintptr_t {
+					return k.toUTF32(utf32.data(), s.c_str(), s.size());
+				});
+				measure(k.name, "to UTF-16", text, [&](const String& s) -> uintptr_t {
+					return k.toUTF16(utf16.data(), s.c_str(), s.size());
+				});
+				measure(k.name, "UTF-32 to", text, [&](const String&) -> uintptr_t {
+					return k.fromUTF32(utf8.data(), utf32.data(), n32);
+				});
+				measure(k.name, "UTF-16 to", text, [&](const String&) -> uintptr_t {
+					return k.fromUTF16(utf8.data(), utf16.data(), n16);
+				});
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,136 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/io/async.h>
+#include <yuni/io/file.h>
+#include <yuni/job/queue/service.h>
+#include <yuni/thread/utility.h>
+#include <yuni/core/logs.h>
+#include <yuni/datetime/timestamp.h>
+#include <atomic>
+#include <vector>
+#ifndef YUNI_OS_WINDOWS
+#	include <unistd.h>
+#endif
+
+using namespace Yuni;
+
+
+
+static Yuni::Logs::Logger<>  logs;
+
+//! Size of the file
+static const uint64 fileSize = 64 * 1024 * 1024;
+//! Size of a read
+static const uint blockSize = 4096;
+//! Number of reads
+static const uint readCount = 200000;
+
+
+static uint64 RandomOffset(uint64& seed)
+{
+	seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+	return ((seed >> 20) % (fileSize / blockSize)) * blockSize;
+}
+
+
+
+
+static void BlockingReads(Job::QueueService& queueservice, IO::Async::Handle handle)
+{
+	// one job per read, each job blocking a worker of the queueservice
+	std::atomic<uint64> bytes(0);
+	uint64 seed = 42;
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i != readCount; ++i)
+	{
+		uint64 offset = RandomOffset(seed);
+		async(queueservice, [&bytes, handle, offset]()
+		{
+			char buffer[blockSize];
+			# ifndef YUNI_OS_WINDOWS
+			ssize_t n = ::pread(handle, buffer, blockSize, static_cast<off_t>(offset));
+			if (n > 0)
+				bytes += static_cast<uint64>(n);
+			# endif
+		});
+	}
+	queueservice.wait(qseIdle);
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	logs.info() << "blocking reads (queueservice, " << queueservice.maximumThreadCount() << " workers): "
+		<< duration << "ms (" << (bytes.load() / (1024 * 1024)) << "MiB)";
+}
+
+
+static void AsyncReads(IO::Async::Handle handle, IO::Async::Backend backend)
+{
+	// the callbacks are executed by the service itself
+	IO::Async::Service service;
+	service.queueDepth(512);
+	if (not service.start(backend))
+	{
+		logs.warning() << "backend not available";
+		return;
+	}
+
+	// the buffers are reused (256 reads in flight per batch)
+	const uint batchSize = 256;
+	std::vector<char> buffers(batchSize * blockSize);
+	std::atomic<uint64> bytes(0);
+	auto callback = [&bytes](const IO::Async::Completion& completion) { bytes += completion.bytes; };
+
+	uint64 seed = 42;
+	sint64 start = DateTime::NowMilliSeconds();
+	for (uint i = 0; i < readCount; i += batchSize)
+	{
+		IO::Async::Batch batch;
+		for (uint j = 0; j != batchSize; ++j)
+			batch.read(handle, &buffers[j * blockSize], blockSize, RandomOffset(seed), callback);
+		service.submit(batch);
+		service.wait();
+	}
+	sint64 duration = DateTime::NowMilliSeconds() - start;
+	logs.info() << "async reads (" << ((service.backend() == IO::Async::Backend::uring) ? "io_uring" : "threads")
+		<< "): " << duration << "ms (" << (bytes.load() / (1024 * 1024)) << "MiB)";
+}
+
+
+
+
+int main()
+{
+	const AnyString filename = "yn-bench-io-async.tmp";
+	{
+		logs.info() << "creating " << (fileSize / (1024 * 1024)) << "MiB...";
+		IO::File::Stream file(filename, IO::OpenMode::write | IO::OpenMode::truncate);
+		std::vector<char> chunk(1024 * 1024, 'y');
+		for (uint64 i = 0; i != fileSize / chunk.size(); ++i)
+			file.write(chunk.data(), chunk.size());
+	}
+
+	IO::File::Stream file(filename);
+	IO::Async::Handle handle = IO::Async::NativeHandle(file);
+
+	Job::QueueService queueservice;
+	queueservice.start();
+
+	for (uint pass = 0; pass != 2; ++pass)
+	{
+		BlockingReads(queueservice, handle);
+		AsyncReads(handle, IO::Async::Backend::uring);
+		AsyncReads(handle, IO::Async::Backend::threads);
+	}
+
+	queueservice.stop();
+	file.close();
+	IO::File::Delete(filename);
+	return 0;
+}
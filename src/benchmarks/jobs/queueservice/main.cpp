@@ -12,6 +12,8 @@
 #include <yuni/job/queue/service.h>
 #include <yuni/thread/utility.h>
 #include <yuni/core/logs.h>
+#include <yuni/datetime/timestamp.h>
+#include <atomic>
 
 using namespace Yuni;
 
@@ -33,6 +35,7 @@ int main()
 	queueservice.start();
 
 	logs.info() << "creating jobs...";
+	sint64 start = DateTime::NowMilliSeconds();
 	for (uint i = 0; i != 2000000; ++i)
 	{
 		async(queueservice, [&, i]()
@@ -61,11 +64,28 @@ int main()
 		});
 	}
 
+	logs.info() << "jobs created in " << (DateTime::NowMilliSeconds() - start) << "ms";
+
 	logs.info() << "waiting for the queueservice...";
 	queueservice.wait(qseIdle);
-	logs.info() << "removing all jobs (executed: " << howMany << ", remaining: " << queueservice.waitingJobsCount() << ")";
+	logs.info() << "removing all jobs (executed: " << howMany << ", remaining: " << queueservice.waitingJobsCount()
+		<< ", total: " << (DateTime::NowMilliSeconds() - start) << "ms)";
 	queueservice.clear();
 
+	// tiny jobs, where the cost of the submission itself prevails
+	// (the lambdas are stored inline within the jobs, without any allocation in steady state)
+	std::atomic<uint> tinyCount(0);
+	for (uint pass = 0; pass != 3; ++pass)
+	{
+		start = DateTime::NowMilliSeconds();
+		for (uint i = 0; i != 2000000; ++i)
+			async(queueservice, [&tinyCount]() { ++tinyCount; });
+		sint64 created = DateTime::NowMilliSeconds() - start;
+		queueservice.wait(qseIdle);
+		logs.info() << "tiny jobs, pass " << pass << ": created in " << created << "ms, total: "
+			<< (DateTime::NowMilliSeconds() - start) << "ms (executed: " << tinyCount.load() << ")";
+	}
+
 	return 0;
 }
 
@@ -0,0 +1,91 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include <yuni/yuni.h>
+#include <yuni/core/string.h>
+#include <yuni/core/logs/binary/decoder.h>
+#include <iostream>
+
+using namespace Yuni;
+
+
+
+
+static void Usage(const char* argv0)
+{
+	std::cout << "Usage: " << argv0 << " [--precision=<digits>] <file>...\n"
+		<< "Print the messages of binary log files (see Logs::BinaryFile)\n\n"
+		<< "  --precision=<digits>  Digits for the fraction of seconds (0, 3, 6 or 9, default: 6)\n"
+		<< "  -h, --help            This help\n";
+}
+
+
+static bool Decode(const AnyString& filename, Logs::TimePrecision precision)
+{
+	Logs::BinaryDecoder decoder;
+	if (not decoder.open(filename))
+	{
+		std::cerr << "error: " << filename << ": impossible to open the file or not a binary log file\n";
+		return false;
+	}
+	decoder.precision(precision);
+
+	Clob line;
+	while (decoder.next(line))
+	{
+		line += '\n';
+		std::cout.write(line.data(), line.size());
+	}
+	if (decoder.error())
+	{
+		std::cerr << "error: " << filename << ": invalid or truncated file\n";
+		return false;
+	}
+	return true;
+}
+
+
+int main(int argc, char** argv)
+{
+	Logs::TimePrecision precision = Logs::TimePrecision::microseconds;
+	uint count = 0;
+	bool success = true;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		AnyString arg = argv[i];
+		if (arg == "-h" or arg == "--help")
+		{
+			Usage(argv[0]);
+			return 0;
+		}
+		if (arg.startsWith("--precision="))
+		{
+			uint digits;
+			if (not AnyString(arg, 12).to(digits) or (digits != 0 and digits != 3 and digits != 6 and digits != 9))
+			{
+				std::cerr << "error: invalid precision '" << AnyString(arg, 12) << "'\n";
+				return 1;
+			}
+			precision = static_cast<Logs::TimePrecision>(digits);
+			continue;
+		}
+		++count;
+		if (not Decode(arg, precision))
+			success = false;
+	}
+
+	if (count == 0)
+	{
+		Usage(argv[0]);
+		return 1;
+	}
+	return success ? 0 : 1;
+}
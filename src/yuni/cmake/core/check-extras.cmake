@@ -20,6 +20,7 @@ endif()
 
 if (NOT MSVC)
 	check_c_compiler_flag("-w" YUNI_HAS_GCC_NOWARNING)
+	check_cxx_compiler_flag("-mavx2" YUNI_HAS_GCC_MAVX2)
 else()
 	check_c_compiler_flag("/nowarn" YUNI_HAS_VS_NOWARNING)
 endif()
@@ -67,6 +67,8 @@ check_include_file(stdarg.h YUNI_HAS_STDARG_H)
 if(NOT APPLE AND NOT WIN32 AND NOT WIN64)
 	# sys/sendfile.h
 	check_include_file_cxx("sys/sendfile.h" YUNI_HAS_SYS_SENDFILE_H)
+	# linux/io_uring.h
+	check_include_file("linux/io_uring.h" YUNI_HAS_LINUX_IO_URING_H)
 endif()
 
 if(NOT MSVC)
@@ -104,6 +104,8 @@ add_library(yuni-static-core STATIC
 		core/bind/bind.hxx
 		core/bind/traits.h
 		core/bind/fwd.h
+		core/bind/holder.h
+		core/bind/holder.hxx
 		core/bind.h
 		core/bit/array.cpp
 		core/bit/array.h
@@ -128,6 +130,9 @@ add_library(yuni-static-core STATIC
 		core/dynamiclibrary/symbol.h
 		core/dynamiclibrary/symbol.hxx
 		core/dynamiclibrary.h
+		core/event/bind-array.cpp
+		core/event/bind-array.h
+		core/event/bind-array.hxx
 		core/event/event.h
 		core/event/event.hxx
 		core/event/flow/continuous.h
@@ -142,6 +147,8 @@ add_library(yuni-static-core STATIC
 		core/event/observer/item.hxx
 		core/event/observer/observer.h
 		core/event/observer/observer.hxx
+		core/event/request-queue.h
+		core/event/request-queue.hxx
 		core/event/statistics/none.h
 		core/event/traits.h
 		core/event.h
@@ -160,30 +167,58 @@ add_library(yuni-static-core STATIC
 		core/getopt/parser.hxx
 		core/getopt.h
 		core/hash
+		core/hash/buffer.h
+		core/hash/buffer/buffer.cpp
+		core/hash/buffer/buffer.h
+		core/hash/buffer/buffer.hxx
 		core/hash/checksum/checksum.h
 		core/hash/checksum/checksum.hxx
 		core/hash/checksum/md5.cpp
 		core/hash/checksum/md5.h
 		core/hash/checksum/md5.hxx
+		core/hash/flat.h
+		core/hash/flat/flat.h
+		core/hash/flat/flat.hxx
+		core/hash/flat/group.h
 		core/hash/table/table.h
 		core/hash/table/table.hxx
 		core/hash/table.h
 		core/iterator/iterator.h
 		core/iterator/iterator.hxx
 		core/iterator.h
+		core/logs/async/writer.cpp
+		core/logs/async/writer.h
+		core/logs/binary/decoder.cpp
+		core/logs/binary/decoder.h
+		core/logs/binary/format.h
+		core/logs/binary/record.cpp
+		core/logs/binary/record.h
+		core/logs/binary/record.hxx
+		core/logs/binary/transcoder.cpp
+		core/logs/binary/transcoder.h
 		core/logs/buffer.h
 		core/logs/decorators/applicationname.h
 		core/logs/decorators/message.h
+		core/logs/decorators/precisetime.cpp
+		core/logs/decorators/precisetime.h
 		core/logs/decorators/time.cpp
 		core/logs/decorators/time.h
 		core/logs/decorators/verbositylevel.h
+		core/logs/handler/asyncfile.h
+		core/logs/handler/asyncfile.hxx
+		core/logs/handler/binaryfile.h
+		core/logs/handler/binaryfile.hxx
 		core/logs/handler/callback.h
 		core/logs/handler/file.h
 		core/logs/handler/file.hxx
 		core/logs/handler/stdcout.h
+		core/logs/literal.h
 		core/logs/logs.h
 		core/logs/logs.hxx
 		core/logs/null.h
+		core/logs/rotation/rotator.cpp
+		core/logs/rotation/rotator.h
+		core/logs/rotation/rotator.hxx
 		core/logs/verbosity.h
 		core/logs.h
 		core/math
@@ -301,6 +336,9 @@ add_library(yuni-static-core STATIC
 		core/string/traits/fill.h
 		core/string/traits/integer.h
 		core/string/traits/into.h
+		core/string/traits/number.cpp
+		core/string/traits/number.h
+		core/string/traits/number.hxx
 		core/string/traits/traits.cpp
 		core/string/traits/traits.h
 		core/string/traits/traits.hxx
@@ -407,6 +445,12 @@ add_library(yuni-static-core STATIC
 		datetime/timestamp.cpp
 
 
+		io/async.h
+		io/async/backend.h
+		io/async/backend-threads.cpp
+		io/async/backend-uring.cpp
+		io/async/service.cpp
+		io/async/service.h
 		io/constants.cpp
 		io/constants.h
 		io/directory/commons.h
@@ -436,6 +480,9 @@ add_library(yuni-static-core STATIC
 		io/file/file.cpp
 		io/file/file.h
 		io/file/file.hxx
+		io/file/mappedview.cpp
+		io/file/mappedview.h
+		io/file/mappedview.hxx
 		io/file/openmode.cpp
 		io/file/openmode.h
 		io/file/stream.cpp
@@ -456,9 +503,14 @@ add_library(yuni-static-core STATIC
 
 		job/enum.h
 		job/fwd.h
+		job/graph.cpp
+		job/graph.h
 		job/job.cpp
 		job/job.h
 		job/job.hxx
+		job/queue/local-queue.cpp
+		job/queue/local-queue.h
+		job/queue/local-queue.hxx
 		job/queue/service.cpp
 		job/queue/service.h
 		job/queue/service.hxx
@@ -469,6 +521,19 @@ add_library(yuni-static-core STATIC
 		job/taskgroup.h
 		job/taskgroup.hxx
 		job/taskgroup.cpp
+		private/core/string/search.cpp
+		private/core/string/search.h
+		private/core/string/search-avx2.cpp
+		private/core/string/search-kernels.hxx
+		private/core/string/search-sse2.hxx
+		private/core/string/utf8.cpp
+		private/core/string/utf8.h
+		private/core/string/utf8-avx2.cpp
+		private/core/string/utf8-kernels.hxx
+		private/jobs/allocator.cpp
+		private/jobs/allocator.h
+		private/jobs/callback-job.h
+		private/jobs/callback-job.hxx
 		private/jobs/queue/thread.h
 		private/jobs/queue/thread.cpp
 		private/jobs/queue/thread.hxx
@@ -499,10 +564,13 @@ add_library(yuni-static-core STATIC
 		thread/thread.cpp
 		thread/thread.h
 		thread/thread.hxx
+		thread/timer-service.cpp
+		thread/timer-service.h
 		thread/timer.cpp
 		thread/timer.h
 		thread/timer.hxx
 		thread/utility.h
+		thread/utility.hxx
 
 		${yuni_additional_os_specific}
 	)
@@ -513,6 +581,12 @@ if (WIN32 OR WIN64)
 	add_definitions("-D_USE_64BIT_TIME_T")
 endif ()
 
+# The AVX2 string primitives (search, UTF-8) are selected at runtime, according to the CPU
+if (YUNI_HAS_GCC_MAVX2)
+	set_source_files_properties(private/core/string/search-avx2.cpp PROPERTIES COMPILE_FLAGS -mavx2)
+	set_source_files_properties(private/core/string/utf8-avx2.cpp PROPERTIES COMPILE_FLAGS -mavx2)
+endif()
+
 # Setting output path
 set_target_properties(yuni-static-core PROPERTIES
 		ARCHIVE_OUTPUT_DIRECTORY "${YUNI_OUTPUT_DIRECTORY}/lib")
@@ -23,6 +23,9 @@ set(SRC_NET_MESSAGE
 	messaging/threadcontext.h
 	messaging/threadcontext.cpp
 	messaging/threadcontext.hxx
+	messaging/statistics.h
+	messaging/statistics.hxx
+	messaging/statistics.cpp
 )
 source_group("Messaging" FILES ${SRC_NET_MESSAGE})
 
@@ -37,6 +40,10 @@ set(SRC_NET_MESSAGE_TRANSPORT_REST
 	messaging/transport/rest/server.h
 	messaging/transport/rest/server.cpp
 	messaging/transport/rest/request.inc.hpp
+	messaging/transport/rest/decision-tree.inc.hpp
+	messaging/transport/rest/decision-tree.cpp
+	messaging/transport/rest/event-server.h
+	messaging/transport/rest/event-server.cpp
 )
 source_group("Messaging\\Transport\\REST" FILES ${SRC_NET_MESSAGE_TRANSPORT_REST})
 
@@ -48,6 +48,9 @@
 /* sys/sendfile.h */
 #cmakedefine YUNI_HAS_SYS_SENDFILE_H
 
+/* linux/io_uring.h */
+#cmakedefine YUNI_HAS_LINUX_IO_URING_H
+
 
 
 
@@ -45,6 +45,7 @@
 #include "../static/remove.h"
 #include "../smartptr.h"
 #include "traits.h"
+#include "holder.h"
 #include "../dynamiclibrary/symbol.h"
 #include "fwd.h"
 
@@ -122,7 +123,10 @@ namespace Yuni
 	** }
 	** \endcode
 	**
-	** This class is thread-safe, this is guaranteed by the use of smartptr.
+	** This class is thread-safe. The target of the bind is stored inline when small
+	** enough (a pointer-to-function, a pointer-to-member or a lambda with a few captures),
+	** and copied along with the bind, without any heap allocation. Larger targets are
+	** allocated once and shared between the copies.
 	**
 	** \note This class does not take care of deleted objects. It is the responsibility
 	** of the user to unbind the delegate before the linked object is delete and/or
@@ -523,10 +527,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -908,10 +911,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -1293,10 +1295,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -1678,10 +1679,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -2063,10 +2063,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -2448,10 +2447,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -2833,10 +2831,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -3218,10 +3215,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -3603,10 +3599,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -3988,10 +3983,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -4373,10 +4367,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -4758,10 +4751,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -5143,10 +5135,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -5528,10 +5519,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -5913,10 +5903,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -6298,10 +6287,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -6683,10 +6671,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -7068,10 +7055,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -7453,10 +7439,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -7838,10 +7823,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -8223,10 +8207,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -8608,10 +8591,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -8993,10 +8975,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -9378,10 +9359,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -9763,10 +9743,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -10148,10 +10127,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -10533,10 +10511,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -10918,10 +10895,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -11303,10 +11279,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -11688,10 +11663,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -12073,10 +12047,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -12458,10 +12431,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -12843,10 +12815,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -13228,10 +13199,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -13613,10 +13583,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -13998,10 +13967,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -14383,10 +14351,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -14768,10 +14735,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -15153,10 +15119,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -15538,10 +15503,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -15923,10 +15887,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -16308,10 +16271,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -16693,10 +16655,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -17078,10 +17039,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -17463,10 +17423,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -17848,10 +17807,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -18233,10 +18191,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -18618,10 +18575,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -19003,10 +18959,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -19388,10 +19343,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -19773,10 +19727,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -45,6 +45,7 @@
 #include "../static/remove.h"
 #include "../smartptr.h"
 #include "traits.h"
+#include "holder.h"
 #include "../dynamiclibrary/symbol.h"
 #include "fwd.h"
 
@@ -121,7 +122,10 @@ namespace Yuni
 	** }
 	** \endcode
 	**
-	** This class is thread-safe, this is guaranteed by the use of smartptr.
+	** This class is thread-safe. The target of the bind is stored inline when small
+	** enough (a pointer-to-function, a pointer-to-member or a lambda with a few captures),
+	** and copied along with the bind, without any heap allocation. Larger targets are
+	** allocated once and shared between the copies.
 	**
 	** \note This class does not take care of deleted objects. It is the responsibility
 	** of the user to unbind the delegate before the linked object is delete and/or
@@ -446,10 +450,9 @@ namespace Yuni
 
 		/*!
 		** \brief Pointer to function/member
-		** \internal The smartptr is used to guarantee the thread-safety, and to avoid
-		** expensive copies
+		** \internal Stored inline when small enough (see Private::BindImpl::Holder)
 		*/
-		SmartPtr<IHolder> pHolder;
+		Private::BindImpl::Holder<IHolder> pHolder;
 
 		template<bool> friend struct Yuni::Private::BindImpl::MoveConstructor;
 
@@ -61,8 +61,9 @@ namespace Yuni
 	// Constructor
 	template<class R>
 	inline Bind<R (), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R ()>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
+	}
 
 	// Constructor
 	template<class R>
@@ -73,10 +74,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R>
-	inline Bind<R (), void>::Bind(Bind&& rhs)
+	inline Bind<R (), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -98,13 +100,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -133,7 +135,7 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (), void>::bind(R (*pointer)())
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R ()>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(pointer);
 	}
 
 
@@ -143,7 +145,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R ()>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -156,8 +158,8 @@ namespace Yuni
 	inline void Bind<R (), void>::bind(R (*pointer)(U),
 		typename Bind<R (), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (U)> >(pointer, userdata);
 	}
 
 
@@ -169,13 +171,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -189,7 +191,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -207,8 +209,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -230,8 +231,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -253,8 +253,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -276,9 +275,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -300,9 +298,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -319,9 +316,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -339,9 +335,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -352,7 +347,6 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (), void>::bind(const Bind<R (), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -361,7 +355,7 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R ()>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
 	}
 
 
@@ -482,7 +476,6 @@ namespace Yuni
 	template<class R>
 	inline Bind<R (), void>& Bind<R (), void>::operator = (const Bind<R (), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -493,8 +486,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (), void>& Bind<R (), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -530,8 +522,9 @@ namespace Yuni
 	// Constructor
 	template<class R>
 	inline Bind<R (*)(), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R ()>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
+	}
 
 	// Constructor
 	template<class R>
@@ -542,10 +535,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R>
-	inline Bind<R (*)(), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -567,13 +561,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -602,7 +596,7 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (*)(), void>::bind(R (*pointer)())
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R ()>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(pointer);
 	}
 
 
@@ -612,7 +606,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R ()>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -625,8 +619,8 @@ namespace Yuni
 	inline void Bind<R (*)(), void>::bind(R (*pointer)(U),
 		typename Bind<R (*)(), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (U)> >(pointer, userdata);
 	}
 
 
@@ -638,13 +632,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -658,7 +652,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -676,8 +670,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -699,8 +692,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -722,8 +714,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -745,9 +736,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -769,9 +759,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -788,9 +777,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -808,9 +796,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -821,7 +808,6 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (*)(), void>::bind(const Bind<R (*)(), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -830,7 +816,7 @@ namespace Yuni
 	template<class R>
 	inline void Bind<R (*)(), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R ()>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
 	}
 
 
@@ -951,7 +937,6 @@ namespace Yuni
 	template<class R>
 	inline Bind<R (*)(), void>& Bind<R (*)(), void>::operator = (const Bind<R (*)(), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -962,8 +947,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(), void>& Bind<R (*)(), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -999,8 +983,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R>
 	inline Bind<R (ClassT::*)(), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R ()>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R>
@@ -1011,10 +996,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R>
-	inline Bind<R (ClassT::*)(), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -1036,13 +1022,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -1071,7 +1057,7 @@ namespace Yuni
 	template<class ClassT, class R>
 	inline void Bind<R (ClassT::*)(), ClassT>::bind(R (*pointer)())
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R ()>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(pointer);
 	}
 
 
@@ -1081,7 +1067,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R ()>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R ()> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -1094,8 +1080,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(), ClassT>::bind(R (*pointer)(U),
 		typename Bind<R (ClassT::*)(), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (U)> >(pointer, userdata);
 	}
 
 
@@ -1107,13 +1093,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -1127,7 +1113,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -1145,8 +1131,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
-			pHolder = new Private::BindImpl::BoundWithMember<C, R()>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R()> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1168,8 +1153,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1191,8 +1175,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)();
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R()> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1214,9 +1197,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1238,9 +1220,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1257,9 +1238,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1277,9 +1257,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1290,7 +1269,6 @@ namespace Yuni
 	template<class ClassT, class R>
 	inline void Bind<R (ClassT::*)(), ClassT>::bind(const Bind<R (ClassT::*)(), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -1299,7 +1277,7 @@ namespace Yuni
 	template<class ClassT, class R>
 	inline void Bind<R (ClassT::*)(), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R ()>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R ()> >(); // unbind
 	}
 
 
@@ -1420,7 +1398,6 @@ namespace Yuni
 	template<class ClassT, class R>
 	inline Bind<R (ClassT::*)(), ClassT>& Bind<R (ClassT::*)(), ClassT>::operator = (const Bind<R (ClassT::*)(), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -1431,8 +1408,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(), ClassT>& Bind<R (ClassT::*)(), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R ()>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R ()> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -1468,8 +1444,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0>
 	inline Bind<R (A0), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0>
@@ -1480,10 +1457,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0>
-	inline Bind<R (A0), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -1505,13 +1483,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -1540,7 +1518,7 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (A0), void>::bind(R (*pointer)(A0))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(pointer);
 	}
 
 
@@ -1550,7 +1528,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -1563,8 +1541,8 @@ namespace Yuni
 	inline void Bind<R (A0), void>::bind(R (*pointer)(A0, U),
 		typename Bind<R (A0), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, U)> >(pointer, userdata);
 	}
 
 
@@ -1576,13 +1554,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -1596,7 +1574,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -1614,8 +1592,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1637,8 +1614,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1660,8 +1636,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -1683,9 +1658,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1707,9 +1681,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1726,9 +1699,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1746,9 +1718,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -1759,7 +1730,6 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (A0), void>::bind(const Bind<R (A0), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -1768,7 +1738,7 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (A0), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
 	}
 
 
@@ -1889,7 +1859,6 @@ namespace Yuni
 	template<class R, class A0>
 	inline Bind<R (A0), void>& Bind<R (A0), void>::operator = (const Bind<R (A0), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -1900,8 +1869,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0), void>& Bind<R (A0), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -1937,8 +1905,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0>
 	inline Bind<R (*)(A0), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0>
@@ -1949,10 +1918,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0>
-	inline Bind<R (*)(A0), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -1974,13 +1944,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -2009,7 +1979,7 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (*)(A0), void>::bind(R (*pointer)(A0))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(pointer);
 	}
 
 
@@ -2019,7 +1989,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -2032,8 +2002,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0), void>::bind(R (*pointer)(A0, U),
 		typename Bind<R (*)(A0), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, U)> >(pointer, userdata);
 	}
 
 
@@ -2045,13 +2015,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -2065,7 +2035,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -2083,8 +2053,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2106,8 +2075,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2129,8 +2097,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2152,9 +2119,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2176,9 +2142,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2195,9 +2160,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2215,9 +2179,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2228,7 +2191,6 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (*)(A0), void>::bind(const Bind<R (*)(A0), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -2237,7 +2199,7 @@ namespace Yuni
 	template<class R, class A0>
 	inline void Bind<R (*)(A0), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
 	}
 
 
@@ -2358,7 +2320,6 @@ namespace Yuni
 	template<class R, class A0>
 	inline Bind<R (*)(A0), void>& Bind<R (*)(A0), void>::operator = (const Bind<R (*)(A0), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -2369,8 +2330,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0), void>& Bind<R (*)(A0), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -2406,8 +2366,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0>
 	inline Bind<R (ClassT::*)(A0), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0>
@@ -2418,10 +2379,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0>
-	inline Bind<R (ClassT::*)(A0), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -2443,13 +2405,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -2478,7 +2440,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0>
 	inline void Bind<R (ClassT::*)(A0), ClassT>::bind(R (*pointer)(A0))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(pointer);
 	}
 
 
@@ -2488,7 +2450,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -2501,8 +2463,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0), ClassT>::bind(R (*pointer)(A0, U),
 		typename Bind<R (ClassT::*)(A0), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, U)> >(pointer, userdata);
 	}
 
 
@@ -2514,13 +2476,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -2534,7 +2496,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -2552,8 +2514,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2575,8 +2536,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2598,8 +2558,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -2621,9 +2580,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2645,9 +2603,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2664,9 +2621,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2684,9 +2640,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -2697,7 +2652,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0>
 	inline void Bind<R (ClassT::*)(A0), ClassT>::bind(const Bind<R (ClassT::*)(A0), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -2706,7 +2660,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0>
 	inline void Bind<R (ClassT::*)(A0), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0)> >(); // unbind
 	}
 
 
@@ -2827,7 +2781,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0>
 	inline Bind<R (ClassT::*)(A0), ClassT>& Bind<R (ClassT::*)(A0), ClassT>::operator = (const Bind<R (ClassT::*)(A0), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -2838,8 +2791,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0), ClassT>& Bind<R (ClassT::*)(A0), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -2875,8 +2827,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1>
 	inline Bind<R (A0, A1), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1>
@@ -2887,10 +2840,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1>
-	inline Bind<R (A0, A1), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -2912,13 +2866,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -2947,7 +2901,7 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (A0, A1), void>::bind(R (*pointer)(A0, A1))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(pointer);
 	}
 
 
@@ -2957,7 +2911,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -2970,8 +2924,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1), void>::bind(R (*pointer)(A0, A1, U),
 		typename Bind<R (A0, A1), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, U)> >(pointer, userdata);
 	}
 
 
@@ -2983,13 +2937,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -3003,7 +2957,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -3021,8 +2975,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3044,8 +2997,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3067,8 +3019,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3090,9 +3041,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3114,9 +3064,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3133,9 +3082,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3153,9 +3101,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3166,7 +3113,6 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (A0, A1), void>::bind(const Bind<R (A0, A1), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -3175,7 +3121,7 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (A0, A1), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
 	}
 
 
@@ -3297,7 +3243,6 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline Bind<R (A0, A1), void>& Bind<R (A0, A1), void>::operator = (const Bind<R (A0, A1), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -3308,8 +3253,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1), void>& Bind<R (A0, A1), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -3345,8 +3289,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1>
 	inline Bind<R (*)(A0, A1), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1>
@@ -3357,10 +3302,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1>
-	inline Bind<R (*)(A0, A1), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -3382,13 +3328,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -3417,7 +3363,7 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (*)(A0, A1), void>::bind(R (*pointer)(A0, A1))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(pointer);
 	}
 
 
@@ -3427,7 +3373,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -3440,8 +3386,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1), void>::bind(R (*pointer)(A0, A1, U),
 		typename Bind<R (*)(A0, A1), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, U)> >(pointer, userdata);
 	}
 
 
@@ -3453,13 +3399,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -3473,7 +3419,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -3491,8 +3437,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3514,8 +3459,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3537,8 +3481,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3560,9 +3503,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3584,9 +3526,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3603,9 +3544,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3623,9 +3563,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -3636,7 +3575,6 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (*)(A0, A1), void>::bind(const Bind<R (*)(A0, A1), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -3645,7 +3583,7 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline void Bind<R (*)(A0, A1), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
 	}
 
 
@@ -3767,7 +3705,6 @@ namespace Yuni
 	template<class R, class A0, class A1>
 	inline Bind<R (*)(A0, A1), void>& Bind<R (*)(A0, A1), void>::operator = (const Bind<R (*)(A0, A1), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -3778,8 +3715,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1), void>& Bind<R (*)(A0, A1), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -3815,8 +3751,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1>
 	inline Bind<R (ClassT::*)(A0, A1), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1>
@@ -3827,10 +3764,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1>
-	inline Bind<R (ClassT::*)(A0, A1), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -3852,13 +3790,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -3887,7 +3825,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1>
 	inline void Bind<R (ClassT::*)(A0, A1), ClassT>::bind(R (*pointer)(A0, A1))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(pointer);
 	}
 
 
@@ -3897,7 +3835,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -3910,8 +3848,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1), ClassT>::bind(R (*pointer)(A0, A1, U),
 		typename Bind<R (ClassT::*)(A0, A1), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, U)> >(pointer, userdata);
 	}
 
 
@@ -3923,13 +3861,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -3943,7 +3881,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -3961,8 +3899,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -3984,8 +3921,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4007,8 +3943,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4030,9 +3965,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4054,9 +3988,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4073,9 +4006,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4093,9 +4025,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4106,7 +4037,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1>
 	inline void Bind<R (ClassT::*)(A0, A1), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -4115,7 +4045,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1>
 	inline void Bind<R (ClassT::*)(A0, A1), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1)> >(); // unbind
 	}
 
 
@@ -4237,7 +4167,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1>
 	inline Bind<R (ClassT::*)(A0, A1), ClassT>& Bind<R (ClassT::*)(A0, A1), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -4248,8 +4177,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1), ClassT>& Bind<R (ClassT::*)(A0, A1), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -4285,8 +4213,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2>
 	inline Bind<R (A0, A1, A2), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2>
@@ -4297,10 +4226,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2>
-	inline Bind<R (A0, A1, A2), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -4322,13 +4252,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -4357,7 +4287,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (A0, A1, A2), void>::bind(R (*pointer)(A0, A1, A2))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(pointer);
 	}
 
 
@@ -4367,7 +4297,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -4380,8 +4310,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2), void>::bind(R (*pointer)(A0, A1, A2, U),
 		typename Bind<R (A0, A1, A2), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)> >(pointer, userdata);
 	}
 
 
@@ -4393,13 +4323,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -4413,7 +4343,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -4431,8 +4361,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4454,8 +4383,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4477,8 +4405,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4500,9 +4427,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4524,9 +4450,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4543,9 +4468,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4563,9 +4487,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4576,7 +4499,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (A0, A1, A2), void>::bind(const Bind<R (A0, A1, A2), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -4585,7 +4507,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (A0, A1, A2), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
 	}
 
 
@@ -4707,7 +4629,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline Bind<R (A0, A1, A2), void>& Bind<R (A0, A1, A2), void>::operator = (const Bind<R (A0, A1, A2), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -4718,8 +4639,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2), void>& Bind<R (A0, A1, A2), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -4755,8 +4675,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2>
 	inline Bind<R (*)(A0, A1, A2), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2>
@@ -4767,10 +4688,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2>
-	inline Bind<R (*)(A0, A1, A2), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -4792,13 +4714,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -4827,7 +4749,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (*)(A0, A1, A2), void>::bind(R (*pointer)(A0, A1, A2))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(pointer);
 	}
 
 
@@ -4837,7 +4759,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -4850,8 +4772,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2), void>::bind(R (*pointer)(A0, A1, A2, U),
 		typename Bind<R (*)(A0, A1, A2), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)> >(pointer, userdata);
 	}
 
 
@@ -4863,13 +4785,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -4883,7 +4805,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -4901,8 +4823,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4924,8 +4845,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4947,8 +4867,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -4970,9 +4889,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -4994,9 +4912,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5013,9 +4930,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5033,9 +4949,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5046,7 +4961,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (*)(A0, A1, A2), void>::bind(const Bind<R (*)(A0, A1, A2), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -5055,7 +4969,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline void Bind<R (*)(A0, A1, A2), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
 	}
 
 
@@ -5177,7 +5091,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2>
 	inline Bind<R (*)(A0, A1, A2), void>& Bind<R (*)(A0, A1, A2), void>::operator = (const Bind<R (*)(A0, A1, A2), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -5188,8 +5101,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2), void>& Bind<R (*)(A0, A1, A2), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -5225,8 +5137,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2>
 	inline Bind<R (ClassT::*)(A0, A1, A2), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2>
@@ -5237,10 +5150,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2>
-	inline Bind<R (ClassT::*)(A0, A1, A2), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -5262,13 +5176,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -5297,7 +5211,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2>
 	inline void Bind<R (ClassT::*)(A0, A1, A2), ClassT>::bind(R (*pointer)(A0, A1, A2))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(pointer);
 	}
 
 
@@ -5307,7 +5221,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -5320,8 +5234,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2), ClassT>::bind(R (*pointer)(A0, A1, A2, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, U)> >(pointer, userdata);
 	}
 
 
@@ -5333,13 +5247,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -5353,7 +5267,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -5371,8 +5285,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5394,8 +5307,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5417,8 +5329,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5440,9 +5351,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5464,9 +5374,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5483,9 +5392,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5503,9 +5411,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5516,7 +5423,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2>
 	inline void Bind<R (ClassT::*)(A0, A1, A2), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -5525,7 +5431,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2>
 	inline void Bind<R (ClassT::*)(A0, A1, A2), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2)> >(); // unbind
 	}
 
 
@@ -5647,7 +5553,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2>
 	inline Bind<R (ClassT::*)(A0, A1, A2), ClassT>& Bind<R (ClassT::*)(A0, A1, A2), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -5658,8 +5563,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2), ClassT>& Bind<R (ClassT::*)(A0, A1, A2), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -5695,8 +5599,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (A0, A1, A2, A3), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3>
@@ -5707,10 +5612,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3>
-	inline Bind<R (A0, A1, A2, A3), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -5732,13 +5638,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -5767,7 +5673,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (A0, A1, A2, A3), void>::bind(R (*pointer)(A0, A1, A2, A3))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(pointer);
 	}
 
 
@@ -5777,7 +5683,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -5790,8 +5696,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3), void>::bind(R (*pointer)(A0, A1, A2, A3, U),
 		typename Bind<R (A0, A1, A2, A3), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)> >(pointer, userdata);
 	}
 
 
@@ -5803,13 +5709,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -5823,7 +5729,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -5841,8 +5747,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5864,8 +5769,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5887,8 +5791,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -5910,9 +5813,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5934,9 +5836,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5953,9 +5854,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5973,9 +5873,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -5986,7 +5885,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (A0, A1, A2, A3), void>::bind(const Bind<R (A0, A1, A2, A3), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -5995,7 +5893,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (A0, A1, A2, A3), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
 	}
 
 
@@ -6118,7 +6016,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (A0, A1, A2, A3), void>& Bind<R (A0, A1, A2, A3), void>::operator = (const Bind<R (A0, A1, A2, A3), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -6129,8 +6026,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3), void>& Bind<R (A0, A1, A2, A3), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -6166,8 +6062,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (*)(A0, A1, A2, A3), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3>
@@ -6178,10 +6075,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3>
-	inline Bind<R (*)(A0, A1, A2, A3), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -6203,13 +6101,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -6238,7 +6136,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (*)(A0, A1, A2, A3), void>::bind(R (*pointer)(A0, A1, A2, A3))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(pointer);
 	}
 
 
@@ -6248,7 +6146,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -6261,8 +6159,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3), void>::bind(R (*pointer)(A0, A1, A2, A3, U),
 		typename Bind<R (*)(A0, A1, A2, A3), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)> >(pointer, userdata);
 	}
 
 
@@ -6274,13 +6172,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -6294,7 +6192,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -6312,8 +6210,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6335,8 +6232,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6358,8 +6254,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6381,9 +6276,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6405,9 +6299,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6424,9 +6317,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6444,9 +6336,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6457,7 +6348,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (*)(A0, A1, A2, A3), void>::bind(const Bind<R (*)(A0, A1, A2, A3), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -6466,7 +6356,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (*)(A0, A1, A2, A3), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
 	}
 
 
@@ -6589,7 +6479,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (*)(A0, A1, A2, A3), void>& Bind<R (*)(A0, A1, A2, A3), void>::operator = (const Bind<R (*)(A0, A1, A2, A3), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -6600,8 +6489,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3), void>& Bind<R (*)(A0, A1, A2, A3), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -6637,8 +6525,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
@@ -6649,10 +6538,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -6674,13 +6564,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -6709,7 +6599,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::bind(R (*pointer)(A0, A1, A2, A3))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(pointer);
 	}
 
 
@@ -6719,7 +6609,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -6732,8 +6622,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, U)> >(pointer, userdata);
 	}
 
 
@@ -6745,13 +6635,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -6765,7 +6655,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -6783,8 +6673,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6806,8 +6695,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6829,8 +6717,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -6852,9 +6739,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6876,9 +6762,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6895,9 +6780,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6915,9 +6799,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -6928,7 +6811,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -6937,7 +6819,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3)> >(); // unbind
 	}
 
 
@@ -7060,7 +6942,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -7071,8 +6952,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -7108,8 +6988,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (A0, A1, A2, A3, A4), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
@@ -7120,10 +7001,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
-	inline Bind<R (A0, A1, A2, A3, A4), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -7145,13 +7027,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -7180,7 +7062,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (A0, A1, A2, A3, A4), void>::bind(R (*pointer)(A0, A1, A2, A3, A4))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(pointer);
 	}
 
 
@@ -7190,7 +7072,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -7203,8 +7085,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, U),
 		typename Bind<R (A0, A1, A2, A3, A4), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)> >(pointer, userdata);
 	}
 
 
@@ -7216,13 +7098,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -7236,7 +7118,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -7254,8 +7136,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7277,8 +7158,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7300,8 +7180,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7323,9 +7202,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7347,9 +7225,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7366,9 +7243,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7386,9 +7262,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7399,7 +7274,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (A0, A1, A2, A3, A4), void>::bind(const Bind<R (A0, A1, A2, A3, A4), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -7408,7 +7282,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (A0, A1, A2, A3, A4), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
 	}
 
 
@@ -7531,7 +7405,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (A0, A1, A2, A3, A4), void>& Bind<R (A0, A1, A2, A3, A4), void>::operator = (const Bind<R (A0, A1, A2, A3, A4), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -7542,8 +7415,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4), void>& Bind<R (A0, A1, A2, A3, A4), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -7579,8 +7451,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (*)(A0, A1, A2, A3, A4), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
@@ -7591,10 +7464,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4>
-	inline Bind<R (*)(A0, A1, A2, A3, A4), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -7616,13 +7490,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -7651,7 +7525,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4), void>::bind(R (*pointer)(A0, A1, A2, A3, A4))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(pointer);
 	}
 
 
@@ -7661,7 +7535,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -7674,8 +7548,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)> >(pointer, userdata);
 	}
 
 
@@ -7687,13 +7561,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -7707,7 +7581,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -7725,8 +7599,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7748,8 +7621,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7771,8 +7643,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -7794,9 +7665,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7818,9 +7688,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7837,9 +7706,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7857,9 +7725,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -7870,7 +7737,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -7879,7 +7745,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
 	}
 
 
@@ -8002,7 +7868,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (*)(A0, A1, A2, A3, A4), void>& Bind<R (*)(A0, A1, A2, A3, A4), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -8013,8 +7878,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4), void>& Bind<R (*)(A0, A1, A2, A3, A4), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -8050,8 +7914,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
@@ -8062,10 +7927,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -8087,13 +7953,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -8122,7 +7988,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(pointer);
 	}
 
 
@@ -8132,7 +7998,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -8145,8 +8011,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, U)> >(pointer, userdata);
 	}
 
 
@@ -8158,13 +8024,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -8178,7 +8044,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -8196,8 +8062,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8219,8 +8084,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8242,8 +8106,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8265,9 +8128,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8289,9 +8151,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8308,9 +8169,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8328,9 +8188,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8341,7 +8200,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -8350,7 +8208,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4)> >(); // unbind
 	}
 
 
@@ -8473,7 +8331,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -8484,8 +8341,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -8521,8 +8377,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (A0, A1, A2, A3, A4, A5), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
@@ -8533,10 +8390,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
-	inline Bind<R (A0, A1, A2, A3, A4, A5), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -8558,13 +8416,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -8593,7 +8451,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(pointer);
 	}
 
 
@@ -8603,7 +8461,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -8616,8 +8474,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)> >(pointer, userdata);
 	}
 
 
@@ -8629,13 +8487,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -8649,7 +8507,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -8667,8 +8525,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8690,8 +8547,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8713,8 +8569,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -8736,9 +8591,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8760,9 +8614,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8779,9 +8632,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8799,9 +8651,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -8812,7 +8663,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -8821,7 +8671,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
 	}
 
 
@@ -8945,7 +8795,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (A0, A1, A2, A3, A4, A5), void>& Bind<R (A0, A1, A2, A3, A4, A5), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -8956,8 +8805,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5), void>& Bind<R (A0, A1, A2, A3, A4, A5), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -8993,8 +8841,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
@@ -9005,10 +8854,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -9030,13 +8880,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -9065,7 +8915,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(pointer);
 	}
 
 
@@ -9075,7 +8925,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -9088,8 +8938,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)> >(pointer, userdata);
 	}
 
 
@@ -9101,13 +8951,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -9121,7 +8971,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -9139,8 +8989,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9162,8 +9011,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9185,8 +9033,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9208,9 +9055,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9232,9 +9078,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9251,9 +9096,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9271,9 +9115,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9284,7 +9127,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -9293,7 +9135,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
 	}
 
 
@@ -9417,7 +9259,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -9428,8 +9269,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -9465,8 +9305,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
@@ -9477,10 +9318,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -9502,13 +9344,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -9537,7 +9379,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(pointer);
 	}
 
 
@@ -9547,7 +9389,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -9560,8 +9402,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, U)> >(pointer, userdata);
 	}
 
 
@@ -9573,13 +9415,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -9593,7 +9435,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -9611,8 +9453,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9634,8 +9475,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9657,8 +9497,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -9680,9 +9519,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9704,9 +9542,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9723,9 +9560,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9743,9 +9579,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -9756,7 +9591,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -9765,7 +9599,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5)> >(); // unbind
 	}
 
 
@@ -9889,7 +9723,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -9900,8 +9733,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -9937,8 +9769,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
@@ -9949,10 +9782,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -9974,13 +9808,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -10009,7 +9843,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(pointer);
 	}
 
 
@@ -10019,7 +9853,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -10032,8 +9866,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)> >(pointer, userdata);
 	}
 
 
@@ -10045,13 +9879,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -10065,7 +9899,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -10083,8 +9917,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10106,8 +9939,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10129,8 +9961,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10152,9 +9983,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10176,9 +10006,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10195,9 +10024,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10215,9 +10043,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10228,7 +10055,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -10237,7 +10063,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
 	}
 
 
@@ -10361,7 +10187,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -10372,8 +10197,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -10409,8 +10233,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
@@ -10421,10 +10246,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -10446,13 +10272,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -10481,7 +10307,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(pointer);
 	}
 
 
@@ -10491,7 +10317,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -10504,8 +10330,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)> >(pointer, userdata);
 	}
 
 
@@ -10517,13 +10343,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -10537,7 +10363,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -10555,8 +10381,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10578,8 +10403,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10601,8 +10425,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -10624,9 +10447,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10648,9 +10470,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10667,9 +10488,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10687,9 +10507,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -10700,7 +10519,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -10709,7 +10527,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
 	}
 
 
@@ -10833,7 +10651,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -10844,8 +10661,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -10881,8 +10697,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
@@ -10893,10 +10710,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -10918,13 +10736,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -10953,7 +10771,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(pointer);
 	}
 
 
@@ -10963,7 +10781,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -10976,8 +10794,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, U)> >(pointer, userdata);
 	}
 
 
@@ -10989,13 +10807,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -11009,7 +10827,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -11027,8 +10845,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11050,8 +10867,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11073,8 +10889,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11096,9 +10911,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11120,9 +10934,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11139,9 +10952,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11159,9 +10971,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11172,7 +10983,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -11181,7 +10991,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6)> >(); // unbind
 	}
 
 
@@ -11305,7 +11115,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -11316,8 +11125,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -11353,8 +11161,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
@@ -11365,10 +11174,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -11390,13 +11200,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -11425,7 +11235,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(pointer);
 	}
 
 
@@ -11435,7 +11245,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -11448,8 +11258,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)> >(pointer, userdata);
 	}
 
 
@@ -11461,13 +11271,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -11481,7 +11291,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -11499,8 +11309,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11522,8 +11331,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11545,8 +11353,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11568,9 +11375,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11592,9 +11398,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11611,9 +11416,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11631,9 +11435,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -11644,7 +11447,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -11653,7 +11455,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
 	}
 
 
@@ -11778,7 +11580,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -11789,8 +11590,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -11826,8 +11626,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
@@ -11838,10 +11639,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -11863,13 +11665,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -11898,7 +11700,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(pointer);
 	}
 
 
@@ -11908,7 +11710,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -11921,8 +11723,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)> >(pointer, userdata);
 	}
 
 
@@ -11934,13 +11736,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -11954,7 +11756,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -11972,8 +11774,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -11995,8 +11796,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12018,8 +11818,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12041,9 +11840,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12065,9 +11863,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12084,9 +11881,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12104,9 +11900,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12117,7 +11912,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -12126,7 +11920,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
 	}
 
 
@@ -12251,7 +12045,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -12262,8 +12055,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -12299,8 +12091,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
@@ -12311,10 +12104,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -12336,13 +12130,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -12371,7 +12165,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(pointer);
 	}
 
 
@@ -12381,7 +12175,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -12394,8 +12188,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, U)> >(pointer, userdata);
 	}
 
 
@@ -12407,13 +12201,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -12427,7 +12221,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -12445,8 +12239,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12468,8 +12261,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12491,8 +12283,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12514,9 +12305,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12538,9 +12328,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12557,9 +12346,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12577,9 +12365,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -12590,7 +12377,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -12599,7 +12385,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7)> >(); // unbind
 	}
 
 
@@ -12724,7 +12510,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -12735,8 +12520,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -12772,8 +12556,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
@@ -12784,10 +12569,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -12809,13 +12595,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -12844,7 +12630,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(pointer);
 	}
 
 
@@ -12854,7 +12640,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -12867,8 +12653,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(pointer, userdata);
 	}
 
 
@@ -12880,13 +12666,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -12900,7 +12686,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -12918,8 +12704,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12941,8 +12726,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12964,8 +12748,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -12987,9 +12770,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13011,9 +12793,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13030,9 +12811,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13050,9 +12830,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13063,7 +12842,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -13072,7 +12850,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
 	}
 
 
@@ -13197,7 +12975,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -13208,8 +12985,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -13245,8 +13021,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
@@ -13257,10 +13034,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -13282,13 +13060,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -13317,7 +13095,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(pointer);
 	}
 
 
@@ -13327,7 +13105,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -13340,8 +13118,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(pointer, userdata);
 	}
 
 
@@ -13353,13 +13131,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -13373,7 +13151,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -13391,8 +13169,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13414,8 +13191,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13437,8 +13213,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13460,9 +13235,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13484,9 +13258,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13503,9 +13276,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13523,9 +13295,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13536,7 +13307,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -13545,7 +13315,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
 	}
 
 
@@ -13670,7 +13440,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -13681,8 +13450,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -13718,8 +13486,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
@@ -13730,10 +13499,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -13755,13 +13525,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -13790,7 +13560,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(pointer);
 	}
 
 
@@ -13800,7 +13570,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -13813,8 +13583,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(pointer, userdata);
 	}
 
 
@@ -13826,13 +13596,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -13846,7 +13616,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -13864,8 +13634,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13887,8 +13656,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13910,8 +13678,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -13933,9 +13700,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13957,9 +13723,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13976,9 +13741,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -13996,9 +13760,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14009,7 +13772,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -14018,7 +13780,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(); // unbind
 	}
 
 
@@ -14143,7 +13905,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -14154,8 +13915,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -14191,8 +13951,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
@@ -14203,10 +13964,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -14228,13 +13990,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -14263,7 +14025,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(pointer);
 	}
 
 
@@ -14273,7 +14035,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -14286,8 +14048,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(pointer, userdata);
 	}
 
 
@@ -14299,13 +14061,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -14319,7 +14081,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -14337,8 +14099,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14360,8 +14121,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14383,8 +14143,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14406,9 +14165,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14430,9 +14188,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14449,9 +14206,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14469,9 +14225,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14482,7 +14237,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -14491,7 +14245,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
 	}
 
 
@@ -14617,7 +14371,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -14628,8 +14381,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -14665,8 +14417,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
@@ -14677,10 +14430,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -14702,13 +14456,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -14737,7 +14491,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(pointer);
 	}
 
 
@@ -14747,7 +14501,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -14760,8 +14514,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(pointer, userdata);
 	}
 
 
@@ -14773,13 +14527,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -14793,7 +14547,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -14811,8 +14565,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14834,8 +14587,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14857,8 +14609,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -14880,9 +14631,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14904,9 +14654,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14923,9 +14672,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14943,9 +14691,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -14956,7 +14703,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -14965,7 +14711,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
 	}
 
 
@@ -15091,7 +14837,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -15102,8 +14847,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -15139,8 +14883,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
@@ -15151,10 +14896,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -15176,13 +14922,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -15211,7 +14957,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(pointer);
 	}
 
 
@@ -15221,7 +14967,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -15234,8 +14980,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(pointer, userdata);
 	}
 
 
@@ -15247,13 +14993,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -15267,7 +15013,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -15285,8 +15031,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15308,8 +15053,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15331,8 +15075,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15354,9 +15097,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15378,9 +15120,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15397,9 +15138,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15417,9 +15157,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15430,7 +15169,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -15439,7 +15177,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(); // unbind
 	}
 
 
@@ -15565,7 +15303,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -15576,8 +15313,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -15613,8 +15349,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
@@ -15625,10 +15362,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -15650,13 +15388,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -15685,7 +15423,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(pointer);
 	}
 
 
@@ -15695,7 +15433,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -15708,8 +15446,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(pointer, userdata);
 	}
 
 
@@ -15721,13 +15459,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -15741,7 +15479,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -15759,8 +15497,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15782,8 +15519,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15805,8 +15541,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -15828,9 +15563,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15852,9 +15586,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15871,9 +15604,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15891,9 +15623,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -15904,7 +15635,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -15913,7 +15643,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
 	}
 
 
@@ -16039,7 +15769,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -16050,8 +15779,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -16087,8 +15815,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
@@ -16099,10 +15828,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -16124,13 +15854,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -16159,7 +15889,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(pointer);
 	}
 
 
@@ -16169,7 +15899,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -16182,8 +15912,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(pointer, userdata);
 	}
 
 
@@ -16195,13 +15925,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -16215,7 +15945,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -16233,8 +15963,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16256,8 +15985,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16279,8 +16007,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16302,9 +16029,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16326,9 +16052,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16345,9 +16070,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16365,9 +16089,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16378,7 +16101,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -16387,7 +16109,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
 	}
 
 
@@ -16513,7 +16235,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -16524,8 +16245,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -16561,8 +16281,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
@@ -16573,10 +16294,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -16598,13 +16320,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -16633,7 +16355,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(pointer);
 	}
 
 
@@ -16643,7 +16365,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -16656,8 +16378,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(pointer, userdata);
 	}
 
 
@@ -16669,13 +16391,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -16689,7 +16411,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -16707,8 +16429,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16730,8 +16451,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16753,8 +16473,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -16776,9 +16495,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16800,9 +16518,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16819,9 +16536,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16839,9 +16555,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -16852,7 +16567,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -16861,7 +16575,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(); // unbind
 	}
 
 
@@ -16987,7 +16701,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -16998,8 +16711,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -17035,8 +16747,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
@@ -17047,10 +16760,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -17072,13 +16786,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -17107,7 +16821,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(pointer);
 	}
 
 
@@ -17117,7 +16831,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -17130,8 +16844,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(pointer, userdata);
 	}
 
 
@@ -17143,13 +16857,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -17163,7 +16877,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -17181,8 +16895,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17204,8 +16917,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17227,8 +16939,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17250,9 +16961,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17274,9 +16984,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17293,9 +17002,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17313,9 +17021,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17326,7 +17033,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -17335,7 +17041,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
 	}
 
 
@@ -17462,7 +17168,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -17473,8 +17178,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -17510,8 +17214,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
@@ -17522,10 +17227,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -17547,13 +17253,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -17582,7 +17288,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(pointer);
 	}
 
 
@@ -17592,7 +17298,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -17605,8 +17311,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(pointer, userdata);
 	}
 
 
@@ -17618,13 +17324,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -17638,7 +17344,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -17656,8 +17362,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17679,8 +17384,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17702,8 +17406,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -17725,9 +17428,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17749,9 +17451,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17768,9 +17469,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17788,9 +17488,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -17801,7 +17500,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -17810,7 +17508,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
 	}
 
 
@@ -17937,7 +17635,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -17948,8 +17645,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -17985,8 +17681,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
@@ -17997,10 +17694,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -18022,13 +17720,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -18057,7 +17755,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(pointer);
 	}
 
 
@@ -18067,7 +17765,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -18080,8 +17778,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(pointer, userdata);
 	}
 
 
@@ -18093,13 +17791,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -18113,7 +17811,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -18131,8 +17829,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18154,8 +17851,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18177,8 +17873,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18200,9 +17895,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18224,9 +17918,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18243,9 +17936,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18263,9 +17955,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18276,7 +17967,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -18285,7 +17975,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(); // unbind
 	}
 
 
@@ -18412,7 +18102,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -18423,8 +18112,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -18460,8 +18148,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
@@ -18472,10 +18161,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -18497,13 +18187,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -18532,7 +18222,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(pointer);
 	}
 
 
@@ -18542,7 +18232,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -18555,8 +18245,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(pointer, userdata);
 	}
 
 
@@ -18568,13 +18258,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -18588,7 +18278,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -18606,8 +18296,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18629,8 +18318,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18652,8 +18340,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -18675,9 +18362,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18699,9 +18385,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18718,9 +18403,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18738,9 +18422,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -18751,7 +18434,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -18760,7 +18442,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
 	}
 
 
@@ -18887,7 +18569,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -18898,8 +18579,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -18935,8 +18615,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
@@ -18947,10 +18628,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -18972,13 +18654,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -19007,7 +18689,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(pointer);
 	}
 
 
@@ -19017,7 +18699,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -19030,8 +18712,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(pointer, userdata);
 	}
 
 
@@ -19043,13 +18725,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -19063,7 +18745,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -19081,8 +18763,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19104,8 +18785,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19127,8 +18807,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19150,9 +18829,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19174,9 +18852,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19193,9 +18870,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19213,9 +18889,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19226,7 +18901,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -19235,7 +18909,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
 	}
 
 
@@ -19362,7 +19036,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -19373,8 +19046,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -19410,8 +19082,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
@@ -19422,10 +19095,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -19447,13 +19121,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -19482,7 +19156,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(pointer);
 	}
 
 
@@ -19492,7 +19166,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -19505,8 +19179,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(pointer, userdata);
 	}
 
 
@@ -19518,13 +19192,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -19538,7 +19212,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -19556,8 +19230,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19579,8 +19252,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19602,8 +19274,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -19625,9 +19296,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19649,9 +19319,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19668,9 +19337,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19688,9 +19356,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -19701,7 +19368,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -19710,7 +19376,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(); // unbind
 	}
 
 
@@ -19837,7 +19503,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -19848,8 +19513,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -19885,8 +19549,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
@@ -19897,10 +19562,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -19922,13 +19588,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -19957,7 +19623,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(pointer);
 	}
 
 
@@ -19967,7 +19633,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -19980,8 +19646,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(pointer, userdata);
 	}
 
 
@@ -19993,13 +19659,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -20013,7 +19679,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -20031,8 +19697,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20054,8 +19719,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20077,8 +19741,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20100,9 +19763,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20124,9 +19786,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20143,9 +19804,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20163,9 +19823,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20176,7 +19835,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -20185,7 +19843,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
 	}
 
 
@@ -20313,7 +19971,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -20324,8 +19981,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -20361,8 +20017,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
@@ -20373,10 +20030,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -20398,13 +20056,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -20433,7 +20091,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(pointer);
 	}
 
 
@@ -20443,7 +20101,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -20456,8 +20114,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(pointer, userdata);
 	}
 
 
@@ -20469,13 +20127,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -20489,7 +20147,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -20507,8 +20165,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20530,8 +20187,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20553,8 +20209,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -20576,9 +20231,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20600,9 +20254,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20619,9 +20272,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20639,9 +20291,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -20652,7 +20303,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -20661,7 +20311,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
 	}
 
 
@@ -20789,7 +20439,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -20800,8 +20449,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -20837,8 +20485,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
@@ -20849,10 +20498,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -20874,13 +20524,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -20909,7 +20559,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(pointer);
 	}
 
 
@@ -20919,7 +20569,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -20932,8 +20582,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(pointer, userdata);
 	}
 
 
@@ -20945,13 +20595,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -20965,7 +20615,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -20983,8 +20633,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21006,8 +20655,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21029,8 +20677,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21052,9 +20699,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21076,9 +20722,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21095,9 +20740,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21115,9 +20759,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21128,7 +20771,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -21137,7 +20779,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(); // unbind
 	}
 
 
@@ -21265,7 +20907,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -21276,8 +20917,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -21313,8 +20953,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
@@ -21325,10 +20966,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -21350,13 +20992,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -21385,7 +21027,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(pointer);
 	}
 
 
@@ -21395,7 +21037,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -21408,8 +21050,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(pointer, userdata);
 	}
 
 
@@ -21421,13 +21063,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -21441,7 +21083,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -21459,8 +21101,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21482,8 +21123,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21505,8 +21145,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21528,9 +21167,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21552,9 +21190,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21571,9 +21208,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21591,9 +21227,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -21604,7 +21239,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -21613,7 +21247,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
 	}
 
 
@@ -21741,7 +21375,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -21752,8 +21385,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -21789,8 +21421,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
@@ -21801,10 +21434,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -21826,13 +21460,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -21861,7 +21495,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(pointer);
 	}
 
 
@@ -21871,7 +21505,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -21884,8 +21518,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(pointer, userdata);
 	}
 
 
@@ -21897,13 +21531,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -21917,7 +21551,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -21935,8 +21569,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21958,8 +21591,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -21981,8 +21613,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22004,9 +21635,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22028,9 +21658,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22047,9 +21676,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22067,9 +21695,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22080,7 +21707,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -22089,7 +21715,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
 	}
 
 
@@ -22217,7 +21843,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -22228,8 +21853,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -22265,8 +21889,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
@@ -22277,10 +21902,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -22302,13 +21928,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -22337,7 +21963,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(pointer);
 	}
 
 
@@ -22347,7 +21973,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -22360,8 +21986,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(pointer, userdata);
 	}
 
 
@@ -22373,13 +21999,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -22393,7 +22019,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -22411,8 +22037,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22434,8 +22059,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22457,8 +22081,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22480,9 +22103,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22504,9 +22126,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22523,9 +22144,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22543,9 +22163,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22556,7 +22175,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -22565,7 +22183,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(); // unbind
 	}
 
 
@@ -22693,7 +22311,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -22704,8 +22321,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -22741,8 +22357,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
@@ -22753,10 +22370,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
-	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind(Bind&& rhs)
+	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -22778,13 +22396,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -22813,7 +22431,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(pointer);
 	}
 
 
@@ -22823,7 +22441,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -22836,8 +22454,8 @@ namespace Yuni
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U),
 		typename Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(pointer, userdata);
 	}
 
 
@@ -22849,13 +22467,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -22869,7 +22487,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -22887,8 +22505,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22910,8 +22527,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22933,8 +22549,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -22956,9 +22571,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22980,9 +22594,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -22999,9 +22612,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23019,9 +22631,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23032,7 +22643,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -23041,7 +22651,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
 	}
 
 
@@ -23170,7 +22780,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::operator = (const Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -23181,8 +22790,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& Bind<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -23218,8 +22826,9 @@ namespace Yuni
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
+	}
 
 	// Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
@@ -23230,10 +22839,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
-	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind(Bind&& rhs)
+	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -23255,13 +22865,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -23290,7 +22900,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(pointer);
 	}
 
 
@@ -23300,7 +22910,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -23313,8 +22923,8 @@ namespace Yuni
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U),
 		typename Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(pointer, userdata);
 	}
 
 
@@ -23326,13 +22936,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -23346,7 +22956,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -23364,8 +22974,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23387,8 +22996,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23410,8 +23018,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23433,9 +23040,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23457,9 +23063,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23476,9 +23081,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23496,9 +23100,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23509,7 +23112,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::bind(const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -23518,7 +23120,7 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
 	}
 
 
@@ -23647,7 +23249,6 @@ namespace Yuni
 	template<class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::operator = (const Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -23658,8 +23259,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>& Bind<R (*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), void>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -23695,8 +23295,9 @@ namespace Yuni
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::Bind()
-		: pHolder(new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
+	}
 
 	// Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
@@ -23707,10 +23308,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
-	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::Bind(Bind&& rhs)
+	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -23732,13 +23334,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -23767,7 +23369,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(pointer);
 	}
 
 
@@ -23777,7 +23379,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -23790,8 +23392,8 @@ namespace Yuni
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::bind(R (*pointer)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U),
 		typename Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(pointer, userdata);
 	}
 
 
@@ -23803,13 +23405,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -23823,7 +23425,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -23841,8 +23443,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23864,8 +23465,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23887,8 +23487,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -23910,9 +23509,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23934,9 +23532,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23953,9 +23550,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23973,9 +23569,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15, U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -23986,7 +23581,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::bind(const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -23995,7 +23589,7 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline void Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(); // unbind
 	}
 
 
@@ -24124,7 +23718,6 @@ namespace Yuni
 	template<class ClassT, class R, class A0, class A1, class A2, class A3, class A4, class A5, class A6, class A7, class A8, class A9, class A10, class A11, class A12, class A13, class A14, class A15>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::operator = (const Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -24135,8 +23728,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>& Bind<R (ClassT::*)(A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15), ClassT>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14, A15)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -66,8 +66,9 @@ namespace Yuni
 	// Constructor
 	template<<%=tmpl[0]%>>
 	inline Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::Bind()
-		: pHolder(new Private::BindImpl::None<R (<%=generator.list(i)%>)>()) // unbind
-	{}
+	{
+		pHolder.template emplace<Private::BindImpl::None<R (<%=generator.list(i)%>)> >(); // unbind
+	}
 
 	// Constructor
 	template<<%=tmpl[0]%>>
@@ -78,10 +79,11 @@ namespace Yuni
 	# ifdef YUNI_HAS_CPP_MOVE
 	// Move Constructor
 	template<<%=tmpl[0]%>>
-	inline Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::Bind(Bind&& rhs)
+	inline Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::Bind(Bind&& rhs) :
+		pHolder(std::move(rhs.pHolder))
 	{
 		// \important VS may call the other constructor `C&&`...
-		pHolder.swap(rhs.pHolder);
+		rhs.unbind();
 	}
 	# endif
 
@@ -103,13 +105,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (<%=generator.list(i)%>)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (<%=generator.list(i)%>)> >(std::forward<C>(functor));
 	}
 
 	# else
@@ -138,7 +140,7 @@ namespace Yuni
 	template<<%=tmpl[0]%>>
 	inline void Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::bind(R (*pointer)(<%=generator.list(i)%>))
 	{
-		pHolder = new Private::BindImpl::BoundWithFunction<R (<%=generator.list(i)%>)>(pointer);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (<%=generator.list(i)%>)> >(pointer);
 	}
 
 
@@ -148,7 +150,7 @@ namespace Yuni
 	{
 		if (symbol.valid())
 		{
-			pHolder = new Private::BindImpl::BoundWithFunction<R (<%=generator.list(i)%>)>(
+			pHolder.template emplace<Private::BindImpl::BoundWithFunction<R (<%=generator.list(i)%>)> >(
 				reinterpret_cast<FunctionType>(symbol.ptr()));
 		}
 		else
@@ -161,8 +163,8 @@ namespace Yuni
 	inline void Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::bind(R (*pointer)(<%=generator.list(i, "A", "", ", ")%>U),
 		typename Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::template WithUserData<U>::ParameterType userdata)
 	{
-		pHolder = new Private::BindImpl::BoundWithFunctionAndUserData
-			<typename WithUserData<U>::ParameterType, R (<%=generator.list(i, "A", "", ", ")%>U)>(pointer, userdata);
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctionAndUserData
+			<typename WithUserData<U>::ParameterType, R (<%=generator.list(i, "A", "", ", ")%>U)> >(pointer, userdata);
 	}
 
 
@@ -174,13 +176,13 @@ namespace Yuni
 	{
 		// When moving a bind (instead of copying it), it seems that Visual Studio might call
 		// this constructor instead of `Bind&&` (works as expected with gcc and clang)
-		if (Static::Type::Equal<C, BindType>::Yes) // moving Bind&& -> Bind&&
+		if (Static::Type::Equal<C, BindType>::Yes) // copying or moving another bind
 		{
-			// instanciating the swap method only when the type requires it
-			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::SwapBind(pHolder, functor);
+			// instanciating the assignment only when the type requires it
+			Yuni::Private::BindImpl::MoveConstructor<Static::Type::Equal<C, BindType>::Yes>::AssignBind(pHolder, std::forward<C>(functor));
 		}
 		else
-			pHolder = new Private::BindImpl::BoundWithFunctor<C, R (<%=generator.list(i)%>)>(std::forward<C>(functor));
+			pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (<%=generator.list(i)%>)> >(std::forward<C>(functor));
 	}
 	# endif
 
@@ -194,7 +196,7 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(<%=generator.list(i)%>)>(c, member);
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(<%=generator.list(i)%>)> >(c, member);
 		}
 		else
 			// The object is null, we should unbind
@@ -212,8 +214,7 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(<%=generator.list(i)%>);
-			pHolder = new Private::BindImpl::BoundWithMember<C, R(<%=generator.list(i)%>)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithMember<C, R(<%=generator.list(i)%>)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -235,8 +236,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(<%=generator.list(i)%>);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(<%=generator.list(i)%>)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(<%=generator.list(i)%>)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -258,8 +258,7 @@ namespace Yuni
 			// Assigning a new bind
 			typedef R (C::*MemberType)(<%=generator.list(i)%>);
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(<%=generator.list(i)%>)>
-				(c, reinterpret_cast<MemberType>(member));
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMember<PtrT, R(<%=generator.list(i)%>)> >(c, reinterpret_cast<MemberType>(member));
 		}
 		else
 			// The object is null, we should unbind
@@ -281,9 +280,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(<%=generator.list(i,"A","",", ")%>U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(<%=generator.list(i,"A","",", ")%>U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -305,9 +303,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef SmartPtr<C, OwspP,ChckP,ConvP,StorP,ConsP> PtrT;
-			pHolder = new Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
-				typename WithUserData<U>::ParameterType, PtrT, R(<%=generator.list(i,"A","",", ")%>U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithSmartPtrMemberAndUserData<
+				typename WithUserData<U>::ParameterType, PtrT, R(<%=generator.list(i,"A","",", ")%>U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -324,9 +321,8 @@ namespace Yuni
 		{
 			// The object is not null, go ahead
 			// Assigning a new bind
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(<%=generator.list(i,"A","",", ")%>U)>
-				(c, member, userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(<%=generator.list(i,"A","",", ")%>U)> >(c, member, userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -344,9 +340,8 @@ namespace Yuni
 			// The object is not null, go ahead
 			// Assigning a new bind
 			typedef R (C::*MemberType)(<%=generator.list(i,"A","",", ")%>U);
-			pHolder = new Private::BindImpl::BoundWithMemberAndUserData<
-				typename WithUserData<U>::ParameterType,C, R(<%=generator.list(i,"A","",", ")%>U)>
-				(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
+			pHolder.template emplace<Private::BindImpl::BoundWithMemberAndUserData<
+				typename WithUserData<U>::ParameterType,C, R(<%=generator.list(i,"A","",", ")%>U)> >(const_cast<C*>(c), reinterpret_cast<MemberType>(member), userdata);
 		}
 		else
 			// The object is null, we should unbind
@@ -357,7 +352,6 @@ namespace Yuni
 	template<<%=tmpl[0]%>>
 	inline void Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::bind(const Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 	}
 
@@ -366,7 +360,7 @@ namespace Yuni
 	template<<%=tmpl[0]%>>
 	inline void Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::unbind()
 	{
-		pHolder = new Private::BindImpl::None<R (<%=generator.list(i)%>)>(); // unbind
+		pHolder.template emplace<Private::BindImpl::None<R (<%=generator.list(i)%>)> >(); // unbind
 	}
 
 
@@ -499,7 +493,6 @@ namespace Yuni
 	template<<%=tmpl[0]%>>
 	inline Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>& Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::operator = (const Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>& rhs)
 	{
-		// Inc the reference count
 		pHolder = rhs.pHolder;
 		return *this;
 	}
@@ -510,8 +503,7 @@ namespace Yuni
 	template<class C>
 	inline Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>& Bind<<%=tmpl[1]%>, <%=tmpl[2]%>>::operator = (C&& functor)
 	{
-		// Inc the reference count
-		pHolder = new Private::BindImpl::BoundWithFunctor<C, R (<%=generator.list(i)%>)>(std::forward<C>(functor));
+		pHolder.template emplace<Private::BindImpl::BoundWithFunctor<typename std::decay<C>::type, R (<%=generator.list(i)%>)> >(std::forward<C>(functor));
 		return *this;
 	}
 	# endif
@@ -38,6 +38,8 @@
 ** made available.
 */
 #pragma once
+#include <type_traits>
+#include <utility>
 
 
 
@@ -50,16 +52,25 @@ namespace BindImpl
 
 	template<bool> struct MoveConstructor final
 	{
-		template<class A, class B> static void SwapBind(A& self, B& rhs)
+		template<class A, class B> static void AssignBind(A& self, B&& rhs)
 		{
-			// instanciating the swap method only when the type requires it
-			self.swap(rhs.pHolder);
+			// instanciating the assignment only when the type requires it
+			if (std::is_lvalue_reference<B>::value)
+			{
+				// the bind must be copied, not stolen
+				self = rhs.pHolder;
+			}
+			else
+			{
+				self = std::move(rhs.pHolder);
+				rhs.unbind();
+			}
 		}
 	};
 
 	template<> struct MoveConstructor<false> final
 	{
-		template<class A, class B> static void SwapBind(A&, B&)
+		template<class A, class B> static void AssignBind(A&, B&&)
 		{
 			// empty on purpose
 		}
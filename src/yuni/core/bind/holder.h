@@ -0,0 +1,138 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include <atomic>
+#include <type_traits>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace BindImpl
+{
+
+	/*!
+	** \brief Storage for the implementation of a bind (small buffer optimization)
+	**
+	** Small implementations (a vtable + 3 pointers, which is enough for a pointer-to-function,
+	** a pointer-to-member or a lambda with a few captures) are stored inline, larger ones are
+	** allocated on the heap. In both cases, an implementation is copied along with the bind.
+	** Only a non-copyable implementation (e.g. a lambda capturing a std::unique_ptr) is shared
+	** between the copies, with a reference counter.
+	**
+	** \tparam I The interface of all implementations (IPointer<>)
+	*/
+	template<class I>
+	class Holder final
+	{
+	public:
+		//! Size of the inline storage
+		static constexpr uint inlineSize = 4 * sizeof(void*);
+
+		//! Get if an implementation can be stored inline
+		template<class T> struct Inline final
+		{
+			static constexpr bool value = sizeof(T) <= inlineSize
+				and alignof(T) <= alignof(void*)
+				and std::is_copy_constructible<T>::value
+				and std::is_nothrow_move_constructible<T>::value;
+		};
+
+	public:
+		//! \name Constructors & Destructor
+		//@{
+		//! Default constructor (no implementation, emplace() must be called)
+		Holder();
+		//! Copy constructor
+		Holder(const Holder& rhs);
+		//! Move constructor
+		Holder(Holder&& rhs);
+		//! Destructor
+		~Holder();
+		//@}
+
+		//! \name Implementation
+		//@{
+		//! Replace the implementation by a new one
+		template<class T, class... Args> void emplace(Args&&... args);
+		//! Swap the implementations
+		void swap(Holder& rhs);
+		//@}
+
+		//! \name Operators
+		//@{
+		//! The implementation
+		I* operator -> () const;
+		//! Copy
+		Holder& operator = (const Holder& rhs);
+		//! Move
+		Holder& operator = (Holder&& rhs);
+		//@}
+
+
+	private:
+		//! Operations on the implementation
+		enum class Operation { copy, move, destroy };
+		//! Type of the function managing an implementation (`dst` is the holder for copy / move)
+		typedef void (*Manager)(Operation, Holder& self, Holder* dst);
+
+		//! Implementation allocated on the heap (shared only when not copyable)
+		template<class T> struct Shared final
+		{
+			template<class... Args> explicit Shared(Args&&... args) :
+				references(1), impl(std::forward<Args>(args)...)
+			{}
+			std::atomic<uint> references;
+			T impl;
+		};
+
+		//! Manager for inline implementations
+		template<class T> static void ManageInline(Operation, Holder& self, Holder* dst);
+		//! Manager for shared implementations
+		template<class T> static void ManageShared(Operation, Holder& self, Holder* dst);
+		//! Copy an implementation allocated on the heap
+		template<class T> static Shared<T>* CopyShared(Shared<T>* shared, std::true_type /*copyable*/);
+		//! Share a non-copyable implementation allocated on the heap
+		template<class T> static Shared<T>* CopyShared(Shared<T>* shared, std::false_type /*copyable*/);
+
+		//! Create a new implementation inline
+		template<class T, class... Args> void construct(std::true_type, Args&&... args);
+		//! Create a new shared implementation
+		template<class T, class... Args> void construct(std::false_type, Args&&... args);
+		//! Destroy the current implementation, if any
+		void release();
+		//! Copy the implementation of another holder (which must be empty)
+		void copyFrom(const Holder& rhs);
+		//! Take the implementation of another holder (which must be empty)
+		void moveFrom(Holder& rhs);
+
+	private:
+		//! Inline storage (the implementation or a pointer to the shared one)
+		typename std::aligned_storage<inlineSize, alignof(void*)>::type pStorage;
+		//! The implementation
+		I* pImpl;
+		//! The manager for the current implementation
+		Manager pManager;
+
+	}; // class Holder
+
+
+
+
+
+} // namespace BindImpl
+} // namespace Private
+} // namespace Yuni
+
+#include "holder.hxx"
@@ -0,0 +1,253 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "holder.h"
+#include <new>
+#include <utility>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace BindImpl
+{
+
+	template<class I>
+	template<class T>
+	void Holder<I>::ManageInline(Operation operation, Holder& self, Holder* dst)
+	{
+		T* impl = static_cast<T*>(self.pImpl);
+		switch (operation)
+		{
+			case Operation::copy:
+			{
+				dst->pImpl = new (&dst->pStorage) T(*impl);
+				dst->pManager = self.pManager;
+				break;
+			}
+			case Operation::move:
+			{
+				dst->pImpl = new (&dst->pStorage) T(std::move(*impl));
+				dst->pManager = self.pManager;
+				impl->~T();
+				self.pImpl = nullptr;
+				self.pManager = nullptr;
+				break;
+			}
+			case Operation::destroy:
+			{
+				impl->~T();
+				break;
+			}
+		}
+	}
+
+
+	template<class I>
+	template<class T>
+	void Holder<I>::ManageShared(Operation operation, Holder& self, Holder* dst)
+	{
+		Shared<T>* shared = *reinterpret_cast<Shared<T>**>(&self.pStorage);
+		switch (operation)
+		{
+			case Operation::copy:
+			{
+				Shared<T>* copy = CopyShared(shared, std::integral_constant<bool, std::is_copy_constructible<T>::value>());
+				*reinterpret_cast<Shared<T>**>(&dst->pStorage) = copy;
+				dst->pImpl = &(copy->impl);
+				dst->pManager = self.pManager;
+				break;
+			}
+			case Operation::move:
+			{
+				*reinterpret_cast<Shared<T>**>(&dst->pStorage) = shared;
+				dst->pImpl = self.pImpl;
+				dst->pManager = self.pManager;
+				self.pImpl = nullptr;
+				self.pManager = nullptr;
+				break;
+			}
+			case Operation::destroy:
+			{
+				if (shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					delete shared;
+				break;
+			}
+		}
+	}
+
+
+
+
+	template<class I>
+	template<class T>
+	inline typename Holder<I>::template Shared<T>* Holder<I>::CopyShared(Shared<T>* shared, std::true_type)
+	{
+		// same semantics than the inline implementations
+		return new Shared<T>(static_cast<const T&>(shared->impl));
+	}
+
+
+	template<class I>
+	template<class T>
+	inline typename Holder<I>::template Shared<T>* Holder<I>::CopyShared(Shared<T>* shared, std::false_type)
+	{
+		shared->references.fetch_add(1, std::memory_order_relaxed);
+		return shared;
+	}
+
+
+
+
+	template<class I>
+	inline Holder<I>::Holder() :
+		pImpl(nullptr),
+		pManager(nullptr)
+	{}
+
+
+	template<class I>
+	inline Holder<I>::Holder(const Holder& rhs) :
+		pImpl(nullptr),
+		pManager(nullptr)
+	{
+		copyFrom(rhs);
+	}
+
+
+	template<class I>
+	inline Holder<I>::Holder(Holder&& rhs) :
+		pImpl(nullptr),
+		pManager(nullptr)
+	{
+		moveFrom(rhs);
+	}
+
+
+	template<class I>
+	inline Holder<I>::~Holder()
+	{
+		release();
+	}
+
+
+	template<class I>
+	inline void Holder<I>::release()
+	{
+		if (pManager)
+		{
+			pManager(Operation::destroy, *this, nullptr);
+			pImpl = nullptr;
+			pManager = nullptr;
+		}
+	}
+
+
+	template<class I>
+	inline void Holder<I>::copyFrom(const Holder& rhs)
+	{
+		if (rhs.pManager)
+			rhs.pManager(Operation::copy, const_cast<Holder&>(rhs), this);
+	}
+
+
+	template<class I>
+	inline void Holder<I>::moveFrom(Holder& rhs)
+	{
+		if (rhs.pManager)
+			rhs.pManager(Operation::move, rhs, this);
+	}
+
+
+	template<class I>
+	template<class T, class... Args>
+	void Holder<I>::construct(std::true_type /*inline*/, Args&&... args)
+	{
+		// the arguments may belong to the current implementation
+		Holder tmp;
+		tmp.pImpl = new (&tmp.pStorage) T(std::forward<Args>(args)...);
+		tmp.pManager = &ManageInline<T>;
+		release();
+		moveFrom(tmp);
+	}
+
+
+	template<class I>
+	template<class T, class... Args>
+	void Holder<I>::construct(std::false_type /*inline*/, Args&&... args)
+	{
+		Shared<T>* shared = new Shared<T>(std::forward<Args>(args)...);
+		release();
+		*reinterpret_cast<Shared<T>**>(&pStorage) = shared;
+		pImpl = &(shared->impl);
+		pManager = &ManageShared<T>;
+	}
+
+
+	template<class I>
+	template<class T, class... Args>
+	inline void Holder<I>::emplace(Args&&... args)
+	{
+		construct<T>(std::integral_constant<bool, Inline<T>::value>(), std::forward<Args>(args)...);
+	}
+
+
+	template<class I>
+	inline void Holder<I>::swap(Holder& rhs)
+	{
+		if (this != &rhs)
+		{
+			Holder tmp(std::move(rhs));
+			rhs.moveFrom(*this);
+			moveFrom(tmp);
+		}
+	}
+
+
+	template<class I>
+	inline I* Holder<I>::operator -> () const
+	{
+		return pImpl;
+	}
+
+
+	template<class I>
+	inline Holder<I>& Holder<I>::operator = (const Holder& rhs)
+	{
+		if (this != &rhs)
+		{
+			release();
+			copyFrom(rhs);
+		}
+		return *this;
+	}
+
+
+	template<class I>
+	inline Holder<I>& Holder<I>::operator = (Holder&& rhs)
+	{
+		if (this != &rhs)
+		{
+			release();
+			moveFrom(rhs);
+		}
+		return *this;
+	}
+
+
+
+
+
+} // namespace BindImpl
+} // namespace Private
+} // namespace Yuni
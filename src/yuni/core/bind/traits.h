@@ -2912,10 +2912,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke() const override
 		{
 			return pFunctor();
@@ -2953,8 +2960,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R ()>
 
@@ -2967,10 +2974,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0) const override
 		{
 			return pFunctor(a0);
@@ -3008,8 +3022,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0)>
 
@@ -3022,10 +3036,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1) const override
 		{
 			return pFunctor(a0, a1);
@@ -3063,8 +3084,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1)>
 
@@ -3077,10 +3098,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2) const override
 		{
 			return pFunctor(a0, a1, a2);
@@ -3118,8 +3146,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2)>
 
@@ -3132,10 +3160,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3) const override
 		{
 			return pFunctor(a0, a1, a2, a3);
@@ -3173,8 +3208,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3)>
 
@@ -3187,10 +3222,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4);
@@ -3228,8 +3270,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4)>
 
@@ -3242,10 +3284,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5);
@@ -3283,8 +3332,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5)>
 
@@ -3297,10 +3346,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6);
@@ -3338,8 +3394,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6)>
 
@@ -3352,10 +3408,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7);
@@ -3393,8 +3456,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7)>
 
@@ -3407,10 +3470,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8);
@@ -3448,8 +3518,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8)>
 
@@ -3462,10 +3532,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
@@ -3503,8 +3580,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9)>
 
@@ -3517,10 +3594,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
@@ -3558,8 +3642,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10)>
 
@@ -3572,10 +3656,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
@@ -3613,8 +3704,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11)>
 
@@ -3627,10 +3718,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
@@ -3668,8 +3766,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12)>
 
@@ -3682,10 +3780,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
@@ -3723,8 +3828,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13)>
 
@@ -3737,10 +3842,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const override
 		{
 			return pFunctor(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
@@ -3778,8 +3890,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (A0, A1, A2, A3, A4, A5, A6, A7, A8, A9, A10, A11, A12, A13, A14)>
 
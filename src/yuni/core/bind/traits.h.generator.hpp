@@ -391,10 +391,17 @@ namespace BindImpl
 		//! Destructor
 		virtual ~BoundWithFunctor() {}
 
-		BoundWithFunctor(C&& functor) :
-			pFunctor(std::forward<C>(functor))
+		explicit BoundWithFunctor(const C& functor) :
+			pFunctor(functor)
 		{}
 
+		explicit BoundWithFunctor(C&& functor) :
+			pFunctor(std::move(functor))
+		{}
+
+		BoundWithFunctor(const BoundWithFunctor&) = default;
+		BoundWithFunctor(BoundWithFunctor&&) = default;
+
 		virtual R invoke(<%=generator.variableList(i)%>) const override
 		{
 			return pFunctor(<%=generator.list(i, 'a')%>);
@@ -432,8 +439,8 @@ namespace BindImpl
 
 
 	private:
-		//! Pointer-to-function
-		C pFunctor;
+		//! The functor (stored by copy)
+		mutable C pFunctor;
 
 	}; // class BoundWithFunctor<C, R (<%=generator.list(i)%>)>
 
@@ -11,6 +11,7 @@
 #pragma once
 #include "../yuni.h"
 #include "string.h"
+#include "hash/flat.h"
 #include <map>
 #include <set>
 #ifdef YUNI_HAS_STL_UNORDERED_MAP
@@ -45,6 +46,15 @@ namespace Yuni
 		typedef std::unordered_map<KeyT, ValueT> Unordered;
 		# endif
 
+		/*!
+		** \brief An unordered dictionary table, with open addressing (see Hash::Flat)
+		**
+		** Faster than `Hash` and with heterogeneous lookups (an `AnyString`
+		** can be used for searching `String` keys), but any insertion may
+		** invalidate the references to the items.
+		*/
+		typedef Yuni::Hash::Flat<KeyT, ValueT> Flat;
+
 		//! An ordered dictionary table
 		typedef std::map<KeyT, ValueT> Map;
 		//! An ordered dictionary table
@@ -0,0 +1,34 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "bind-array.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace EventImpl
+{
+
+	ReaderFrame*& CurrentThreadReaderFrames()
+	{
+		// must be kept within a cpp file to have a single instance per thread
+		static thread_local ReaderFrame* frames = nullptr;
+		return frames;
+	}
+
+
+
+
+} // namespace EventImpl
+} // namespace Private
+} // namespace Yuni
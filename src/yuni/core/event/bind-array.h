@@ -0,0 +1,170 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../noncopyable.h"
+#include "../../thread/mutex.h"
+#include <atomic>
+#include <vector>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace EventImpl
+{
+
+	//! An array of binds being read by the current thread
+	struct ReaderFrame final
+	{
+		//! The array
+		const void* array;
+		//! The previous frame (the array read before, when nested)
+		ReaderFrame* previous;
+	};
+
+	//! Get the stack of all arrays being read by the current thread
+	YUNI_DECL ReaderFrame*& CurrentThreadReaderFrames();
+
+
+
+
+	/*!
+	** \brief Read-mostly array of binds (copy-on-write)
+	**
+	** All binds are stored within an immutable contiguous array (snapshot), which
+	** is replaced as a whole by each modification. Reading the current snapshot
+	** does not require any lock: the readers are only counted (two counters,
+	** alternated by `synchronize()`), and a replaced snapshot is released once
+	** both counters have been seen empty (RCU-like).
+	**
+	** All modifications must be done while the mutex of the event is locked.
+	** `synchronize()` can then be called (the mutex being unlocked) to wait for
+	** all the readers of the previous snapshots from other threads, which
+	** guarantees that a removed bind is no longer in use.
+	*/
+	template<class BindT>
+	class BindArray final : private NonCopyable<BindArray<BindT> >
+	{
+	public:
+		//! Vector of binds
+		typedef std::vector<BindT> Vector;
+
+		/*!
+		** \brief Access to the current snapshot, for reading (no lock)
+		*/
+		class ReadLock final : private NonCopyable<ReadLock>
+		{
+		public:
+			explicit ReadLock(const BindArray& array);
+			~ReadLock();
+
+			//! The first bind
+			const BindT* begin() const;
+			//! The end of the binds
+			const BindT* end() const;
+
+		private:
+			const BindArray& pArray;
+			const Vector* pBinds;
+			uint pCounter;
+			ReaderFrame pFrame;
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		BindArray();
+		//! Destructor (all readers must be gone)
+		~BindArray();
+		//@}
+
+		//! \name Readers (no lock)
+		//@{
+		//! Get the number of binds
+		uint size() const;
+		//! Get if the array is empty
+		bool empty() const;
+		//@}
+
+		//! \name Writers (the mutex of the event must be locked)
+		//@{
+		//! The current binds
+		const Vector& binds() const;
+		//! Append a new bind
+		void append(const BindT& bind);
+		//! Remove all binds matching a predicate (`predicate == bind`)
+		template<class PredicateT> bool remove(const PredicateT& predicate);
+		//! Replace all binds
+		void assign(const Vector& binds);
+		//! Remove all binds
+		void clear();
+		//@}
+
+		//! \name Synchronization (the mutex of the event must not be locked)
+		//@{
+		/*!
+		** \brief Wait for all readers of the previous snapshots
+		**
+		** Nothing is done when called from a reader of this array (a callback), since
+		** the current thread would wait for itself.
+		*/
+		void synchronize() const;
+		//@}
+
+
+	private:
+		//! A replaced snapshot, waiting for its last readers
+		struct Retired final
+		{
+			//! The binds
+			Vector* binds;
+			//! Counters seen empty since the snapshot has been replaced (bit mask)
+			uint drained;
+		};
+
+	private:
+		//! Publish a new snapshot
+		void publish(Vector* binds);
+		//! Release all replaced snapshots without readers
+		void releaseRetiredSnapshots();
+		//! Get if the current thread is reading this array
+		bool readByCurrentThread() const;
+
+	private:
+		//! The current snapshot (null if empty)
+		std::atomic<Vector*> pBinds;
+		//! Number of binds in the current snapshot
+		std::atomic<uint> pCount;
+		//! Index of the counter for new readers
+		mutable std::atomic<uint> pCounter;
+		//! Number of readers, per counter
+		mutable std::atomic<uint> pReaders[2];
+		//! Replaced snapshots, still potentially in use
+		std::vector<Retired> pRetired;
+		//! Mutex for synchronizing writers waiting for readers
+		mutable Mutex pSyncMutex;
+
+	}; // class BindArray
+
+
+
+
+
+
+} // namespace EventImpl
+} // namespace Private
+} // namespace Yuni
+
+#include "bind-array.hxx"
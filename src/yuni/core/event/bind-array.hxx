@@ -0,0 +1,260 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "bind-array.h"
+#include <thread>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace EventImpl
+{
+
+	template<class BindT>
+	inline BindArray<BindT>::ReadLock::ReadLock(const BindArray& array) :
+		pArray(array)
+	{
+		// Registering as reader. The counter is checked again, to not delay
+		// a writer which has just switched them
+		do
+		{
+			pCounter = array.pCounter.load();
+			array.pReaders[pCounter].fetch_add(1);
+			if (YUNI_LIKELY(array.pCounter.load() == pCounter))
+				break;
+			array.pReaders[pCounter].fetch_sub(1, std::memory_order_release);
+		}
+		while (true);
+
+		// the snapshot can not be released until this reader has gone
+		pBinds = array.pBinds.load();
+
+		ReaderFrame*& frames = CurrentThreadReaderFrames();
+		pFrame.array = &array;
+		pFrame.previous = frames;
+		frames = &pFrame;
+	}
+
+
+	template<class BindT>
+	inline BindArray<BindT>::ReadLock::~ReadLock()
+	{
+		CurrentThreadReaderFrames() = pFrame.previous;
+		pArray.pReaders[pCounter].fetch_sub(1, std::memory_order_release);
+	}
+
+
+	template<class BindT>
+	inline const BindT* BindArray<BindT>::ReadLock::begin() const
+	{
+		return (pBinds) ? pBinds->data() : nullptr;
+	}
+
+
+	template<class BindT>
+	inline const BindT* BindArray<BindT>::ReadLock::end() const
+	{
+		return (pBinds) ? (pBinds->data() + pBinds->size()) : nullptr;
+	}
+
+
+
+
+	template<class BindT>
+	inline BindArray<BindT>::BindArray() :
+		pBinds(nullptr),
+		pCount(0),
+		pCounter(0)
+	{
+		pReaders[0] = 0;
+		pReaders[1] = 0;
+	}
+
+
+	template<class BindT>
+	BindArray<BindT>::~BindArray()
+	{
+		for (auto& retired: pRetired)
+			delete retired.binds;
+		delete pBinds.load(std::memory_order_relaxed);
+	}
+
+
+	template<class BindT>
+	inline uint BindArray<BindT>::size() const
+	{
+		return pCount.load(std::memory_order_relaxed);
+	}
+
+
+	template<class BindT>
+	inline bool BindArray<BindT>::empty() const
+	{
+		return 0 == pCount.load(std::memory_order_relaxed);
+	}
+
+
+	template<class BindT>
+	inline const typename BindArray<BindT>::Vector& BindArray<BindT>::binds() const
+	{
+		static const Vector emptyVector;
+		const Vector* binds = pBinds.load(std::memory_order_relaxed);
+		return (binds) ? *binds : emptyVector;
+	}
+
+
+	template<class BindT>
+	inline bool BindArray<BindT>::readByCurrentThread() const
+	{
+		for (const ReaderFrame* frame = CurrentThreadReaderFrames(); frame; frame = frame->previous)
+		{
+			if (frame->array == this)
+				return true;
+		}
+		return false;
+	}
+
+
+	template<class BindT>
+	void BindArray<BindT>::releaseRetiredSnapshots()
+	{
+		// A reader of a replaced snapshot has been registered before its replacement
+		// and stays registered until it has finished. Consequently the snapshot is
+		// no longer in use once each counter has been seen empty at least once.
+		// The loads are seq_cst: a reader increments its counter then loads the snapshot,
+		// the writer has replaced the snapshot then loads the counters (store-load), at
+		// least one of them must see the other
+		uint i = 0;
+		while (i < pRetired.size())
+		{
+			Retired& retired = pRetired[i];
+			if (0 == pReaders[0].load(std::memory_order_seq_cst))
+				retired.drained |= 1u;
+			if (0 == pReaders[1].load(std::memory_order_seq_cst))
+				retired.drained |= 2u;
+
+			if (retired.drained == 3u)
+			{
+				delete retired.binds;
+				retired = pRetired.back();
+				pRetired.pop_back();
+			}
+			else
+				++i;
+		}
+	}
+
+
+	template<class BindT>
+	void BindArray<BindT>::publish(Vector* binds)
+	{
+		Vector* old = pBinds.exchange(binds);
+		pCount.store((binds) ? static_cast<uint>(binds->size()) : 0u, std::memory_order_relaxed);
+		if (old)
+		{
+			Retired retired;
+			retired.binds = old;
+			retired.drained = 0;
+			pRetired.push_back(retired);
+		}
+		releaseRetiredSnapshots();
+	}
+
+
+	template<class BindT>
+	void BindArray<BindT>::append(const BindT& bind)
+	{
+		const Vector* current = pBinds.load(std::memory_order_relaxed);
+		Vector* binds = new Vector();
+		binds->reserve(((current) ? current->size() : 0) + 1);
+		if (current)
+			binds->insert(binds->end(), current->begin(), current->end());
+		binds->push_back(bind);
+		publish(binds);
+	}
+
+
+	template<class BindT>
+	template<class PredicateT>
+	bool BindArray<BindT>::remove(const PredicateT& predicate)
+	{
+		const Vector* current = pBinds.load(std::memory_order_relaxed);
+		if (not current)
+			return false;
+
+		Vector* binds = new Vector();
+		binds->reserve(current->size());
+		for (auto& bind: *current)
+		{
+			if (not (predicate == bind))
+				binds->push_back(bind);
+		}
+
+		if (binds->size() == current->size())
+		{
+			delete binds;
+			return false;
+		}
+		if (binds->empty())
+		{
+			delete binds;
+			binds = nullptr;
+		}
+		publish(binds);
+		return true;
+	}
+
+
+	template<class BindT>
+	void BindArray<BindT>::assign(const Vector& binds)
+	{
+		publish((binds.empty()) ? nullptr : new Vector(binds));
+	}
+
+
+	template<class BindT>
+	inline void BindArray<BindT>::clear()
+	{
+		if (pBinds.load(std::memory_order_relaxed))
+			publish(nullptr);
+	}
+
+
+	template<class BindT>
+	void BindArray<BindT>::synchronize() const
+	{
+		if (readByCurrentThread())
+			return;
+
+		// Switching the counters, so the new readers will not delay us, then waiting
+		// for the previous ones. Twice, to wait for both counters.
+		MutexLocker locker(pSyncMutex);
+		for (uint pass = 0; pass != 2; ++pass)
+		{
+			uint previous = pCounter.load();
+			pCounter.store(previous ^ 1u);
+			// seq_cst, like in releaseRetiredSnapshots() (a reader checks the counter again)
+			while (0 != pReaders[previous].load(std::memory_order_seq_cst))
+				std::this_thread::yield();
+		}
+	}
+
+
+
+
+
+
+} // namespace EventImpl
+} // namespace Private
+} // namespace Yuni
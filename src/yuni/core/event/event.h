@@ -159,6 +159,25 @@ namespace Yuni
 		bool empty() const;
 		//@}
 
+		//! \name Read-mostly mode
+		//@{
+		/*!
+		** \brief Enable or disable the read-mostly mode (disabled by default)
+		**
+		** By default, the mutex of the event is locked while all callbacks are invoked,
+		** thus concurrent emitters are serialized. In read-mostly mode, the callbacks
+		** are invoked without any lock, from an immutable snapshot of the connections
+		** (replaced by each connection or disconnection). The callbacks can then be
+		** called concurrently from several threads.
+		**
+		** A disconnection still waits for all invocations in progress from other threads,
+		** thus an observer can safely be destroyed once disconnected.
+		*/
+		void readMostly(bool enabled);
+		//! Get if the read-mostly mode is enabled
+		bool readMostly() const;
+		//@}
+
 		//[!] \name Invoke (documentation imported from the class WithNArguments)
 		//@{
 		// ReturnType invoke(<parameters>) const;
@@ -36,34 +36,32 @@ namespace Yuni
 	template<class P>
 	inline uint Event<P>::size() const
 	{
-		return AncestorType::pBindList.size();
+		return AncestorType::pBindArray.size();
 	}
 
 
 	template<class P>
 	void Event<P>::clearWL()
 	{
-		if (not AncestorType::pBindList.empty())
+		if (not AncestorType::pBindArray.empty())
 		{
 			// We will inform all bound objects that we are no longer linked.
 			{
 				IEvent* baseThis = dynamic_cast<IEvent*>(this);
 
-				const typename AncestorType::BindList::iterator end = AncestorType::pBindList.end();
-				typename AncestorType::BindList::iterator i = AncestorType::pBindList.begin();
-				for (; i != end; ++i)
+				for (auto& bind: AncestorType::pBindArray.binds())
 				{
-					if ((*i).isDescendantOfIEventObserverBase())
+					if (bind.isDescendantOfIEventObserverBase())
 					{
 						// Getting the object pointer, if any, then decrementing the ref counter
-						const IEventObserverBase* base = ((*i).observerBaseObject());
+						const IEventObserverBase* base = bind.observerBaseObject();
 						if (base)
 							base->boundEventRemoveFromTable(baseThis);
 					}
 				}
 			}
 			// Clear our own list
-			AncestorType::pBindList.clear();
+			AncestorType::pBindArray.clear();
 		}
 	}
 
@@ -73,12 +71,16 @@ namespace Yuni
 	{
 		if (not AncestorType::pEmpty)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			// In this case, the flag `empty` must be set first, to avoid concurrent
-			// calls to `invoke()` for nothing.
-			AncestorType::pEmpty = true;
-			// Cleanup !
-			clearWL();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				// In this case, the flag `empty` must be set first, to avoid concurrent
+				// calls to `invoke()` for nothing.
+				AncestorType::pEmpty = true;
+				// Cleanup !
+				clearWL();
+			}
+			if (AncestorType::pReadMostly)
+				AncestorType::pBindArray.synchronize();
 		}
 	}
 
@@ -90,11 +92,7 @@ namespace Yuni
 		b.bind(pointer);
 
 		typename ThreadingPolicy::MutexLocker locker(*this);
-		# ifdef YUNI_HAS_CPP_MOVE
-		AncestorType::pBindList.push_back(std::move(b));
-		# else
-		AncestorType::pBindList.push_back(b);
-		# endif
+		AncestorType::pBindArray.append(b);
 		AncestorType::pEmpty = false;
 	}
 
@@ -109,11 +107,7 @@ namespace Yuni
 
 		// locking
 		typename ThreadingPolicy::MutexLocker locker(*this);
-		# ifdef YUNI_HAS_CPP_MOVE
-		AncestorType::pBindList.push_back(std::move(b));
-		# else
-		AncestorType::pBindList.push_back(b);
-		# endif
+		AncestorType::pBindArray.append(b);
 
 		AncestorType::pEmpty = false;
 		// unlocking
@@ -133,11 +127,7 @@ namespace Yuni
 			// Locking
 			typename ThreadingPolicy::MutexLocker locker(*this);
 			// list + increment ref counter
-			# ifdef YUNI_HAS_CPP_MOVE
-			AncestorType::pBindList.push_back(std::move(b));
-			# else
-			AncestorType::pBindList.push_back(b);
-			# endif
+			AncestorType::pBindArray.append(b);
 
 			(dynamic_cast<const IEventObserverBase*>(o))->boundEventIncrementReference(dynamic_cast<IEvent*>(this));
 			AncestorType::pEmpty = false;
@@ -159,11 +149,7 @@ namespace Yuni
 			// locking
 			typename ThreadingPolicy::MutexLocker locker(*this);
 			// list + increment ref counter
-			# ifdef YUNI_HAS_CPP_MOVE
-			AncestorType::pBindList.push_back(std::move(b));
-			# else
-			AncestorType::pBindList.push_back(b);
-			# endif
+			AncestorType::pBindArray.append(b);
 
 			(dynamic_cast<const IEventObserverBase*>(o))->boundEventIncrementReference(dynamic_cast<IEvent*>(this));
 			AncestorType::pEmpty = false;
@@ -178,31 +164,36 @@ namespace Yuni
 	{
 		if (object)
 		{
+			bool removed = false;
 			const IEventObserverBase* base = dynamic_cast<const IEventObserverBase*>(object);
 			if (base)
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				if (not AncestorType::pBindList.empty())
+				if (not AncestorType::pBindArray.empty())
 				{
 					typedef Yuni::Private::EventImpl::template
 						PredicateRemoveObserverBase<typename AncestorType::BindType> RemoveType;
-					AncestorType::pBindList.remove(RemoveType(dynamic_cast<IEvent*>(this), base));
-					AncestorType::pEmpty = AncestorType::pBindList.empty();
+					removed = AncestorType::pBindArray.remove(RemoveType(dynamic_cast<IEvent*>(this), base));
+					AncestorType::pEmpty = AncestorType::pBindArray.empty();
 				}
 				// unlocking
 			}
 			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				if (not AncestorType::pBindList.empty())
+				if (not AncestorType::pBindArray.empty())
 				{
 					typedef Yuni::Private::EventImpl::template
 						PredicateRemoveObject<typename AncestorType::BindType> RemoveType;
-					AncestorType::pBindList.remove(RemoveType(object));
-					AncestorType::pEmpty = AncestorType::pBindList.empty();
+					removed = AncestorType::pBindArray.remove(RemoveType(object));
+					AncestorType::pEmpty = AncestorType::pBindArray.empty();
 				}
 				// unlocking
 			}
+
+			// waiting for the invocations in progress, the object may be destroyed afterwards
+			if (removed and AncestorType::pReadMostly)
+				AncestorType::pBindArray.synchronize();
 		}
 	}
 
@@ -210,15 +201,43 @@ namespace Yuni
 	template<class P>
 	void Event<P>::unregisterObserver(const IEventObserverBase* pointer)
 	{
-		typename ThreadingPolicy::MutexLocker locker(*this);
-		// When unregistering an observer, we have to remove it without any more checks
-		if (not AncestorType::pBindList.empty())
+		bool removed = false;
+		{
+			typename ThreadingPolicy::MutexLocker locker(*this);
+			// When unregistering an observer, we have to remove it without any more checks
+			if (not AncestorType::pBindArray.empty())
+			{
+				typedef Yuni::Private::EventImpl::template
+					PredicateRemoveWithoutChecks<typename AncestorType::BindType> RemoveType;
+				removed = AncestorType::pBindArray.remove(RemoveType(pointer));
+			}
+			AncestorType::pEmpty = AncestorType::pBindArray.empty();
+		}
+		// The observer is being destroyed: waiting for the invocations in progress
+		if (removed and AncestorType::pReadMostly)
+			AncestorType::pBindArray.synchronize();
+	}
+
+
+	template<class P>
+	void Event<P>::readMostly(bool enabled)
+	{
 		{
-			typedef Yuni::Private::EventImpl::template
-				PredicateRemoveWithoutChecks<typename AncestorType::BindType> RemoveType;
-			AncestorType::pBindList.remove(RemoveType(pointer));
+			typename ThreadingPolicy::MutexLocker locker(*this);
+			if (AncestorType::pReadMostly == enabled)
+				return;
+			AncestorType::pReadMostly = enabled;
 		}
-		AncestorType::pEmpty = AncestorType::pBindList.empty();
+		// the invocations without lock must be over before relying on the mutex again
+		if (not enabled)
+			AncestorType::pBindArray.synchronize();
+	}
+
+
+	template<class P>
+	inline bool Event<P>::readMostly() const
+	{
+		return (AncestorType::pReadMostly);
 	}
 
 
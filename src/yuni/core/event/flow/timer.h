@@ -84,7 +84,7 @@ namespace Flow
 		/*!
 		** \brief A new request has just been added into the queue
 		**
-		** The event loop is locked when this method is called
+		** No lock is provided, this method may be called concurrently from any thread
 		** \param request The request (bind, see EventLoopType::RequestType)
 		** \return True to allow the request to be posted
 		*/
@@ -12,7 +12,6 @@
 #include "../../yuni.h"
 #include "event.h"
 #include "../atomic/bool.h"
-#include "../slist/slist.h"
 #include "flow/continuous.h"
 #include "flow/timer.h"
 #include "statistics/none.h"
@@ -21,6 +20,11 @@
 #include "../static/inherit.h"
 #include <cassert>
 #include "../../thread/thread.h"
+#include "../../thread/signal.h"
+#include "../../datetime/timestamp.h"
+#include "request-queue.h"
+#include <atomic>
+#include <vector>
 #include "loop.fwd.h"
 
 
@@ -86,8 +90,8 @@ namespace EventLoop
 		typedef ParentT  ParentType;
 		//! A request
 		typedef Bind<bool ()>  RequestType;
-		//! List of requests
-		typedef LinkedList<RequestType>  RequestListType;
+		//! Queue of requests
+		typedef Yuni::Private::Core::EventLoop::RequestQueue<RequestType>  RequestQueueType;
 
 		//! The Event loop
 		typedef IEventLoop<ParentType, FlowT, StatsT, DetachedT>  EventLoopType;
@@ -165,9 +169,28 @@ namespace EventLoop
 		/*!
 		** \brief Post a new request into the queue
 		**
+		** This method is lock-free and can be called from any thread. The event
+		** loop is waked up if idle.
 		** \param request A request, which is merely a delegate via the class Bind<>)
 		*/
 		void dispatch(const RequestType& request);
+
+		/*!
+		** \brief Post several requests at once into the queue
+		**
+		** The requests are posted with a single atomic operation (and at most a
+		** single wakeup), and will be executed in the same order.
+		**
+		** \code
+		** std::vector<Bind<bool ()>> requests;
+		** ... fill the list ...
+		** loop.dispatchBatch(requests.begin(), requests.end());
+		** \endcode
+		**
+		** \param first Forward iterator to the first request
+		** \param last Forward iterator past the last request
+		*/
+		template<class IteratorT> void dispatchBatch(IteratorT first, IteratorT last);
 		//@}
 
 
@@ -190,10 +213,16 @@ namespace EventLoop
 
 
 	protected:
-		//! Suspend the thread
+		/*!
+		** \brief Suspend the event loop
+		**
+		** The incoming requests are still performed as soon as they are posted.
+		*/
 		void suspend(uint timeout);
 
 	private:
+		//! Wake up the event loop if idle
+		void wakeUpIfIdle();
 		//! Run an infinite loop
 		void runInfiniteLoopWL();
 
@@ -204,10 +233,14 @@ namespace EventLoop
 		bool runCycleWL();
 
 	private:
-		//! The number of events that wait to be triggered from the inner thread
-		Atomic::Bool pHasRequests;
-		//! List of incoming request
-		RequestListType* pRequests;
+		//! Incoming requests
+		RequestQueueType pRequests;
+		//! Signal to wake up the event loop when idle
+		Yuni::Thread::Signal pWakeUp;
+		//! True if the event loop is waiting for the signal
+		std::atomic<bool> pIdle;
+		//! True if a request has failed while the event loop was suspended
+		bool pAborting;
 		//! True if the event loop is running
 		bool pIsRunning;
 		//! External thread when ran in detached mode
@@ -42,11 +42,6 @@ namespace EventLoop
 			stop();
 		}
 
-		void suspendTheThread(uint timeout)
-		{
-			(void) suspend(timeout);
-		}
-
 	protected:
 		virtual bool onExecute()
 		{
@@ -101,8 +96,8 @@ namespace EventLoop
 	template<class ParentT, template<class> class FlowT, template<class> class StatsT,
 		bool DetachedT>
 	inline IEventLoop<ParentT,FlowT,StatsT,DetachedT>::IEventLoop() :
-		pHasRequests(),
-		pRequests(nullptr),
+		pIdle(false),
+		pAborting(false),
 		pIsRunning(false),
 		pThread(nullptr)
 	{
@@ -129,9 +124,6 @@ namespace EventLoop
 			if (detached)
 				delete pThread;
 			pThread = NULL; // for code safety
-			// Destroying the request list
-			delete pRequests;
-			pRequests = NULL; // for code safety
 		}
 	}
 
@@ -152,11 +144,8 @@ namespace EventLoop
 			{
 				// The event loop is running
 				pIsRunning = true;
+				pAborting = false;
 			}
-
-			// Initializing the request list
-			if (NULL == pRequests)
-				pRequests = new RequestListType();
 		}
 
 		if (detached)
@@ -190,13 +179,10 @@ namespace EventLoop
 		// the event loop.
 		// The object is still locked and we directly inject the request into
 		// the request list.
-		if (NULL == pRequests)
-			pRequests = new RequestListType();
-
-		pRequests->push_back(RequestStop);
+		pRequests.push(RequestType(RequestStop));
 
 		// Informing the event loop that a new request is available
-		pHasRequests = true;
+		wakeUpIfIdle();
 	}
 
 
@@ -215,13 +201,10 @@ namespace EventLoop
 			// the event loop.
 			// The object is still locked and we directly inject the request into
 			// the request list.
-			if (NULL == pRequests)
-				pRequests = new RequestListType();
-
-			pRequests->push_back(RequestStop);
+			pRequests.push(RequestType(RequestStop));
 
 			// Informing the event loop that a new request is available
-			pHasRequests = true;
+			wakeUpIfIdle();
 		}
 
 
@@ -270,23 +253,54 @@ namespace EventLoop
 		bool DetachedT>
 	void IEventLoop<ParentT,FlowT,StatsT,DetachedT>::dispatch(const typename IEventLoop<ParentT,FlowT,StatsT,DetachedT>::RequestType& request)
 	{
-		// Locking for inserting the new request
+		// Flow
+		if (not FlowPolicy::onRequestPosted(request))
+			return;
+		// Inserting the new request (no lock)
+		// Requests can be dispatched before calling start()
+		bool wasEmpty = pRequests.push(request);
+		// Statistics
+		StatisticsPolicy::onRequestPosted(request);
+
+		// Informing the event loop that a new request is available
+		// (the loop is already awake if the queue was not empty)
+		if (wasEmpty)
+			wakeUpIfIdle();
+	}
+
+
+	template<class ParentT, template<class> class FlowT, template<class> class StatsT,
+		bool DetachedT>
+	template<class IteratorT>
+	void IEventLoop<ParentT,FlowT,StatsT,DetachedT>::dispatchBatch(IteratorT first, IteratorT last)
+	{
+		// requests accepted by the flow policy
+		std::vector<RequestType> accepted;
+		for (IteratorT i = first; i != last; ++i)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			// Initializing pRequests allows for dispatching a request before calling start()
-			if (not pRequests)
-				pRequests = new RequestListType();
-			// Flow
-			if (not FlowPolicy::onRequestPosted(request))
-				return;
-			// Inserting the new request
-			pRequests->push_back(request);
-			// Statistics
-			StatisticsPolicy::onRequestPosted(request);
+			const RequestType& request = *i;
+			if (FlowPolicy::onRequestPosted(request))
+				accepted.push_back(request);
 		}
 
-		// Informing the event loop that a new request is available
-		pHasRequests = true;
+		// Inserting all requests at once
+		if (pRequests.push(accepted.begin(), accepted.end()))
+			wakeUpIfIdle();
+
+		// Statistics
+		for (auto& request: accepted)
+			StatisticsPolicy::onRequestPosted(request);
+	}
+
+
+	template<class ParentT, template<class> class FlowT, template<class> class StatsT,
+		bool DetachedT>
+	inline void IEventLoop<ParentT,FlowT,StatsT,DetachedT>::wakeUpIfIdle()
+	{
+		// see suspend(): the request has been pushed before checking the idle flag
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (pIdle.load())
+			pWakeUp.notify();
 	}
 
 
@@ -317,8 +331,12 @@ namespace EventLoop
 		// Statistics
 		StatisticsPolicy::onNewCycle();
 
+		// A request may have failed while the loop was suspended
+		if (pAborting)
+			return false;
+
 		// Performing requests, if any
-		if (pHasRequests)
+		if (not pRequests.empty())
 		{
 			if (not performAllRequestsWL())
 			{
@@ -341,78 +359,66 @@ namespace EventLoop
 		bool DetachedT>
 	bool IEventLoop<ParentT,FlowT,StatsT,DetachedT>::performAllRequestsWL()
 	{
-		// The request list. The pointer will be retrieved as soon as the
-		// inner mutex is locked
-		const RequestListType* requests;
-
-		// Lock and retrieve the request list
-		// We will keep a pointer to the request list, and will create a new one
-		// to release the mutex as soon as possible, to allow other threads to
-		// dispatch new requests while the event loop is working.
-		{
-			// Locking
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			// No request will remain into the queue after this method
-			pHasRequests = false;
-
-			// This method may sometimes be called even if there is no request
-			// in the list.
-			if (pRequests->empty())
-				return true;
-
-			// We will take the ownership on the list, and will create a new one
-			// to release the mutex as soon as possible and to process the requests
-			// asynchronously.
-			requests = pRequests;
-			pRequests = new RequestListType();
-
-			// The mutex is unlocked here
-		}
-
-		// Assert
-		assert(requests != NULL && "IEventLoop: the request list is NULL");
+		// Taking all pending requests at once (no lock), the other threads
+		// can still dispatch new requests while the event loop is working.
+		typename RequestQueueType::Node* requests = pRequests.takeAll();
 
 		// Executing all requests
-		typename RequestListType::const_iterator end = requests->end();
-		for (typename RequestListType::const_iterator i = requests->begin(); i != end; ++i)
+		for (typename RequestQueueType::Node* node = requests; node; node = node->next)
 		{
 			// Statistics
-			StatisticsPolicy::onProcessRequest(*i);
+			StatisticsPolicy::onProcessRequest(node->value);
 
 			// Processing the request
-			if (not (*i)())
+			if (not node->value())
 			{
 				// The request has failed. Aborting now.
-				delete requests;
+				RequestQueueType::Release(requests);
 				return false;
 			}
 		}
 
 		// The request list has been processed and can be destroyed
-		delete requests;
+		RequestQueueType::Release(requests);
 		return true;
 	}
 
 
 	template<class ParentT, template<class> class FlowT, template<class> class StatsT,
 		bool DetachedT>
-	inline void
+	void
 	IEventLoop<ParentT,FlowT,StatsT,DetachedT>::suspend(uint timeout)
 	{
-		if (detached)
-		{
-			// In detached mode, the thread pointer is valid. We will use the
-			// method suspend which is far better (cancellation point) than a mere
-			// sleep.
-			assert(pThread and "invalid thread pointer");
-			pThread->suspendTheThread(timeout);
-		}
-		else
+		// Waiting for the signal instead of a mere sleep, to perform the incoming
+		// requests as soon as they are posted, without waiting for the end of the timeout.
+		sint64 deadline = DateTime::NowMilliSeconds() + timeout;
+		do
 		{
-			// However, when not in detached mode, we don't have any thread instance
-			// to use. The only way to achieve a pause is to use a sleep
-			SuspendMilliSeconds(timeout);
+			pWakeUp.reset();
+			// The producers will only notify the signal when idle. The queue must be
+			// checked again once idle to not miss a request posted meanwhile
+			// (a full fence: the queue must not be read before the flag is visible to the
+			// producers, see wakeUpIfIdle())
+			pIdle.store(true);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (not pRequests.empty())
+			{
+				pIdle.store(false);
+				if (not performAllRequestsWL())
+				{
+					// The loop will stop at the next cycle
+					pAborting = true;
+					return;
+				}
+				continue;
+			}
+
+			sint64 remaining = deadline - DateTime::NowMilliSeconds();
+			if (remaining > 0)
+				pWakeUp.wait(static_cast<uint>(remaining));
+			pIdle.store(false);
 		}
+		while (DateTime::NowMilliSeconds() < deadline);
 	}
 
 
@@ -0,0 +1,109 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../noncopyable.h"
+#include <atomic>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Core
+{
+namespace EventLoop
+{
+
+	/*!
+	** \brief Lock-free queue of requests, with multiple producers and a single consumer
+	**
+	** The producers push their requests (from any thread) onto a Treiber stack
+	** with a single atomic operation (even for a batch of requests). Each request
+	** is copied into a node allocated by the producer. The consumer takes all
+	** pending requests at once, in the order they were pushed.
+	*/
+	template<class T>
+	class RequestQueue final : private NonCopyable<RequestQueue<T> >
+	{
+	public:
+		//! A single request
+		struct Node final
+		{
+			//! The next request
+			Node* next;
+			//! The request itself
+			T value;
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		RequestQueue();
+		//! Destructor (all pending requests are destroyed)
+		~RequestQueue();
+		//@}
+
+		//! \name Producers (any thread)
+		//@{
+		/*!
+		** \brief Push a new request
+		** \return True if the queue was empty
+		*/
+		bool push(const T& value);
+
+		/*!
+		** \brief Push several requests at once
+		** \return True if the queue was empty and at least one request has been pushed
+		*/
+		template<class IteratorT> bool push(IteratorT first, IteratorT last);
+		//@}
+
+		//! \name Consumer
+		//@{
+		/*!
+		** \brief Take all pending requests, in the order they were pushed
+		**
+		** All nodes must be released by the caller with `Release()`.
+		** \return The first request (null if none)
+		*/
+		Node* takeAll();
+
+		//! Release a list of requests
+		static void Release(Node* list);
+		//@}
+
+		//! Get if the queue is empty
+		bool empty() const;
+
+
+	private:
+		//! Push a chain of nodes
+		bool pushChain(Node* first, Node* last);
+
+	private:
+		//! The last pushed request (LIFO order)
+		std::atomic<Node*> pHead;
+
+	}; // class RequestQueue
+
+
+
+
+
+} // namespace EventLoop
+} // namespace Core
+} // namespace Private
+} // namespace Yuni
+
+#include "request-queue.hxx"
@@ -0,0 +1,118 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "request-queue.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Core
+{
+namespace EventLoop
+{
+
+	template<class T>
+	inline RequestQueue<T>::RequestQueue() :
+		pHead(nullptr)
+	{}
+
+
+	template<class T>
+	inline RequestQueue<T>::~RequestQueue()
+	{
+		Release(pHead.exchange(nullptr));
+	}
+
+
+	template<class T>
+	inline bool RequestQueue<T>::empty() const
+	{
+		return nullptr == pHead.load(std::memory_order_relaxed);
+	}
+
+
+	template<class T>
+	inline bool RequestQueue<T>::pushChain(Node* first, Node* last)
+	{
+		Node* head = pHead.load(std::memory_order_relaxed);
+		do
+		{
+			last->next = head;
+		}
+		while (not pHead.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+		return (nullptr == head);
+	}
+
+
+	template<class T>
+	inline bool RequestQueue<T>::push(const T& value)
+	{
+		Node* node = new Node{nullptr, value};
+		return pushChain(node, node);
+	}
+
+
+	template<class T>
+	template<class IteratorT>
+	bool RequestQueue<T>::push(IteratorT first, IteratorT last)
+	{
+		if (first == last)
+			return false;
+
+		// the chain is built in the reverse order, like the stack
+		Node* tail = new Node{nullptr, *first};
+		Node* head = tail;
+		for (++first; first != last; ++first)
+			head = new Node{head, *first};
+		return pushChain(head, tail);
+	}
+
+
+	template<class T>
+	typename RequestQueue<T>::Node* RequestQueue<T>::takeAll()
+	{
+		Node* node = pHead.exchange(nullptr, std::memory_order_acquire);
+
+		// reversing the stack to get the requests in the order they were pushed
+		Node* list = nullptr;
+		while (node)
+		{
+			Node* next = node->next;
+			node->next = list;
+			list = node;
+			node = next;
+		}
+		return list;
+	}
+
+
+	template<class T>
+	void RequestQueue<T>::Release(Node* list)
+	{
+		while (list)
+		{
+			Node* next = list->next;
+			delete list;
+			list = next;
+		}
+	}
+
+
+
+
+
+} // namespace EventLoop
+} // namespace Core
+} // namespace Private
+} // namespace Yuni
@@ -16,8 +16,8 @@
 ** this file, as they will otherwise be lost at the next generation.
 */
 
-#include "../slist/slist.h"
 #include "../atomic/bool.h"
+#include "bind-array.h"
 
 
 
@@ -125,14 +125,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -144,12 +146,7 @@ namespace EventImpl
 		void invoke() const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke();
-			}
+				each([&](const BindType& bind) { bind.invoke(); });
 		}
 
 		template<class CallbackT>
@@ -158,10 +155,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke());
+				each([&](const BindType& bind) { accumulator(value, bind.invoke()); });
 				return value;
 			}
 			return initval;
@@ -173,12 +167,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke());
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke()); });
 			return predicate.result();
 		}
 
@@ -187,21 +176,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke());
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke()); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -210,24 +198,43 @@ namespace EventImpl
 		void operator () () const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke();
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -254,14 +261,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -273,12 +282,7 @@ namespace EventImpl
 		void invoke(A0 a0) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0); });
 		}
 
 		template<class CallbackT>
@@ -287,10 +291,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0)); });
 				return value;
 			}
 			return initval;
@@ -302,12 +303,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0)); });
 			return predicate.result();
 		}
 
@@ -316,21 +312,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -339,24 +334,43 @@ namespace EventImpl
 		void operator () (A0 a0) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -385,14 +399,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -404,12 +420,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1); });
 		}
 
 		template<class CallbackT>
@@ -418,10 +429,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1)); });
 				return value;
 			}
 			return initval;
@@ -433,12 +441,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1)); });
 			return predicate.result();
 		}
 
@@ -447,21 +450,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -470,24 +472,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -518,14 +539,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -537,12 +560,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2); });
 		}
 
 		template<class CallbackT>
@@ -551,10 +569,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2)); });
 				return value;
 			}
 			return initval;
@@ -566,12 +581,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2)); });
 			return predicate.result();
 		}
 
@@ -580,21 +590,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -603,24 +612,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -653,14 +681,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -672,12 +702,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3); });
 		}
 
 		template<class CallbackT>
@@ -686,10 +711,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3)); });
 				return value;
 			}
 			return initval;
@@ -701,12 +723,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3)); });
 			return predicate.result();
 		}
 
@@ -715,21 +732,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -738,24 +754,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -790,14 +825,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -809,12 +846,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4); });
 		}
 
 		template<class CallbackT>
@@ -823,10 +855,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4)); });
 				return value;
 			}
 			return initval;
@@ -838,12 +867,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4)); });
 			return predicate.result();
 		}
 
@@ -852,21 +876,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -875,24 +898,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -929,14 +971,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -948,12 +992,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5); });
 		}
 
 		template<class CallbackT>
@@ -962,10 +1001,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5)); });
 				return value;
 			}
 			return initval;
@@ -977,12 +1013,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5)); });
 			return predicate.result();
 		}
 
@@ -991,21 +1022,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1014,24 +1044,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1070,14 +1119,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1089,12 +1140,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6); });
 		}
 
 		template<class CallbackT>
@@ -1103,10 +1149,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6)); });
 				return value;
 			}
 			return initval;
@@ -1118,12 +1161,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6)); });
 			return predicate.result();
 		}
 
@@ -1132,21 +1170,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1155,24 +1192,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1213,14 +1269,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1232,12 +1290,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7); });
 		}
 
 		template<class CallbackT>
@@ -1246,10 +1299,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7)); });
 				return value;
 			}
 			return initval;
@@ -1261,12 +1311,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7)); });
 			return predicate.result();
 		}
 
@@ -1275,21 +1320,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1298,24 +1342,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1358,14 +1421,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1377,12 +1442,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8); });
 		}
 
 		template<class CallbackT>
@@ -1391,10 +1451,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8)); });
 				return value;
 			}
 			return initval;
@@ -1406,12 +1463,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8)); });
 			return predicate.result();
 		}
 
@@ -1420,21 +1472,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1443,24 +1494,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1505,14 +1575,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1524,12 +1596,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); });
 		}
 
 		template<class CallbackT>
@@ -1538,10 +1605,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9)); });
 				return value;
 			}
 			return initval;
@@ -1553,12 +1617,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9)); });
 			return predicate.result();
 		}
 
@@ -1567,21 +1626,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1590,24 +1648,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1654,14 +1731,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1673,12 +1752,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); });
 		}
 
 		template<class CallbackT>
@@ -1687,10 +1761,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)); });
 				return value;
 			}
 			return initval;
@@ -1702,12 +1773,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)); });
 			return predicate.result();
 		}
 
@@ -1716,21 +1782,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1739,24 +1804,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1805,14 +1889,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1824,12 +1910,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11); });
 		}
 
 		template<class CallbackT>
@@ -1838,10 +1919,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11)); });
 				return value;
 			}
 			return initval;
@@ -1853,12 +1931,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11)); });
 			return predicate.result();
 		}
 
@@ -1867,21 +1940,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -1890,24 +1962,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -1958,14 +2049,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -1977,12 +2070,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12); });
 		}
 
 		template<class CallbackT>
@@ -1991,10 +2079,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12)); });
 				return value;
 			}
 			return initval;
@@ -2006,12 +2091,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12)); });
 			return predicate.result();
 		}
 
@@ -2020,21 +2100,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -2043,24 +2122,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -2113,14 +2211,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -2132,12 +2232,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13); });
 		}
 
 		template<class CallbackT>
@@ -2146,10 +2241,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13)); });
 				return value;
 			}
 			return initval;
@@ -2161,12 +2253,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13)); });
 			return predicate.result();
 		}
 
@@ -2175,21 +2262,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -2198,24 +2284,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -2270,14 +2375,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -2289,12 +2396,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14); });
 		}
 
 		template<class CallbackT>
@@ -2303,10 +2405,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14)); });
 				return value;
 			}
 			return initval;
@@ -2318,12 +2417,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14)); });
 			return predicate.result();
 		}
 
@@ -2332,21 +2426,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -2355,24 +2448,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -2429,14 +2541,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -2448,12 +2562,7 @@ namespace EventImpl
 		void invoke(A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14, A15 a15) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15);
-			}
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15); });
 		}
 
 		template<class CallbackT>
@@ -2462,10 +2571,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15)); });
 				return value;
 			}
 			return initval;
@@ -2477,12 +2583,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15)); });
 			return predicate.result();
 		}
 
@@ -2491,21 +2592,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate, A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14, A15 a15) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -2514,24 +2614,43 @@ namespace EventImpl
 		void operator () (A0 a0, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5, A6 a6, A7 a7, A8 a8, A9 a9, A10 a10, A11 a11, A12 a12, A13 a13, A14 a14, A15 a15) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
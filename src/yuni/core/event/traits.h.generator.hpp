@@ -44,8 +44,8 @@ generator = Generator.new()
 %>
 <%=generator.thisHeaderHasBeenGenerated("traits.h.generator.hpp")%>
 
-#include "../slist/slist.h"
 #include "../atomic/bool.h"
+#include "bind-array.h"
 
 
 
@@ -155,14 +155,16 @@ namespace EventImpl
 		//@{
 		//! Default constructor
 		WithNArguments() :
-			pEmpty(true)
+			pEmpty(true),
+			pReadMostly(false)
 		{}
 		//! Copy constructor
-		WithNArguments(const WithNArguments& rhs)
+		WithNArguments(const WithNArguments& rhs) :
+			pReadMostly(false)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
+			typename ThreadingPolicy::MutexLocker locker(rhs);
 			pEmpty = rhs.pEmpty;
-			pBindList = rhs.pBindList;
+			pBindArray.assign(rhs.pBindArray.binds());
 		}
 		//@}
 
@@ -174,12 +176,7 @@ namespace EventImpl
 		void invoke(<%=generator.variableList(i)%>) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(<%=generator.list(i,'a')%>);
-			}
+				each([&](const BindType& bind) { bind.invoke(<%=generator.list(i,'a')%>); });
 		}
 
 		template<class CallbackT>
@@ -188,10 +185,7 @@ namespace EventImpl
 			if (not pEmpty)
 			{
 				typename FoldType<R>::value_type value = initval;
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					accumulator(value, (*i).invoke(<%=generator.list(i,'a')%>));
+				each([&](const BindType& bind) { accumulator(value, bind.invoke(<%=generator.list(i,'a')%>)); });
 				return value;
 			}
 			return initval;
@@ -203,12 +197,7 @@ namespace EventImpl
 		{
 			PredicateT<R> predicate;
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(<%=generator.list(i,'a')%>));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(<%=generator.list(i,'a')%>)); });
 			return predicate.result();
 		}
 
@@ -217,21 +206,20 @@ namespace EventImpl
 		typename PredicateT<R>::ResultType invoke(PredicateT<R>& predicate<%=generator.variableList(i, "A", "a", ", ")%>) const
 		{
 			if (not pEmpty)
-			{
-				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					predicate((*i).invoke(<%=generator.list(i,'a')%>));
-			}
+				each([&](const BindType& bind) { predicate(bind.invoke(<%=generator.list(i,'a')%>)); });
 			return predicate.result();
 		}
 
 		template<class EventT> void assign(EventT& rhs)
 		{
-			typename ThreadingPolicy::MutexLocker locker(*this);
-			typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
-			pBindList = rhs.pBindList;
-			pEmpty = pBindList.empty();
+			{
+				typename ThreadingPolicy::MutexLocker locker(*this);
+				typename ThreadingPolicy::MutexLocker lockerRHS(rhs);
+				pBindArray.assign(rhs.pBindArray.binds());
+				pEmpty = pBindArray.empty();
+			}
+			if (pReadMostly)
+				pBindArray.synchronize();
 		}
 
 		/*!
@@ -240,24 +228,43 @@ namespace EventImpl
 		void operator () (<%=generator.variableList(i)%>) const
 		{
 			if (not pEmpty)
+				each([&](const BindType& bind) { bind.invoke(<%=generator.list(i,'a')%>); });
+		}
+		//@}
+
+
+	protected:
+		//! Binding array (type)
+		typedef BindArray<BindType> BindArrayType;
+
+	protected:
+		//! Call a functor for each bind
+		template<class CallbackT> void each(const CallbackT& callback) const
+		{
+			if (pReadMostly)
+			{
+				// no lock, the binds being an immutable snapshot
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
+			}
+			else
 			{
 				typename ThreadingPolicy::MutexLocker locker(*this);
-				const typename BindList::const_iterator end = pBindList.end();
-				for (typename BindList::const_iterator i = pBindList.begin(); i != end; ++i)
-					(*i).invoke(<%=generator.list(i,'a')%>);
+				typename BindArrayType::ReadLock binds(pBindArray);
+				for (auto& bind: binds)
+					callback(bind);
 			}
 		}
-		//@}
-
 
 	protected:
-		//! Binding list (type)
-		typedef LinkedList<BindType> BindList;
 		//! A flag to know if the event is empty or not
 		// This value must only set when the mutex is locked
 		volatile bool pEmpty;
-		//! Binding list
-		BindList pBindList;
+		//! A flag to know if the callbacks can be invoked without any lock
+		volatile bool pReadMostly;
+		//! Binding array
+		BindArrayType pBindArray;
 		// friend !
 		template<class P> friend class Event;
 
@@ -0,0 +1,161 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "buffer.h"
+#include <string.h>
+#if defined(YUNI_OS_MSVC) && defined(_M_X64)
+#	include <intrin.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Hash
+{
+
+	namespace // anonymous
+	{
+
+		/*
+		** wyhash (final version 4, by Wang Yi, released into the public domain)
+		** https://github.com/wangyi-fudan/wyhash
+		*/
+
+		//! Default secret
+		const uint64 secret[4] =
+		{
+			0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+		};
+
+
+		//! 64x64 -> 128 bits multiplication, the low part in `a`, the high part in `b`
+		inline void Multiply(uint64& a, uint64& b)
+		{
+			# if defined(__SIZEOF_INT128__)
+			unsigned __int128 r = a;
+			r *= b;
+			a = static_cast<uint64>(r);
+			b = static_cast<uint64>(r >> 64);
+			# elif defined(YUNI_OS_MSVC) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+			# else
+			uint64 ha = a >> 32, hb = b >> 32, la = static_cast<uint32>(a), lb = static_cast<uint32>(b);
+			uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+			uint64 t = rl + (rm0 << 32);
+			uint64 c = (t < rl) ? 1 : 0;
+			uint64 lo = t + (rm1 << 32);
+			c += (lo < t) ? 1 : 0;
+			uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			a = lo;
+			b = hi;
+			# endif
+		}
+
+
+		inline uint64 Mix(uint64 a, uint64 b)
+		{
+			Multiply(a, b);
+			return a ^ b;
+		}
+
+
+		inline uint64 Read8(const uchar* p)
+		{
+			uint64 v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+
+		inline uint64 Read4(const uchar* p)
+		{
+			uint32 v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+
+		//! 1 to 3 bytes
+		inline uint64 Read3(const uchar* p, size_t k)
+		{
+			return (static_cast<uint64>(p[0]) << 16) | (static_cast<uint64>(p[k >> 1]) << 8) | p[k - 1];
+		}
+
+	} // anonymous namespace
+
+
+
+
+	uint64 Buffer64(const void* buffer, size_t size, uint64 seed)
+	{
+		const uchar* p = reinterpret_cast<const uchar*>(buffer);
+		seed ^= Mix(seed ^ secret[0], secret[1]);
+
+		uint64 a;
+		uint64 b;
+		if (YUNI_LIKELY(size <= 16))
+		{
+			if (YUNI_LIKELY(size >= 4))
+			{
+				// 2 overlapping reads of 8 bytes
+				size_t middle = (size >> 3) << 2;
+				a = (Read4(p) << 32) | Read4(p + middle);
+				b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - middle);
+			}
+			else if (YUNI_LIKELY(size > 0))
+			{
+				a = Read3(p, size);
+				b = 0;
+			}
+			else
+				a = b = 0;
+		}
+		else
+		{
+			size_t i = size;
+			if (YUNI_UNLIKELY(i >= 48))
+			{
+				// 3 independent lanes
+				uint64 see1 = seed;
+				uint64 see2 = seed;
+				do
+				{
+					seed = Mix(Read8(p) ^ secret[1], Read8(p + 8) ^ seed);
+					see1 = Mix(Read8(p + 16) ^ secret[2], Read8(p + 24) ^ see1);
+					see2 = Mix(Read8(p + 32) ^ secret[3], Read8(p + 40) ^ see2);
+					p += 48;
+					i -= 48;
+				}
+				while (YUNI_LIKELY(i >= 48));
+				seed ^= see1 ^ see2;
+			}
+			while (YUNI_UNLIKELY(i > 16))
+			{
+				seed = Mix(Read8(p) ^ secret[1], Read8(p + 8) ^ seed);
+				i -= 16;
+				p += 16;
+			}
+			// the last 16 bytes (overlapping the previous ones if needed)
+			a = Read8(p + i - 16);
+			b = Read8(p + i - 8);
+		}
+
+		a ^= secret[1];
+		b ^= seed;
+		Multiply(a, b);
+		return Mix(a ^ secret[0] ^ size, b ^ secret[1]);
+	}
+
+
+
+
+} // namespace Hash
+} // namespace Yuni
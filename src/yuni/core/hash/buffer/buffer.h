@@ -0,0 +1,53 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+
+
+
+namespace Yuni
+{
+namespace Hash
+{
+
+	/*!
+	** \brief Compute a fast non-cryptographic hash of a raw buffer (64 bits)
+	**
+	** The buffer is processed 8 or 16 bytes at a time (wyhash), with a good
+	** distribution of all the bits of the result (suitable for hash tables
+	** indexed by the lowest bits).
+	**
+	** \code
+	** uint64 h = Hash::Buffer64(key.data(), key.size());
+	** \endcode
+	**
+	** \note The values may differ from one platform (or version) to another,
+	**   they should not be stored
+	** \param buffer The buffer (may be null if `size` is 0)
+	** \param size Size of the buffer in bytes
+	** \param seed An arbitrary seed
+	*/
+	YUNI_DECL uint64 Buffer64(const void* buffer, size_t size, uint64 seed = 0);
+
+	/*!
+	** \brief Compute a fast non-cryptographic hash of a raw buffer (native size)
+	**
+	** \see Buffer64()
+	*/
+	size_t Buffer(const void* buffer, size_t size);
+
+
+
+
+} // namespace Hash
+} // namespace Yuni
+
+#include "buffer.hxx"
@@ -0,0 +1,30 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "buffer.h"
+
+
+
+namespace Yuni
+{
+namespace Hash
+{
+
+	inline size_t Buffer(const void* buffer, size_t size)
+	{
+		return static_cast<size_t>(Buffer64(buffer, size));
+	}
+
+
+
+
+} // namespace Hash
+} // namespace Yuni
@@ -11,6 +11,7 @@
 #include "md5.h"
 #include "../../../core/system/windows.hdr.h"
 #include "../../../io/file/stream.h"
+#include "../../../io/file/mappedview.h"
 
 
 
@@ -413,6 +414,33 @@ namespace Checksum
 	const String& MD5::fromFile(const String& filename)
 	{
 		pValue.clear();
+
+		// mapping the file by large windows, without copying its content
+		IO::File::MappedView view;
+		if (IO::errNone == view.open(filename, IO::OpenMode::read, false))
+		{
+			enum { window = 64 * 1024 * 1024 };
+			MD5TypeState state;
+			MD5TypeByte digest[16];
+
+			md5ImplInit(&state);
+			uint64 offset = 0;
+			for (; offset < view.fileSize(); offset += view.size())
+			{
+				if (not view.map(offset, window))
+					break;
+				view.advise(IO::File::Advice::sequential);
+				md5ImplAppend(&state, reinterpret_cast<const MD5TypeByte*>(view.data()), static_cast<uint>(view.size()));
+			}
+			if (offset >= view.fileSize())
+			{
+				md5ImplFinish(&state, digest);
+				md5DigestToString(pValue, digest);
+				return pValue;
+			}
+			// the file can not be mapped, reading it instead
+		}
+
 		IO::File::Stream stream;
 		if (stream.open(filename))
 		{
@@ -421,10 +449,10 @@ namespace Checksum
 
 			md5ImplInit(&state);
 
-			char buffer[1024];
+			char buffer[16 * 1024];
 			uint64 len = 0u;
 
-			while (0 != (len = stream.read((char*)buffer, 1024u)))
+			while (0 != (len = stream.read((char*)buffer, sizeof(buffer))))
 				md5ImplAppend(&state, reinterpret_cast<const MD5TypeByte*>(buffer), static_cast<uint>(len));
 
 			md5ImplFinish(&state, digest);
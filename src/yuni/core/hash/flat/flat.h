@@ -0,0 +1,383 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "group.h"
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+
+
+namespace Yuni
+{
+namespace Hash
+{
+
+	/*!
+	** \brief Default hasher for Hash::Flat<>
+	**
+	** Any type convertible to the key can be given (std::hash<KeyT>).
+	*/
+	template<class KeyT>
+	struct FlatHasher final
+	{
+		size_t operator () (const KeyT& key) const
+		{
+			return std::hash<KeyT>()(key);
+		}
+	};
+
+	/*!
+	** \brief Default hasher for Hash::Flat<> (strings)
+	**
+	** All strings (CString, AnyString, std::string, const char*...) have the
+	** same hash for the same content, thus a table with `String` keys can be
+	** searched with an `AnyString`, without any copy.
+	*/
+	template<uint ChunkSizeT, bool ExpandableT>
+	struct FlatHasher<CString<ChunkSizeT, ExpandableT> > final
+	{
+		size_t operator () (const AnyString& key) const
+		{
+			return Yuni::Hash::Buffer(key.data(), key.size());
+		}
+	};
+
+
+	/*!
+	** \brief Default key comparison for Hash::Flat<>
+	**
+	** Any type comparable with the key can be given (`key == other`).
+	*/
+	template<class KeyT>
+	struct FlatEqual final
+	{
+		template<class U>
+		bool operator () (const KeyT& key, const U& other) const
+		{
+			return key == other;
+		}
+	};
+
+
+
+
+	/*!
+	** \brief Hash table with open addressing (flat memory layout)
+	**
+	** The items are directly stored in a single array (no node per item), and
+	** probed by group of 16 thanks to an array of control bytes (one byte per
+	** item, with 7 bits of the hash of the key). A lookup usually consists of a
+	** single SIMD comparison and a single key comparison, without any pointer to
+	** chase.
+	**
+	** The interface is a subset of `std::unordered_map`. The lookups accept any
+	** type the hasher and the comparison accept (heterogeneous lookup):
+	** \code
+	** Hash::Flat<String, uint> table;
+	** table["hello"] = 42;
+	** AnyString key = "hello";
+	** auto it = table.find(key); // no temporary String
+	** \endcode
+	**
+	** \warning Unlike `std::unordered_map`, any insertion may invalidate all
+	**   iterators and references (the items are moved when the table grows).
+	**   Removing an item only invalidates the iterators and references to it.
+	**
+	** \tparam KeyT Type of the keys
+	** \tparam ValueT Type of the values
+	** \tparam HasherT Hash function
+	** \tparam EqualT Key comparison
+	** \see Dictionary<K,V>::Flat
+	*/
+	template<class KeyT, class ValueT, class HasherT = FlatHasher<KeyT>, class EqualT = FlatEqual<KeyT> >
+	class Flat final
+	{
+	public:
+		//! Type of the keys
+		typedef KeyT key_type;
+		//! Type of the values
+		typedef ValueT mapped_type;
+		//! Type of an item
+		typedef std::pair<const KeyT, ValueT> value_type;
+		//! Size
+		typedef size_t size_type;
+		//! Hash function
+		typedef HasherT hasher;
+		//! Key comparison
+		typedef EqualT key_equal;
+
+	private:
+		typedef Yuni::Private::HashFlatImpl::Ctrl Ctrl;
+
+		template<bool ConstT>
+		class IteratorBase final
+		{
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef typename Flat::value_type value_type;
+			typedef ptrdiff_t difference_type;
+			typedef typename std::conditional<ConstT, const value_type&, value_type&>::type reference;
+			typedef typename std::conditional<ConstT, const value_type*, value_type*>::type pointer;
+
+		public:
+			IteratorBase() :
+				pCtrl(nullptr), pSlot(nullptr)
+			{}
+			//! Conversion to a const iterator
+			template<bool C, class = typename std::enable_if<(ConstT and not C)>::type>
+			IteratorBase(const IteratorBase<C>& rhs) :
+				pCtrl(rhs.pCtrl), pSlot(rhs.pSlot)
+			{}
+
+			reference operator * () const {return *pSlot;}
+			pointer operator -> () const {return pSlot;}
+
+			IteratorBase& operator ++ ()
+			{
+				++pCtrl;
+				++pSlot;
+				skipFreeSlots();
+				return *this;
+			}
+
+			IteratorBase operator ++ (int)
+			{
+				IteratorBase copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			template<bool C> bool operator == (const IteratorBase<C>& rhs) const {return pCtrl == rhs.pCtrl;}
+			template<bool C> bool operator != (const IteratorBase<C>& rhs) const {return pCtrl != rhs.pCtrl;}
+
+		private:
+			IteratorBase(Ctrl* ctrl, value_type* slot) :
+				pCtrl(ctrl), pSlot(slot)
+			{}
+
+			void skipFreeSlots()
+			{
+				// the sentinel stops the loop
+				while (*pCtrl < Yuni::Private::HashFlatImpl::ctrlSentinel)
+				{
+					++pCtrl;
+					++pSlot;
+				}
+			}
+
+		private:
+			//! Control byte of the item
+			Ctrl* pCtrl;
+			//! The item
+			value_type* pSlot;
+			friend class Flat;
+			template<bool> friend class IteratorBase;
+
+		}; // class IteratorBase
+
+	public:
+		//! Iterator
+		typedef IteratorBase<false> iterator;
+		//! Iterator (const)
+		typedef IteratorBase<true> const_iterator;
+
+
+	public:
+		//! \name Constructors & Destructor
+		//@{
+		//! Default constructor (no allocation)
+		Flat();
+		//! Copy constructor
+		Flat(const Flat& rhs);
+		//! Move constructor
+		Flat(Flat&& rhs) noexcept;
+		//! Constructor from a list of items
+		Flat(std::initializer_list<value_type> list);
+		//! Destructor
+		~Flat();
+		//@}
+
+
+		//! \name Iterators
+		//@{
+		iterator begin();
+		const_iterator begin() const;
+		const_iterator cbegin() const;
+
+		iterator end();
+		const_iterator end() const;
+		const_iterator cend() const;
+		//@}
+
+
+		//! \name Lookup
+		//@{
+		/*!
+		** \brief Find the item associated to a key
+		**
+		** \param key Any value accepted by the hasher and the key comparison
+		** \return An iterator to the item, `end()` if not found
+		*/
+		template<class K> iterator find(const K& key);
+		template<class K> const_iterator find(const K& key) const;
+
+		//! Get the number of items associated to a key (0 or 1)
+		template<class K> size_type count(const K& key) const;
+
+		//! Get if a key exists
+		template<class K> bool exists(const K& key) const;
+
+		/*!
+		** \brief Get the value associated to a key
+		**
+		** \throw std::out_of_range if the key does not exist
+		*/
+		template<class K> ValueT& at(const K& key);
+		template<class K> const ValueT& at(const K& key) const;
+		//@}
+
+
+		//! \name Modifiers
+		//@{
+		/*!
+		** \brief Get the value associated to a key, inserted (default value) if not found
+		**
+		** The key is converted to KeyT only when a new item is inserted.
+		*/
+		template<class K> ValueT& operator [] (K&& key);
+
+		/*!
+		** \brief Insert an item if its key does not exist yet
+		**
+		** \return An iterator to the item with the key, and if it has been inserted
+		*/
+		std::pair<iterator, bool> insert(const value_type& item);
+		std::pair<iterator, bool> insert(value_type&& item);
+
+		/*!
+		** \brief Insert an item, the value constructed in place, if the key does not exist yet
+		**
+		** Nothing is constructed if the key already exists.
+		** \return An iterator to the item with the key, and if it has been inserted
+		*/
+		template<class K, class... Args> std::pair<iterator, bool> try_emplace(K&& key, Args&&... args);
+
+		/*!
+		** \brief Remove the item associated to a key
+		**
+		** \return The number of items removed (0 or 1)
+		*/
+		template<class K> size_type erase(const K& key);
+
+		/*!
+		** \brief Remove an item
+		**
+		** \return An iterator to the next item
+		*/
+		iterator erase(const_iterator it);
+		iterator erase(iterator it);
+
+		/*!
+		** \brief Remove all items
+		**
+		** The memory is kept for small tables.
+		*/
+		void clear();
+
+		//! Reserve enough room for a given number of items (no further allocation)
+		void reserve(size_type count);
+
+		//! Swap the content with another table
+		void swap(Flat& rhs) noexcept;
+		//@}
+
+
+		//! \name Memory management
+		//@{
+		//! Get if the table is empty
+		bool empty() const;
+		//! Get the number of items
+		size_type size() const;
+		//! Get the number of slots
+		size_type capacity() const;
+		//@}
+
+
+		//! \name Operators
+		//@{
+		Flat& operator = (const Flat& rhs);
+		Flat& operator = (Flat&& rhs) noexcept;
+		//@}
+
+
+	private:
+		//! Mixed hash (h1: position in the table, h2: 7 bits for the control byte)
+		template<class K> static uint64 HashOf(const K& key);
+		//! Position of the first probe
+		static size_type H1(uint64 hash) {return static_cast<size_type>(hash);}
+		//! Control byte
+		static Ctrl H2(uint64 hash) {return static_cast<Ctrl>(hash >> 57);}
+		//! Maximum number of items for a given capacity (load factor: 7/8)
+		static size_type CapacityToGrowth(size_type capacity);
+		//! Capacity required for a given number of items
+		static size_type GrowthToCapacity(size_type count);
+
+		//! Index of the item associated to a key, `pCapacity` if not found
+		template<class K> size_type findIndex(const K& key, uint64 hash) const;
+		//! Index of a free slot for a new item (the table must not be full)
+		size_type findFreeSlot(uint64 hash) const;
+		//! Index of the slot for a new item, growing the table if needed (the control byte is not updated)
+		size_type prepareInsert(uint64 hash);
+		//! Mark as used the slot of a newly constructed item
+		void commitInsert(size_type index, uint64 hash);
+		//! Update a control byte (and its clone)
+		void setCtrl(size_type index, Ctrl h);
+		//! Remove the item at a given index
+		void eraseAt(size_type index);
+
+		//! Allocate the arrays for a given capacity (all slots empty)
+		void initialize(size_type capacity);
+		//! Reallocate the arrays and move all items
+		void resize(size_type capacity);
+		//! Make room for one item, either by growing or by removing the tombstones
+		void rehashAndGrowIfNeeded();
+		//! Destroy all items and release the memory
+		void destroy();
+
+		iterator iteratorAt(size_type index) {return iterator(pCtrl + index, pSlots + index);}
+		const_iterator iteratorAt(size_type index) const {return const_iterator(pCtrl + index, pSlots + index);}
+
+	private:
+		//! Control bytes (`pCapacity + groupWidth` bytes, the last ones are clones of the first ones)
+		Ctrl* pCtrl;
+		//! The items (in the same allocation than the control bytes)
+		value_type* pSlots;
+		//! Number of items
+		size_type pSize;
+		//! Number of slots (2^n - 1)
+		size_type pCapacity;
+		//! Number of items which can be inserted before rehashing
+		size_type pGrowthLeft;
+
+	}; // class Flat
+
+
+
+
+} // namespace Hash
+} // namespace Yuni
+
+#include "flat.hxx"
@@ -0,0 +1,591 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "flat.h"
+#include <new>
+#include <stdexcept>
+#include <string.h>
+#include <tuple>
+
+
+
+namespace Yuni
+{
+namespace Hash
+{
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>::Flat() :
+		pCtrl(Yuni::Private::HashFlatImpl::EmptyGroup()),
+		pSlots(nullptr),
+		pSize(0),
+		pCapacity(0),
+		pGrowthLeft(0)
+	{}
+
+
+	template<class K, class V, class H, class E>
+	Flat<K,V,H,E>::Flat(const Flat& rhs) :
+		Flat()
+	{
+		reserve(rhs.pSize);
+		// all keys are distinct, no lookup required
+		const_iterator end = rhs.end();
+		for (const_iterator it = rhs.begin(); it != end; ++it)
+		{
+			uint64 hash = HashOf(it->first);
+			size_type index = findFreeSlot(hash);
+			new (pSlots + index) value_type(*it);
+			commitInsert(index, hash);
+		}
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>::Flat(Flat&& rhs) noexcept :
+		pCtrl(rhs.pCtrl),
+		pSlots(rhs.pSlots),
+		pSize(rhs.pSize),
+		pCapacity(rhs.pCapacity),
+		pGrowthLeft(rhs.pGrowthLeft)
+	{
+		rhs.pCtrl = Yuni::Private::HashFlatImpl::EmptyGroup();
+		rhs.pSlots = nullptr;
+		rhs.pSize = 0;
+		rhs.pCapacity = 0;
+		rhs.pGrowthLeft = 0;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>::Flat(std::initializer_list<value_type> list) :
+		Flat()
+	{
+		reserve(list.size());
+		for (auto& item : list)
+			insert(item);
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>::~Flat()
+	{
+		destroy();
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>& Flat<K,V,H,E>::operator = (const Flat& rhs)
+	{
+		if (this != &rhs)
+		{
+			Flat copy(rhs);
+			swap(copy);
+		}
+		return *this;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline Flat<K,V,H,E>& Flat<K,V,H,E>::operator = (Flat&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			destroy();
+			swap(rhs);
+		}
+		return *this;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline void Flat<K,V,H,E>::swap(Flat& rhs) noexcept
+	{
+		std::swap(pCtrl, rhs.pCtrl);
+		std::swap(pSlots, rhs.pSlots);
+		std::swap(pSize, rhs.pSize);
+		std::swap(pCapacity, rhs.pCapacity);
+		std::swap(pGrowthLeft, rhs.pGrowthLeft);
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::iterator Flat<K,V,H,E>::begin()
+	{
+		iterator it = iteratorAt(0);
+		it.skipFreeSlots();
+		return it;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::const_iterator Flat<K,V,H,E>::begin() const
+	{
+		const_iterator it = iteratorAt(0);
+		it.skipFreeSlots();
+		return it;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::const_iterator Flat<K,V,H,E>::cbegin() const
+	{
+		return begin();
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::iterator Flat<K,V,H,E>::end()
+	{
+		return iteratorAt(pCapacity);
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::const_iterator Flat<K,V,H,E>::end() const
+	{
+		return iteratorAt(pCapacity);
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::const_iterator Flat<K,V,H,E>::cend() const
+	{
+		return end();
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline bool Flat<K,V,H,E>::empty() const
+	{
+		return pSize == 0;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::size() const
+	{
+		return pSize;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::capacity() const
+	{
+		return pCapacity;
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline uint64 Flat<K,V,H,E>::HashOf(const KeyT& key)
+	{
+		// the hash functions are not required to be good at all for the
+		// lowest bits (std::hash<int> is the identity with some compilers)
+		uint64 hash = static_cast<uint64>(H()(key)) * 0x9E3779B97F4A7C15ull;
+		return hash ^ (hash >> 32);
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::CapacityToGrowth(size_type capacity)
+	{
+		// small tables (< groupWidth) can be full: a probe always sees
+		// the empty bytes after the clones
+		return capacity - capacity / 8;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::GrowthToCapacity(size_type count)
+	{
+		size_type capacity = 1;
+		while (CapacityToGrowth(capacity) < count)
+			capacity = capacity * 2 + 1;
+		return capacity;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline void Flat<K,V,H,E>::setCtrl(size_type index, Ctrl h)
+	{
+		enum { cloned = Yuni::Private::HashFlatImpl::groupWidth - 1 };
+		pCtrl[index] = h;
+		pCtrl[((index - cloned) & pCapacity) + (cloned & pCapacity)] = h;
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::findIndex(const KeyT& key, uint64 hash) const
+	{
+		using namespace Yuni::Private::HashFlatImpl;
+		const size_type mask = pCapacity;
+		const Ctrl h2 = H2(hash);
+		size_type offset = H1(hash) & mask;
+		size_type step = 0;
+		for (;;)
+		{
+			Group group(pCtrl + offset);
+			for (uint match = group.match(h2); match != 0; match &= match - 1)
+			{
+				size_type index = (offset + TrailingZeros(match)) & mask;
+				if (YUNI_LIKELY(E()(pSlots[index].first, key)))
+					return index;
+			}
+			if (YUNI_LIKELY(group.matchEmpty() != 0))
+				return pCapacity;
+			// triangular probing, visiting all groups
+			step += groupWidth;
+			offset = (offset + step) & mask;
+		}
+	}
+
+
+	template<class K, class V, class H, class E>
+	typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::findFreeSlot(uint64 hash) const
+	{
+		using namespace Yuni::Private::HashFlatImpl;
+		const size_type mask = pCapacity;
+		size_type offset = H1(hash) & mask;
+		size_type step = 0;
+		for (;;)
+		{
+			uint match = Group(pCtrl + offset).matchEmptyOrDeleted();
+			if (YUNI_LIKELY(match != 0))
+				return (offset + TrailingZeros(match)) & mask;
+			step += groupWidth;
+			offset = (offset + step) & mask;
+		}
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline typename Flat<K,V,H,E>::iterator Flat<K,V,H,E>::find(const KeyT& key)
+	{
+		return iteratorAt(findIndex(key, HashOf(key)));
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline typename Flat<K,V,H,E>::const_iterator Flat<K,V,H,E>::find(const KeyT& key) const
+	{
+		return iteratorAt(findIndex(key, HashOf(key)));
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::count(const KeyT& key) const
+	{
+		return (findIndex(key, HashOf(key)) != pCapacity) ? 1 : 0;
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline bool Flat<K,V,H,E>::exists(const KeyT& key) const
+	{
+		return findIndex(key, HashOf(key)) != pCapacity;
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline V& Flat<K,V,H,E>::at(const KeyT& key)
+	{
+		size_type index = findIndex(key, HashOf(key));
+		if (YUNI_UNLIKELY(index == pCapacity))
+			throw std::out_of_range("Hash::Flat::at: key not found");
+		return pSlots[index].second;
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline const V& Flat<K,V,H,E>::at(const KeyT& key) const
+	{
+		size_type index = findIndex(key, HashOf(key));
+		if (YUNI_UNLIKELY(index == pCapacity))
+			throw std::out_of_range("Hash::Flat::at: key not found");
+		return pSlots[index].second;
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::prepareInsert(uint64 hash)
+	{
+		size_type index = findFreeSlot(hash);
+		// a tombstone can be reused without consuming the growth
+		if (YUNI_UNLIKELY(pGrowthLeft == 0 and pCtrl[index] != Yuni::Private::HashFlatImpl::ctrlDeleted))
+		{
+			rehashAndGrowIfNeeded();
+			index = findFreeSlot(hash);
+		}
+		return index;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline void Flat<K,V,H,E>::commitInsert(size_type index, uint64 hash)
+	{
+		if (pCtrl[index] == Yuni::Private::HashFlatImpl::ctrlEmpty)
+			--pGrowthLeft;
+		++pSize;
+		setCtrl(index, H2(hash));
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT, class... Args>
+	std::pair<typename Flat<K,V,H,E>::iterator, bool>
+	Flat<K,V,H,E>::try_emplace(KeyT&& key, Args&&... args)
+	{
+		const uint64 hash = HashOf(key);
+		size_type index = findIndex(key, hash);
+		if (index != pCapacity)
+			return std::make_pair(iteratorAt(index), false);
+
+		index = prepareInsert(hash);
+		// nothing is modified if the constructor throws
+		new (pSlots + index) value_type(std::piecewise_construct,
+			std::forward_as_tuple(std::forward<KeyT>(key)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+		commitInsert(index, hash);
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+
+	template<class K, class V, class H, class E>
+	std::pair<typename Flat<K,V,H,E>::iterator, bool>
+	Flat<K,V,H,E>::insert(const value_type& item)
+	{
+		const uint64 hash = HashOf(item.first);
+		size_type index = findIndex(item.first, hash);
+		if (index != pCapacity)
+			return std::make_pair(iteratorAt(index), false);
+
+		index = prepareInsert(hash);
+		new (pSlots + index) value_type(item);
+		commitInsert(index, hash);
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+
+	template<class K, class V, class H, class E>
+	std::pair<typename Flat<K,V,H,E>::iterator, bool>
+	Flat<K,V,H,E>::insert(value_type&& item)
+	{
+		const uint64 hash = HashOf(item.first);
+		size_type index = findIndex(item.first, hash);
+		if (index != pCapacity)
+			return std::make_pair(iteratorAt(index), false);
+
+		index = prepareInsert(hash);
+		new (pSlots + index) value_type(std::move(item));
+		commitInsert(index, hash);
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline V& Flat<K,V,H,E>::operator [] (KeyT&& key)
+	{
+		return try_emplace(std::forward<KeyT>(key)).first->second;
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::eraseAt(size_type index)
+	{
+		using namespace Yuni::Private::HashFlatImpl;
+		pSlots[index].~value_type();
+		--pSize;
+
+		// The slot can be marked as empty (instead of a tombstone) if no probe
+		// has ever seen a full group around it: the number of consecutive used
+		// slots around it must be less than the width of a group
+		size_type before = (index - groupWidth) & pCapacity;
+		uint emptyAfter  = Group(pCtrl + index).matchEmpty();
+		uint emptyBefore = Group(pCtrl + before).matchEmpty();
+		bool wasNeverFull = emptyBefore != 0 and emptyAfter != 0
+			and (TrailingZeros(emptyAfter) + LeadingZeros16(emptyBefore)) < static_cast<uint>(groupWidth);
+
+		if (wasNeverFull)
+		{
+			setCtrl(index, ctrlEmpty);
+			++pGrowthLeft;
+		}
+		else
+			setCtrl(index, ctrlDeleted);
+	}
+
+
+	template<class K, class V, class H, class E>
+	template<class KeyT>
+	inline typename Flat<K,V,H,E>::size_type Flat<K,V,H,E>::erase(const KeyT& key)
+	{
+		size_type index = findIndex(key, HashOf(key));
+		if (index == pCapacity)
+			return 0;
+		eraseAt(index);
+		return 1;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::iterator Flat<K,V,H,E>::erase(const_iterator it)
+	{
+		size_type index = static_cast<size_type>(it.pCtrl - pCtrl);
+		eraseAt(index);
+		iterator next = iteratorAt(index);
+		next.skipFreeSlots();
+		return next;
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline typename Flat<K,V,H,E>::iterator Flat<K,V,H,E>::erase(iterator it)
+	{
+		return erase(const_iterator(it));
+	}
+
+
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::initialize(size_type capacity)
+	{
+		using namespace Yuni::Private::HashFlatImpl;
+		// a single allocation: the control bytes, then the items
+		const size_type ctrlSize = capacity + groupWidth;
+		const size_type slotOffset = (ctrlSize + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+		char* memory = static_cast<char*>(::operator new(slotOffset + capacity * sizeof(value_type)));
+
+		pCtrl = reinterpret_cast<Ctrl*>(memory);
+		::memset(pCtrl, ctrlEmpty, ctrlSize);
+		pCtrl[capacity] = ctrlSentinel;
+		pSlots = reinterpret_cast<value_type*>(memory + slotOffset);
+		pCapacity = capacity;
+		pGrowthLeft = CapacityToGrowth(capacity) - pSize;
+	}
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::resize(size_type capacity)
+	{
+		Ctrl* oldCtrl = pCtrl;
+		value_type* oldSlots = pSlots;
+		size_type oldCapacity = pCapacity;
+
+		initialize(capacity);
+
+		for (size_type i = 0; i != oldCapacity; ++i)
+		{
+			if (oldCtrl[i] >= 0)
+			{
+				value_type& item = oldSlots[i];
+				uint64 hash = HashOf(item.first);
+				size_type index = findFreeSlot(hash);
+				setCtrl(index, H2(hash));
+				// the key is const only for the users of the table
+				new (pSlots + index) value_type(std::move(const_cast<K&>(item.first)), std::move(item.second));
+				item.~value_type();
+			}
+		}
+		if (oldCapacity != 0)
+			::operator delete(oldCtrl);
+	}
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::rehashAndGrowIfNeeded()
+	{
+		// Lots of tombstones (more than ~1/8 of the slots): the same capacity
+		// is enough once they are removed
+		if (pCapacity > static_cast<size_type>(Yuni::Private::HashFlatImpl::groupWidth)
+			and pSize * 32 <= pCapacity * 25)
+			resize(pCapacity);
+		else
+			resize(pCapacity * 2 + 1);
+	}
+
+
+	template<class K, class V, class H, class E>
+	inline void Flat<K,V,H,E>::reserve(size_type count)
+	{
+		if (count > pSize + pGrowthLeft)
+			resize(GrowthToCapacity(count));
+	}
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::clear()
+	{
+		using namespace Yuni::Private::HashFlatImpl;
+		if (pCapacity > 127)
+		{
+			// releasing the memory of large tables
+			destroy();
+			return;
+		}
+		for (size_type i = 0; i != pCapacity; ++i)
+		{
+			if (pCtrl[i] >= 0)
+				pSlots[i].~value_type();
+		}
+		if (pCapacity != 0)
+		{
+			::memset(pCtrl, ctrlEmpty, pCapacity + groupWidth);
+			pCtrl[pCapacity] = ctrlSentinel;
+		}
+		pSize = 0;
+		pGrowthLeft = CapacityToGrowth(pCapacity);
+	}
+
+
+	template<class K, class V, class H, class E>
+	void Flat<K,V,H,E>::destroy()
+	{
+		if (pCapacity != 0)
+		{
+			for (size_type i = 0; i != pCapacity; ++i)
+			{
+				if (pCtrl[i] >= 0)
+					pSlots[i].~value_type();
+			}
+			::operator delete(pCtrl);
+		}
+		pCtrl = Yuni::Private::HashFlatImpl::EmptyGroup();
+		pSlots = nullptr;
+		pSize = 0;
+		pCapacity = 0;
+		pGrowthLeft = 0;
+	}
+
+
+
+
+} // namespace Hash
+} // namespace Yuni
@@ -0,0 +1,164 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define YUNI_HASH_FLAT_SSE2
+#	include <emmintrin.h>
+#endif
+#ifdef YUNI_OS_MSVC
+#	include <intrin.h>
+#endif
+
+/*
+** Control bytes of Hash::Flat<>
+**
+** Each slot of the table has a control byte: `ctrlEmpty`, `ctrlDeleted`, or
+** 7 bits of the hash of its key when the slot is used (positive value).
+** The control bytes are probed by group of 16: a single SSE2 comparison finds
+** all the candidates of a group (a plain loop is used on other architectures).
+*/
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace HashFlatImpl
+{
+
+	typedef signed char Ctrl;
+
+	enum : Ctrl
+	{
+		//! The slot is free
+		ctrlEmpty = -128,
+		//! The slot is free, but was used (the probing must not stop on it)
+		ctrlDeleted = -2,
+		//! End of the table (for iterating without knowing the capacity)
+		ctrlSentinel = -1,
+	};
+
+	enum
+	{
+		//! Number of control bytes per group
+		groupWidth = 16,
+	};
+
+
+	//! Index of the lowest bit set (`mask` must not be null)
+	inline uint TrailingZeros(uint mask)
+	{
+		# ifdef YUNI_OS_MSVC
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<uint>(index);
+		# else
+		return static_cast<uint>(__builtin_ctz(mask));
+		# endif
+	}
+
+	//! Number of leading zeros of a 16 bits mask (`mask` must not be null)
+	inline uint LeadingZeros16(uint mask)
+	{
+		# ifdef YUNI_OS_MSVC
+		unsigned long index;
+		_BitScanReverse(&index, mask);
+		return 15u - static_cast<uint>(index);
+		# else
+		return static_cast<uint>(__builtin_clz(mask)) - 16u;
+		# endif
+	}
+
+
+	//! Control bytes of an empty table (no allocation for empty tables)
+	inline Ctrl* EmptyGroup()
+	{
+		alignas(16) static const Ctrl group[groupWidth] =
+		{
+			ctrlSentinel, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty,
+			ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty, ctrlEmpty
+		};
+		// never written (no slot)
+		return const_cast<Ctrl*>(group);
+	}
+
+
+	/*!
+	** \brief 16 control bytes, loaded at once
+	**
+	** All the `match` methods return a mask, one bit per control byte.
+	*/
+	class Group final
+	{
+	public:
+		explicit Group(const Ctrl* ctrl)
+		{
+			# ifdef YUNI_HASH_FLAT_SSE2
+			pCtrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+			# else
+			for (uint i = 0; i != groupWidth; ++i)
+				pCtrl[i] = ctrl[i];
+			# endif
+		}
+
+		//! Slots whose control byte is `h2`
+		uint match(Ctrl h2) const
+		{
+			# ifdef YUNI_HASH_FLAT_SSE2
+			return static_cast<uint>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), pCtrl)));
+			# else
+			uint mask = 0;
+			for (uint i = 0; i != groupWidth; ++i)
+				mask |= static_cast<uint>(pCtrl[i] == h2) << i;
+			return mask;
+			# endif
+		}
+
+		//! Empty slots
+		uint matchEmpty() const
+		{
+			return match(ctrlEmpty);
+		}
+
+		//! Empty or deleted slots
+		uint matchEmptyOrDeleted() const
+		{
+			# ifdef YUNI_HASH_FLAT_SSE2
+			// ctrlEmpty and ctrlDeleted are less than ctrlSentinel
+			return static_cast<uint>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrlSentinel), pCtrl)));
+			# else
+			uint mask = 0;
+			for (uint i = 0; i != groupWidth; ++i)
+				mask |= static_cast<uint>(pCtrl[i] < ctrlSentinel) << i;
+			return mask;
+			# endif
+		}
+
+	private:
+		# ifdef YUNI_HASH_FLAT_SSE2
+		//! The control bytes
+		__m128i pCtrl;
+		# else
+		//! The control bytes
+		Ctrl pCtrl[groupWidth];
+		# endif
+
+	}; // class Group
+
+
+
+
+
+} // namespace HashFlatImpl
+} // namespace Private
+} // namespace Yuni
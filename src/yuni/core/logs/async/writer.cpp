@@ -0,0 +1,533 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "writer.h"
+#include "../../../thread/thread.h"
+#include "../../suspend.h"
+#include <string.h>
+#include <algorithm>
+#ifdef YUNI_OS_WINDOWS
+#	include <io.h>
+#else
+#	include <unistd.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+
+	namespace // anonymous
+	{
+
+		enum : uint32
+		{
+			//! The record has been published
+			flagPublished = 0x80000000u,
+			//! The record is only padding until the end of the ring
+			flagPadding = 0x40000000u,
+			//! Mask for the size
+			sizeMask = 0x3FFFFFFFu,
+		};
+
+		enum
+		{
+			//! Size of the header of a record
+			headerSize = 8,
+			//! Size of the buffer for coalescing the records
+			outputCapacity = 64 * 1024,
+			//! Delay before checking the queue again when idle (ms)
+			idleDelay = 1000,
+			//! Delay for gathering more messages after having been woken up (ms)
+			batchDelay = 1,
+			//! Size of the blocks given back to the producers when consuming the records
+			releaseBlockSize = 16 * 1024,
+		};
+
+
+		inline std::atomic<uint32>& HeaderAt(char* ring, uint64 offset)
+		{
+			return *reinterpret_cast<std::atomic<uint32>*>(ring + offset);
+		}
+
+		inline uint64 RecordSize(uint32 size)
+		{
+			return headerSize + ((static_cast<uint64>(size) + 7u) & ~static_cast<uint64>(7u));
+		}
+
+
+		//! Flush the data of a stream to the disk
+		void SyncToDisk(Yuni::IO::File::Stream& file)
+		{
+			FILE* handle = file.nativeHandle();
+			if (handle)
+			{
+				# ifdef YUNI_OS_WINDOWS
+				::_commit(::_fileno(handle));
+				# else
+				::fsync(::fileno(handle));
+				# endif
+			}
+		}
+
+	} // anonymous namespace
+
+
+
+
+	class AsyncWriter::WriterThread final : public Yuni::Thread::IThread
+	{
+	public:
+		explicit WriterThread(AsyncWriter& writer) :
+			pWriter(writer)
+		{}
+
+		virtual ~WriterThread()
+		{
+			stop();
+		}
+
+	protected:
+		virtual bool onExecute() override
+		{
+			pWriter.run();
+			return false;
+		}
+
+	private:
+		AsyncWriter& pWriter;
+
+	}; // class WriterThread
+
+
+	class AsyncWriter::FlushRequest final
+	{
+	public:
+		//! All the records before this position must be written
+		uint64 target;
+		//! True to wait for the data to be on disk
+		bool sync;
+		//! Signal to notify the waiting thread
+		Yuni::Thread::Signal done;
+
+	}; // class FlushRequest
+
+
+
+
+	AsyncWriter::AsyncWriter(uint capacity, IRecordFormat* format) :
+		pOverflow(static_cast<int>(Logs::Overflow::block)),
+		pWriteCursor(0),
+		pReadCursor(0),
+		pWrittenCursor(0),
+		pDropped(0),
+		pDroppedReported(0),
+		pSleeping(false),
+		pStopping(false),
+		pFlushRequestCount(0),
+		pOpened(false),
+		pFormat(format),
+		pThread(nullptr)
+	{
+		uint64 size = 4096;
+		while (size < capacity and size < (sizeMask + 1u))
+			size <<= 1;
+		pMask = size - 1;
+		pMaxMessageSize = static_cast<uint>(size / 4 - headerSize);
+
+		// the free area must read as zeroes (see drain())
+		pRing = new char[size];
+		::memset(pRing, 0, size);
+		pOutput = new char[outputCapacity];
+	}
+
+
+	AsyncWriter::~AsyncWriter()
+	{
+		if (pThread)
+		{
+			pStopping.store(true);
+			pWakeUp.notify();
+			pThread->wait();
+			delete pThread;
+		}
+		// in case the thread was not started
+		acknowledgeFlushRequests();
+		pFile.close();
+		delete[] pRing;
+		delete[] pOutput;
+	}
+
+
+
+
+	bool AsyncWriter::open(const AnyString& filename)
+	{
+		// the pending messages belong to the previous file
+		flush();
+
+		bool success;
+		{
+			Yuni::MutexLocker locker(pFileMutex);
+			pFile.close();
+			success = pFile.open(filename, Yuni::IO::OpenMode::write | Yuni::IO::OpenMode::append);
+			if (success and pFormat)
+			{
+				pFormat->reset();
+				if (Yuni::IO::File::Size(filename) == 0)
+				{
+					pFormat->begin(pConverted);
+					writeToFile(pConverted.data(), pConverted.size());
+					pConverted.clear();
+					pFile.flush();
+				}
+			}
+			pOpened.store(success);
+		}
+
+		if (success and not pThread)
+		{
+			pThread = new WriterThread(*this);
+			pThread->start();
+		}
+		return success;
+	}
+
+
+	void AsyncWriter::close()
+	{
+		flush();
+		Yuni::MutexLocker locker(pFileMutex);
+		pOpened.store(false);
+		pFile.close();
+	}
+
+
+	bool AsyncWriter::opened() const
+	{
+		return pOpened.load(std::memory_order_relaxed);
+	}
+
+
+	void AsyncWriter::overflow(Logs::Overflow policy)
+	{
+		pOverflow.store(static_cast<int>(policy), std::memory_order_relaxed);
+	}
+
+
+	Logs::Overflow AsyncWriter::overflow() const
+	{
+		return static_cast<Logs::Overflow>(pOverflow.load(std::memory_order_relaxed));
+	}
+
+
+	uint64 AsyncWriter::dropped() const
+	{
+		return pDropped.load(std::memory_order_relaxed);
+	}
+
+
+
+
+	inline void AsyncWriter::wakeUp()
+	{
+		// the store of the published header must be visible before reading
+		// the state of the background thread (see run())
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (pSleeping.load(std::memory_order_relaxed))
+			pWakeUp.notify();
+	}
+
+
+	bool AsyncWriter::push(const char* text, uint size)
+	{
+		if (YUNI_UNLIKELY(size > pMaxMessageSize))
+			size = pMaxMessageSize;
+
+		const uint64 capacity = pMask + 1;
+		const uint64 recordSize = RecordSize(size);
+		uint64 position;
+		uint64 offset;
+		uint attempt = 0;
+
+		// reserving the record
+		for (;;)
+		{
+			position = pWriteCursor.load(std::memory_order_relaxed);
+			offset = position & pMask;
+			// a record is never split: padding until the end of the ring if needed
+			uint64 required = recordSize;
+			if (offset + recordSize > capacity)
+				required += capacity - offset;
+
+			if (YUNI_LIKELY(position + required - pReadCursor.load(std::memory_order_acquire) <= capacity))
+			{
+				if (pWriteCursor.compare_exchange_weak(position, position + required, std::memory_order_relaxed))
+					break;
+				continue;
+			}
+
+			// the queue is full
+			if (attempt == 0)
+				pWakeUp.notify();
+			if (overflow() != Logs::Overflow::block)
+			{
+				pDropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			if (++attempt < 64)
+				continue;
+			// the background thread is busy writing, waiting for it
+			SuspendMilliSeconds(1);
+		}
+
+		if (offset + recordSize > capacity)
+		{
+			HeaderAt(pRing, offset).store(static_cast<uint32>(capacity - offset) | flagPadding | flagPublished,
+				std::memory_order_release);
+			offset = 0;
+		}
+
+		::memcpy(pRing + offset + headerSize, text, size);
+		HeaderAt(pRing, offset).store(size | flagPublished, std::memory_order_release);
+		wakeUp();
+		return true;
+	}
+
+
+	void AsyncWriter::flush(bool sync)
+	{
+		if (not pThread)
+			return;
+
+		FlushRequest request;
+		request.target = pWriteCursor.load(std::memory_order_acquire);
+		request.sync = sync;
+		if (not sync and pWrittenCursor.load(std::memory_order_acquire) >= request.target)
+			return;
+
+		{
+			Yuni::MutexLocker locker(pFlushMutex);
+			pFlushRequests.push_back(&request);
+			pFlushRequestCount.fetch_add(1);
+		}
+		pWakeUp.notify();
+		request.done.wait();
+	}
+
+
+
+
+	void AsyncWriter::writeToFile(const char* buffer, uint size)
+	{
+		// pFileMutex is locked
+		if (pFile.opened())
+			pFile.write(buffer, size);
+	}
+
+
+	inline void AsyncWriter::output(uint& outputSize, const char* message, uint size)
+	{
+		if (outputSize + size > static_cast<uint>(outputCapacity))
+		{
+			writeToFile(pOutput, outputSize);
+			outputSize = 0;
+		}
+		if (size > static_cast<uint>(outputCapacity))
+			writeToFile(message, size);
+		else
+		{
+			::memcpy(pOutput + outputSize, message, size);
+			outputSize += size;
+		}
+	}
+
+
+	bool AsyncWriter::drain()
+	{
+		uint64 read = pReadCursor.load(std::memory_order_relaxed);
+		const uint64 write = pWriteCursor.load(std::memory_order_acquire);
+		if (read == write)
+			return false;
+
+		Yuni::MutexLocker locker(pFileMutex);
+		uint outputSize = 0;
+		bool found = false;
+		uint64 released = read;
+
+		while (read != write)
+		{
+			uint64 offset = read & pMask;
+			uint32 header = HeaderAt(pRing, offset).load(std::memory_order_acquire);
+			if (not (header & flagPublished))
+				break; // a producer is still copying its message
+
+			uint64 recordSize;
+			if (header & flagPadding)
+			{
+				recordSize = header & sizeMask;
+			}
+			else
+			{
+				uint size = header & sizeMask;
+				const char* message = pRing + offset + headerSize;
+				if (not pFormat)
+					output(outputSize, message, size);
+				else
+				{
+					// the converted records are gathered into their own buffer
+					pFormat->append(pConverted, message, size);
+					if (pConverted.size() >= static_cast<uint>(outputCapacity))
+					{
+						writeToFile(pConverted.data(), pConverted.size());
+						pConverted.clear();
+					}
+				}
+				recordSize = RecordSize(size);
+			}
+
+			// releasing the record (the free area must read as zeroes)
+			::memset(pRing + offset, 0, static_cast<size_t>(recordSize));
+			read += recordSize;
+			found = true;
+			// the room is given back by blocks, to not bounce the cache line of
+			// the cursor between the producers and this thread for each record
+			if (read - released >= static_cast<uint64>(releaseBlockSize))
+			{
+				pReadCursor.store(read, std::memory_order_release);
+				released = read;
+			}
+		}
+		if (read != released)
+			pReadCursor.store(read, std::memory_order_release);
+
+		if (outputSize != 0)
+			writeToFile(pOutput, outputSize);
+		if (not pConverted.empty())
+		{
+			writeToFile(pConverted.data(), pConverted.size());
+			pConverted.clear();
+		}
+		if (found)
+		{
+			pFile.flush();
+			pWrittenCursor.store(read, std::memory_order_release);
+		}
+		return found;
+	}
+
+
+	void AsyncWriter::reportDroppedMessages()
+	{
+		uint64 dropped = pDropped.load(std::memory_order_relaxed);
+		if (dropped == pDroppedReported)
+			return;
+		uint64 count = dropped - pDroppedReported;
+		pDroppedReported = dropped;
+
+		if (overflow() == Logs::Overflow::count)
+		{
+			ShortString128 text;
+			text << "[logs] " << count << " message(s) discarded (full queue)";
+			# ifdef YUNI_OS_WINDOWS
+			text << "\r\n";
+			# else
+			text << '\n';
+			# endif
+			Yuni::MutexLocker locker(pFileMutex);
+			if (not pFormat)
+				writeToFile(text.data(), text.size());
+			else
+			{
+				pFormat->appendText(pConverted, text);
+				writeToFile(pConverted.data(), pConverted.size());
+				pConverted.clear();
+			}
+			pFile.flush();
+		}
+	}
+
+
+	void AsyncWriter::acknowledgeFlushRequests()
+	{
+		if (pFlushRequestCount.load() == 0)
+			return;
+
+		Yuni::MutexLocker locker(pFlushMutex);
+		const uint64 written = pWrittenCursor.load(std::memory_order_acquire);
+		const bool stopping = pStopping.load() or not pThread;
+		bool synced = false;
+
+		auto end = std::remove_if(pFlushRequests.begin(), pFlushRequests.end(), [&](FlushRequest* request) -> bool
+		{
+			if (request->target > written and not stopping)
+				return false;
+			if (request->sync and not synced)
+			{
+				Yuni::MutexLocker fileLocker(pFileMutex);
+				SyncToDisk(pFile);
+				synced = true;
+			}
+			request->done.notify();
+			return true;
+		});
+		pFlushRequestCount.fetch_sub(static_cast<uint>(pFlushRequests.end() - end));
+		pFlushRequests.erase(end, pFlushRequests.end());
+	}
+
+
+	void AsyncWriter::run()
+	{
+		for (;;)
+		{
+			bool found = drain();
+			reportDroppedMessages();
+			acknowledgeFlushRequests();
+			if (found)
+				continue;
+
+			if (pStopping.load())
+			{
+				// the producers are gone, but some may not have published their message yet
+				if (pReadCursor.load() == pWriteCursor.load())
+					break;
+				SuspendMilliSeconds(1);
+				continue;
+			}
+
+			// Nothing to do, waiting for a producer (see wakeUp())
+			pSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			uint64 read = pReadCursor.load(std::memory_order_relaxed);
+			bool idle = (HeaderAt(pRing, read & pMask).load(std::memory_order_acquire) & flagPublished) == 0
+				and pFlushRequestCount.load() == 0;
+			if (idle)
+				pWakeUp.wait(idleDelay);
+			pSleeping.store(false, std::memory_order_relaxed);
+			pWakeUp.reset();
+
+			// Gathering more messages before writing them, the producers do not
+			// wake the thread up meanwhile (except for a flush or a full queue)
+			if (idle and pFlushRequestCount.load() == 0 and not pStopping.load())
+				pWakeUp.wait(batchDelay);
+		}
+		acknowledgeFlushRequests();
+	}
+
+
+
+
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
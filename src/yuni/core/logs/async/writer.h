@@ -0,0 +1,240 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "../../noncopyable.h"
+#include "../../../thread/mutex.h"
+#include "../../../thread/signal.h"
+#include "../../../io/file.h"
+#include <atomic>
+#include <vector>
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	//! Behavior of the asynchronous log handlers when their queue is full
+	enum class Overflow
+	{
+		//! Wait for some room (no message is lost)
+		block,
+		//! Discard the message
+		drop,
+		//! Discard the message, and write the number of discarded messages as soon as possible
+		count,
+	};
+
+
+} // namespace Logs
+} // namespace Yuni
+
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+
+	/*!
+	** \brief Conversion of the records before being written (ex: binary logs)
+	**
+	** All methods are called with the file locked, from the background thread
+	** (or from the thread opening the file for `begin()` and `reset()`).
+	*/
+	class YUNI_DECL IRecordFormat
+	{
+	public:
+		//! Destructor
+		virtual ~IRecordFormat() {}
+
+		//! Forget all states, a new file has just been opened
+		virtual void reset() = 0;
+		//! Write the beginning of a new (empty) file
+		virtual void begin(Clob& out) = 0;
+		//! Convert a record
+		virtual void append(Clob& out, const char* record, uint size) = 0;
+		//! Convert a message from the writer itself (ex: discarded messages)
+		virtual void appendText(Clob& out, const AnyString& text) = 0;
+
+	}; // class IRecordFormat
+
+
+
+
+	/*!
+	** \brief Background writer for asynchronous log handlers
+	**
+	** The formatted messages are pushed into a bounded ring of bytes, without
+	** any lock: a producer reserves a record with a single CAS, copies the message,
+	** then publishes it. A background thread (started by `open()`) takes all
+	** published records at once and writes them with a few large writes.
+	**
+	** \internal A record is an 8-bytes header (size of the message and state,
+	**   0 while not published) followed by the message, aligned to 8 bytes. The
+	**   consumed records are zeroed by the background thread before being released,
+	**   thus any header in the free area reads as 'not published yet'.
+	*/
+	class YUNI_DECL AsyncWriter final : private NonCopyable<AsyncWriter>
+	{
+	public:
+		enum
+		{
+			//! Default capacity of the queue (in bytes)
+			defaultCapacity = 1024 * 1024,
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Constructor
+		**
+		** \param capacity Capacity of the queue in bytes (rounded up to a power of 2)
+		** \param format Conversion of the records (not owned, null to write them as they are)
+		*/
+		explicit AsyncWriter(uint capacity = defaultCapacity, IRecordFormat* format = nullptr);
+		//! Destructor (all pending messages are written)
+		~AsyncWriter();
+		//@}
+
+
+		//! \name Target file
+		//@{
+		/*!
+		** \brief Open a log file (append mode), and start the background thread if not already done
+		**
+		** The pending messages are written into the previous file before.
+		*/
+		bool open(const AnyString& filename);
+		//! Write all pending messages and close the file
+		void close();
+		//! Get if a file is opened
+		bool opened() const;
+		//@}
+
+
+		//! \name Messages
+		//@{
+		/*!
+		** \brief Push a formatted message (thread-safe, no lock)
+		**
+		** The message is truncated if larger than a quarter of the queue.
+		** \return False if the message has been discarded (full queue)
+		*/
+		bool push(const char* text, uint size);
+
+		/*!
+		** \brief Wait for all the messages pushed so far to be written
+		**
+		** \param sync True to also wait for the data to be on disk (fsync)
+		*/
+		void flush(bool sync = false);
+
+		//! Set the behavior when the queue is full
+		void overflow(Logs::Overflow policy);
+		//! Get the behavior when the queue is full
+		Logs::Overflow overflow() const;
+
+		//! Get the number of messages discarded so far (full queue)
+		uint64 dropped() const;
+		//@}
+
+
+	private:
+		class WriterThread;
+		class FlushRequest;
+
+		//! Body of the background thread
+		void run();
+		//! Write all published records, and get if some were found
+		bool drain();
+		//! Write a buffer to the file
+		void writeToFile(const char* buffer, uint size);
+		//! Append a message to the output buffer (written when full)
+		void output(uint& outputSize, const char* message, uint size);
+		//! Report the discarded messages (Overflow::count)
+		void reportDroppedMessages();
+		//! Acknowledge the flush requests which are completed
+		void acknowledgeFlushRequests();
+		//! Wake the background thread up if sleeping
+		void wakeUp();
+
+	private:
+		//! The ring of records
+		char* pRing;
+		//! Capacity of the ring minus 1 (power of 2)
+		uint64 pMask;
+		//! Maximum length of a message
+		uint pMaxMessageSize;
+		//! Behavior when the queue is full
+		std::atomic<int> pOverflow;
+
+		//! Padding, to not share the cache line of the cursors
+		char pPadding0[64];
+		//! Position of the next record to reserve (producers)
+		std::atomic<uint64> pWriteCursor;
+		//! Padding
+		char pPadding1[64 - sizeof(std::atomic<uint64>)];
+		//! Position of the next record to consume (background thread)
+		std::atomic<uint64> pReadCursor;
+		//! Position up to which the records have been written
+		std::atomic<uint64> pWrittenCursor;
+		//! Number of discarded messages
+		std::atomic<uint64> pDropped;
+		//! Number of discarded messages already reported
+		uint64 pDroppedReported;
+
+		//! True while the background thread is waiting for messages
+		std::atomic<bool> pSleeping;
+		//! True when the background thread must stop
+		std::atomic<bool> pStopping;
+		//! Signal for waking the background thread up
+		Yuni::Thread::Signal pWakeUp;
+
+		//! Pending flush requests
+		std::vector<FlushRequest*> pFlushRequests;
+		//! Number of pending flush requests
+		std::atomic<uint> pFlushRequestCount;
+		//! Mutex for the flush requests
+		Yuni::Mutex pFlushMutex;
+
+		//! The log file
+		Yuni::IO::File::Stream pFile;
+		//! True if the file is opened
+		std::atomic<bool> pOpened;
+		//! Mutex for the file (open / close / write)
+		Yuni::Mutex pFileMutex;
+		//! Buffer for coalescing the records
+		char* pOutput;
+		//! Conversion of the records (may be null)
+		IRecordFormat* pFormat;
+		//! Buffer for the converted records
+		Clob pConverted;
+
+		//! The background thread
+		WriterThread* pThread;
+
+	}; // class AsyncWriter
+
+
+
+
+
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,270 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "decoder.h"
+#include "format.h"
+#include <string.h>
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	using namespace Yuni::Private::LogImpl::BinaryLog;
+
+
+	namespace // anonymous
+	{
+
+		enum
+		{
+			//! Maximum size of a record (sanity check)
+			maxRecordSize = 64 * 1024 * 1024,
+		};
+
+		template<class T>
+		inline T ReadValue(const char* p)
+		{
+			T value;
+			::memcpy(&value, p, sizeof(T));
+			return value;
+		}
+
+	} // anonymous namespace
+
+
+
+
+	BinaryDecoder::BinaryDecoder() :
+		pTimestamp(0),
+		pLevel(0),
+		pDigits(static_cast<uint>(TimePrecision::microseconds)),
+		pError(false)
+	{}
+
+
+	BinaryDecoder::~BinaryDecoder()
+	{}
+
+
+	bool BinaryDecoder::open(const AnyString& filename)
+	{
+		close();
+		if (not pFile.open(filename))
+			return false;
+
+		char header[sizeof(magic)];
+		if (not read(header, static_cast<uint>(sizeof(header))) or 0 != ::memcmp(header, magic, sizeof(magic)))
+		{
+			pFile.close();
+			pError = true;
+			return false;
+		}
+		return true;
+	}
+
+
+	void BinaryDecoder::close()
+	{
+		pFile.close();
+		pLiterals.clear();
+		pMessage.clear();
+		pError = false;
+	}
+
+
+	bool BinaryDecoder::error() const
+	{
+		return pError;
+	}
+
+
+	sint64 BinaryDecoder::timestamp() const
+	{
+		return pTimestamp;
+	}
+
+
+	int BinaryDecoder::level() const
+	{
+		return pLevel;
+	}
+
+
+	void BinaryDecoder::precision(TimePrecision value)
+	{
+		pDigits = static_cast<uint>(value);
+	}
+
+
+	bool BinaryDecoder::read(void* buffer, uint size)
+	{
+		return size == pFile.read(static_cast<char*>(buffer), size);
+	}
+
+
+	const String& BinaryDecoder::literal(uint32 id) const
+	{
+		static const String unknown = "<?>";
+		return (id < pLiterals.size()) ? pLiterals[id] : unknown;
+	}
+
+
+	bool BinaryDecoder::next(Clob& line)
+	{
+		line.clear();
+		if (not pFile.opened() or pError)
+			return false;
+
+		for (;;)
+		{
+			char type;
+			if (not read(&type, 1))
+				return false; // end of file
+
+			switch (static_cast<uint8>(type))
+			{
+				case rtDefinition:
+				{
+					uint32 id;
+					uint32 size;
+					// the ids are dense from 0: either a new one (the next id) or a known one
+					if (not read(&id, 4) or not read(&size, 4) or size > maxRecordSize
+						or id > pLiterals.size())
+					{
+						pError = true;
+						return false;
+					}
+					if (id == pLiterals.size())
+						pLiterals.emplace_back();
+					String& text = pLiterals[id];
+					text.clear();
+					if (size != 0 and size != pFile.read(text, size))
+					{
+						pError = true;
+						return false;
+					}
+					continue;
+				}
+				case rtMessage:
+				{
+					uint32 size;
+					if (not read(&size, 4) or size < headerSize or size > maxRecordSize)
+					{
+						pError = true;
+						return false;
+					}
+					pMessage.clear();
+					if (size != pFile.read(pMessage, size))
+					{
+						pError = true;
+						return false;
+					}
+					render(line);
+					return true;
+				}
+				default:
+				{
+					pError = true;
+					return false;
+				}
+			}
+		}
+	}
+
+
+	void BinaryDecoder::render(Clob& line)
+	{
+		const char* p = pMessage.data();
+		const char* const end = p + pMessage.size();
+
+		pTimestamp = ReadValue<sint64>(p);
+		pLevel = ReadValue<sint32>(p + 8);
+		const String& name = literal(ReadValue<uint32>(p + 12));
+		p += headerSize;
+
+		char buffer[48];
+		line += '[';
+		line.append(buffer, Private::LogsDecorator::WriteTimestampToBuffer(buffer, pTimestamp, pDigits));
+		line += ']';
+		if (not name.empty())
+			line << '[' << name << ']';
+		line += ' ';
+
+		while (p < end)
+		{
+			const uint available = static_cast<uint>(end - p);
+			switch (static_cast<uint8>(*p))
+			{
+				case tagLiteral:
+				{
+					if (available < 1 + 4)
+						return;
+					line += literal(ReadValue<uint32>(p + 1));
+					p += 1 + 4;
+					break;
+				}
+				case tagString:
+				{
+					if (available < 1 + 4)
+						return;
+					uint32 size = ReadValue<uint32>(p + 1);
+					if (size > available - (1 + 4))
+						return;
+					line.append(p + 1 + 4, size);
+					p += 1 + 4 + size;
+					break;
+				}
+				case tagSigned:
+				case tagUnsigned:
+				case tagDouble:
+				case tagPointer:
+				{
+					if (available < 1 + 8)
+						return;
+					switch (static_cast<uint8>(*p))
+					{
+						case tagSigned:   line << ReadValue<sint64>(p + 1); break;
+						case tagUnsigned: line << ReadValue<uint64>(p + 1); break;
+						case tagDouble:   line << ReadValue<double>(p + 1); break;
+						default:          line << reinterpret_cast<const void*>(static_cast<uintptr_t>(ReadValue<uint64>(p + 1)));
+					}
+					p += 1 + 8;
+					break;
+				}
+				case tagBool:
+				{
+					if (available < 1 + 1)
+						return;
+					line << (p[1] != 0);
+					p += 1 + 1;
+					break;
+				}
+				case tagChar:
+				{
+					if (available < 1 + 1)
+						return;
+					line += p[1];
+					p += 1 + 1;
+					break;
+				}
+				default:
+					return;
+			}
+		}
+	}
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
@@ -0,0 +1,120 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "../../noncopyable.h"
+#include "../../../io/file.h"
+#include "../decorators/precisetime.h"
+#include <vector>
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	/*!
+	** \brief Reader for the binary log files (see BinaryFile)
+	**
+	** \code
+	** Logs::BinaryDecoder decoder;
+	** if (decoder.open("/var/log/myapp.ynlog"))
+	** {
+	**	Clob line;
+	**	while (decoder.next(line))
+	**		std::cout << line << '\n'; // [2016-03-01T17:42:05.012345+01:00][notice] Hello world !
+	** }
+	** \endcode
+	**
+	** The messages are rendered like a text log file. The file must have been written
+	** on a machine with the same byte order.
+	*/
+	class YUNI_DECL BinaryDecoder final : private NonCopyable<BinaryDecoder>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		BinaryDecoder();
+		//! Destructor
+		~BinaryDecoder();
+		//@}
+
+
+		//! \name File
+		//@{
+		/*!
+		** \brief Open a binary log file
+		**
+		** \return False if the file can not be opened or is not a binary log file
+		*/
+		bool open(const AnyString& filename);
+		//! Close the file
+		void close();
+		//@}
+
+
+		//! \name Messages
+		//@{
+		/*!
+		** \brief Read the next message, rendered as text (without end of line)
+		**
+		** \param[out] line The message
+		** \return False if there is no more message (or if the file is invalid, see `error()`)
+		*/
+		bool next(Clob& line);
+
+		//! Get the timestamp of the last message read (nanoseconds since epoch)
+		sint64 timestamp() const;
+		//! Get the verbosity level of the last message read
+		int level() const;
+
+		//! Get if the file is invalid (or truncated)
+		bool error() const;
+
+		//! Set the number of digits for the fraction of seconds (microseconds by default)
+		void precision(TimePrecision value);
+		//@}
+
+
+	private:
+		//! Read some bytes
+		bool read(void* buffer, uint size);
+		//! Render the message in `pMessage`
+		void render(Clob& line);
+		//! Get the text of a literal
+		const String& literal(uint32 id) const;
+
+	private:
+		//! The binary log file
+		Yuni::IO::File::Stream pFile;
+		//! The string literals (by id)
+		std::vector<String> pLiterals;
+		//! The current message
+		Clob pMessage;
+		//! Timestamp of the current message
+		sint64 pTimestamp;
+		//! Verbosity level of the current message
+		int pLevel;
+		//! Number of digits for the fraction of seconds
+		uint pDigits;
+		//! True if the file is invalid
+		bool pError;
+
+	}; // class BinaryDecoder
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
@@ -0,0 +1,91 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	/*!
+	** \brief Layout of the binary log files
+	**
+	** A file starts with `magic`, followed by records (native byte order):
+	**  - `rtDefinition`: uint32 id, uint32 size, text (a string literal)
+	**  - `rtMessage`: uint32 size, then the message
+	**
+	** A message is made of a header (sint64 timestamp in nanoseconds since epoch,
+	** sint32 verbosity level, uint32 id of the name of the verbosity) followed by
+	** items (a tag + a value). A definition always comes before its first use, and an
+	** id may be redefined (new session appended to an existing file).
+	**
+	** \internal In the queue (before being written), the literals are only their
+	**   address and their size (`literalSize`, 0 for a zero-terminated string), see BinaryFormat.
+	*/
+	enum RecordType : uint8
+	{
+		//! Definition of a string literal
+		rtDefinition = 'd',
+		//! A message
+		rtMessage = 'm',
+	};
+
+
+	//! Type of an item of a message
+	enum Tag : uint8
+	{
+		//! String literal (uint32 id)
+		tagLiteral = 1,
+		//! String (uint32 size + text)
+		tagString,
+		//! Signed integer (sint64)
+		tagSigned,
+		//! Unsigned integer (uint64)
+		tagUnsigned,
+		//! Floating point value (double)
+		tagDouble,
+		//! Boolean (uint8)
+		tagBool,
+		//! A single character
+		tagChar,
+		//! A pointer (uint64)
+		tagPointer,
+	};
+
+
+	enum
+	{
+		//! Size of the header of a message (in the file)
+		headerSize = 8 + 4 + 4,
+		//! Size of a literal in the queue (address + size)
+		literalSize = 8 + 4,
+		//! Size of the header of a message in the queue (the name of the verbosity is a literal)
+		queuedHeaderSize = 8 + 4 + literalSize,
+	};
+
+
+	//! Magic number at the beginning of a binary log file
+	static const char magic[8] = { 'y', 'n', 'b', 'l', 'o', 'g', '1', '\n' };
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,47 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "record.h"
+#include <stdlib.h>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	void Record::grow(uint size)
+	{
+		uint capacity = pCapacity * 2;
+		while (capacity < pSize + size)
+			capacity *= 2;
+
+		if (pData == pInline)
+		{
+			pData = static_cast<char*>(::malloc(capacity));
+			YUNI_MEMCPY(pData, capacity, pInline, pSize);
+		}
+		else
+			pData = static_cast<char*>(::realloc(pData, capacity));
+		pCapacity = capacity;
+	}
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
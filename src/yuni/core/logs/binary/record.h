@@ -0,0 +1,267 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "../../static/remove.h"
+#include "../literal.h"
+#include "format.h"
+#include <string>
+#include <string.h>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	/*!
+	** \brief A message being built, in its binary form (see format.h)
+	**
+	** Nothing is formatted: the values are copied as they are, the string
+	** literals (Logs::Literal) are only referenced by their address.
+	*/
+	class YUNI_DECL Record final
+	{
+	public:
+		enum
+		{
+			//! Capacity of the internal buffer (no allocation below)
+			inlineCapacity = 480,
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Constructor
+		**
+		** \param timestamp Time of the message (nanoseconds since epoch)
+		** \param level Verbosity level
+		** \param name Name of the verbosity level (a string literal)
+		*/
+		Record(sint64 timestamp, sint32 level, const char* name);
+		//! Copy constructor
+		Record(const Record& rhs);
+		//! Destructor
+		~Record();
+		//@}
+
+
+		//! \name Items
+		//@{
+		//! Append a string literal (or any static array), with the size of the array
+		void literal(const char* text, uint size);
+		//! Append a string (copied)
+		void string(const char* text, uint size);
+		//! Append a signed integer
+		void signedInteger(sint64 value);
+		//! Append an unsigned integer
+		void unsignedInteger(uint64 value);
+		//! Append a floating point value
+		void floating(double value);
+		//! Append a boolean
+		void boolean(bool value);
+		//! Append a single character
+		void character(char value);
+		//! Append a pointer (its address)
+		void pointer(const void* value);
+		//@}
+
+
+		//! \name Content
+		//@{
+		//! The raw record
+		AnyString data() const;
+		//@}
+
+
+		Record& operator = (const Record&) = delete;
+
+	private:
+		//! Reserve some bytes at the end of the record
+		char* reserve(uint size);
+		//! Write a tag and a value
+		template<class T> void write(uint8 tag, const T& value);
+		//! Increase the capacity of the record
+		void grow(uint size);
+
+	private:
+		//! The record
+		char* pData;
+		//! Size of the record
+		uint pSize;
+		//! Capacity of `pData`
+		uint pCapacity;
+		//! Internal buffer
+		char pInline[inlineCapacity];
+
+	}; // class Record
+
+
+
+
+	/*!
+	** \brief Conversion of a value into items of a record
+	**
+	** Any type without specialization is formatted as text (like a text log message).
+	** \tparam T The type of the value, without const qualifier
+	*/
+	template<class T>
+	struct Item final
+	{
+		static void Append(Record& record, const T& value)
+		{
+			CString<128> text;
+			text.append(value);
+			record.string(text.data(), text.size());
+		}
+	};
+
+	// string literal (referenced by its address)
+	template<>
+	struct Item<Logs::Literal> final
+	{
+		static void Append(Record& record, const Logs::Literal& value)
+		{
+			record.literal(value.text, value.size);
+		}
+	};
+
+	// char array (copied, up to the first zero like CString::append())
+	template<int N>
+	struct Item<char[N]> final
+	{
+		static void Append(Record& record, const char* value)
+		{
+			record.string(value, static_cast<uint>(::strnlen(value, static_cast<size_t>(N))));
+		}
+	};
+
+	// char*
+	template<>
+	struct Item<char*> final
+	{
+		static void Append(Record& record, const char* value)
+		{
+			if (value)
+				record.string(value, static_cast<uint>(::strlen(value)));
+		}
+	};
+
+	// string
+	template<uint ChunkSizeT, bool ExpandableT>
+	struct Item<CString<ChunkSizeT, ExpandableT> > final
+	{
+		static void Append(Record& record, const CString<ChunkSizeT, ExpandableT>& value)
+		{
+			record.string(value.data(), value.size());
+		}
+	};
+
+	// std::string
+	template<>
+	struct Item<std::string> final
+	{
+		static void Append(Record& record, const std::string& value)
+		{
+			record.string(value.data(), static_cast<uint>(value.size()));
+		}
+	};
+
+	// T*
+	template<class T>
+	struct Item<T*> final
+	{
+		static void Append(Record& record, const T* value)
+		{
+			record.pointer(reinterpret_cast<const void*>(value));
+		}
+	};
+
+	// nullptr
+	template<>
+	struct Item<YuniNullPtr> final
+	{
+		static void Append(Record&, const YuniNullPtr&)
+		{ /* Do nothing */ }
+	};
+
+	// bool
+	template<>
+	struct Item<bool> final
+	{
+		static void Append(Record& record, bool value) { record.boolean(value); }
+	};
+
+	// char
+	template<>
+	struct Item<char> final
+	{
+		static void Append(Record& record, char value) { record.character(value); }
+	};
+
+	// unsigned char
+	template<>
+	struct Item<unsigned char> final
+	{
+		static void Append(Record& record, unsigned char value) { record.character(static_cast<char>(value)); }
+	};
+
+	// double
+	template<>
+	struct Item<double> final
+	{
+		static void Append(Record& record, double value) { record.floating(value); }
+	};
+
+	// float (promoted to double)
+	template<>
+	struct Item<float> final
+	{
+		static void Append(Record& record, float value) { record.floating(static_cast<double>(value)); }
+	};
+
+
+	# define YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(TYPE, METHOD, CAST) \
+	template<> \
+	struct Item<TYPE> final \
+	{ \
+		static void Append(Record& record, TYPE value) { record.METHOD(static_cast<CAST>(value)); } \
+	}
+
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(sint16, signedInteger, sint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(sint32, signedInteger, sint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(sint64, signedInteger, sint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(uint16, unsignedInteger, uint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(uint32, unsignedInteger, uint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(uint64, unsignedInteger, uint64);
+	# ifdef YUNI_HAS_LONG
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(long, signedInteger, sint64);
+	YUNI_PRIVATE_LOGS_BINARY_ITEM_INT(unsigned long, unsignedInteger, uint64);
+	# endif
+
+	# undef YUNI_PRIVATE_LOGS_BINARY_ITEM_INT
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
+
+#include "record.hxx"
@@ -0,0 +1,145 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "record.h"
+#include <string.h>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	inline Record::Record(sint64 timestamp, sint32 level, const char* name) :
+		pData(pInline),
+		pSize(8 + 4),
+		pCapacity(inlineCapacity)
+	{
+		::memcpy(pData, &timestamp, 8);
+		::memcpy(pData + 8, &level, 4);
+		// the name of the verbosity level is a zero-terminated literal (see format.h)
+		uint64 address = reinterpret_cast<uintptr_t>(name);
+		uint32 size = 0;
+		::memcpy(pData + 12, &address, 8);
+		::memcpy(pData + 20, &size, 4);
+		pSize += literalSize;
+	}
+
+
+	inline Record::Record(const Record& rhs) :
+		pData(pInline),
+		pSize(0),
+		pCapacity(inlineCapacity)
+	{
+		::memcpy(reserve(rhs.pSize), rhs.pData, rhs.pSize);
+	}
+
+
+	inline Record::~Record()
+	{
+		if (pData != pInline)
+			::free(pData);
+	}
+
+
+	inline char* Record::reserve(uint size)
+	{
+		if (YUNI_UNLIKELY(pSize + size > pCapacity))
+			grow(size);
+		char* p = pData + pSize;
+		pSize += size;
+		return p;
+	}
+
+
+	template<class T>
+	inline void Record::write(uint8 tag, const T& value)
+	{
+		char* p = reserve(1 + sizeof(T));
+		*p = static_cast<char>(tag);
+		::memcpy(p + 1, &value, sizeof(T));
+	}
+
+
+	inline void Record::literal(const char* text, uint size)
+	{
+		char* p = reserve(1 + literalSize);
+		uint64 address = reinterpret_cast<uintptr_t>(text);
+		uint32 length = size;
+		*p = static_cast<char>(tagLiteral);
+		::memcpy(p + 1, &address, 8);
+		::memcpy(p + 9, &length, 4);
+	}
+
+
+	inline void Record::string(const char* text, uint size)
+	{
+		char* p = reserve(1 + 4 + size);
+		uint32 length = size;
+		*p = static_cast<char>(tagString);
+		::memcpy(p + 1, &length, 4);
+		::memcpy(p + 5, text, size);
+	}
+
+
+	inline void Record::signedInteger(sint64 value)
+	{
+		write(tagSigned, value);
+	}
+
+
+	inline void Record::unsignedInteger(uint64 value)
+	{
+		write(tagUnsigned, value);
+	}
+
+
+	inline void Record::floating(double value)
+	{
+		write(tagDouble, value);
+	}
+
+
+	inline void Record::boolean(bool value)
+	{
+		write(tagBool, static_cast<uint8>(value ? 1 : 0));
+	}
+
+
+	inline void Record::character(char value)
+	{
+		write(tagChar, value);
+	}
+
+
+	inline void Record::pointer(const void* value)
+	{
+		write(tagPointer, static_cast<uint64>(reinterpret_cast<uintptr_t>(value)));
+	}
+
+
+	inline AnyString Record::data() const
+	{
+		return AnyString(pData, pSize);
+	}
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
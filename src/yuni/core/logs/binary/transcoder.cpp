@@ -0,0 +1,215 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "transcoder.h"
+#include "format.h"
+#include "record.h"
+#include "../verbosity.h"
+#include "../decorators/precisetime.h"
+#include <string.h>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	namespace // anonymous
+	{
+
+		//! An address which can not be the one of a literal
+		static const uint64 invalidAddress = static_cast<uint64>(-1);
+
+	} // anonymous namespace
+
+
+
+
+	BinaryFormat::BinaryFormat()
+	{
+		reset();
+	}
+
+
+	BinaryFormat::~BinaryFormat()
+	{}
+
+
+	void BinaryFormat::reset()
+	{
+		// the definitions must be written again into the new file
+		pLiterals.clear();
+		for (uint i = 0; i != static_cast<uint>(cacheSize); ++i)
+			pCache[i].address = invalidAddress;
+	}
+
+
+	void BinaryFormat::begin(Clob& out)
+	{
+		out.append(magic, static_cast<uint>(sizeof(magic)));
+	}
+
+
+	uint32 BinaryFormat::literal(uint64 address, uint32 size)
+	{
+		CacheEntry& entry = pCache[((address >> 3) ^ (address >> 12)) & (cacheSize - 1)];
+		if (YUNI_LIKELY(entry.address == address))
+			return entry.id;
+
+		auto result = pLiterals.try_emplace(address, static_cast<uint32>(pLiterals.size()));
+		const uint32 id = result.first->second;
+		entry.address = address;
+		entry.id = id;
+		if (result.second)
+		{
+			const char* text = reinterpret_cast<const char*>(static_cast<uintptr_t>(address));
+			uint32 length;
+			if (not text)
+				length = 0;
+			else if (size == 0)
+				length = static_cast<uint32>(::strlen(text));
+			else
+				length = (text[size - 1] == '\0') ? size - 1 : size; // like CString::append()
+
+			pDefinitions.put(static_cast<char>(rtDefinition));
+			pDefinitions.append(reinterpret_cast<const char*>(&id), 4);
+			pDefinitions.append(reinterpret_cast<const char*>(&length), 4);
+			pDefinitions.append(text, length);
+		}
+		return id;
+	}
+
+
+	void BinaryFormat::append(Clob& out, const char* record, uint size)
+	{
+		if (size < static_cast<uint>(queuedHeaderSize))
+			return;
+
+		// the converted message is never larger than the record (a literal is replaced by its id)
+		const uint start = out.size();
+		out.resize(start + 1 + 4 + size);
+		char* const message = const_cast<char*>(out.data()) + start + 1 + 4;
+		char* w = message;
+		const char* p = record;
+		const char* const end = record + size;
+		uint64 address;
+		uint32 length;
+		uint32 id;
+		pDefinitions.clear();
+
+		// header: timestamp, level, name of the verbosity level
+		::memcpy(w, p, 8 + 4);
+		::memcpy(&address, p + 12, 8);
+		::memcpy(&length, p + 20, 4);
+		id = literal(address, length);
+		::memcpy(w + 12, &id, 4);
+		w += headerSize;
+		p += queuedHeaderSize;
+
+		// items (the record may have been truncated by the queue)
+		while (p < end)
+		{
+			const uint available = static_cast<uint>(end - p);
+			uint itemSize = 0;
+			switch (static_cast<uint8>(*p))
+			{
+				case tagLiteral:
+				{
+					if (available >= 1u + literalSize)
+					{
+						::memcpy(&address, p + 1, 8);
+						::memcpy(&length, p + 9, 4);
+						id = literal(address, length);
+						*w = static_cast<char>(tagLiteral);
+						::memcpy(w + 1, &id, 4);
+						w += 1 + 4;
+						p += 1 + literalSize;
+						continue;
+					}
+					break;
+				}
+				case tagString:
+				{
+					if (available >= 1u + 4u)
+					{
+						::memcpy(&length, p + 1, 4);
+						if (length <= available - (1u + 4u))
+							itemSize = 1 + 4 + length;
+						else
+						{
+							// truncated by the queue, keeping the beginning of the string
+							length = available - (1u + 4u);
+							*w = static_cast<char>(tagString);
+							::memcpy(w + 1, &length, 4);
+							::memcpy(w + 1 + 4, p + 1 + 4, length);
+							w += 1 + 4 + length;
+							p = end;
+							continue;
+						}
+					}
+					break;
+				}
+				case tagSigned:
+				case tagUnsigned:
+				case tagDouble:
+				case tagPointer:
+					itemSize = 1 + 8;
+					break;
+				case tagBool:
+				case tagChar:
+					itemSize = 1 + 1;
+					break;
+			}
+			if (itemSize == 0 or itemSize > available)
+				break; // invalid or truncated
+			::memcpy(w, p, itemSize);
+			w += itemSize;
+			p += itemSize;
+		}
+
+		const uint32 messageSize = static_cast<uint32>(w - message);
+		char* const header = message - (1 + 4);
+		*header = static_cast<char>(rtMessage);
+		::memcpy(header + 1, &messageSize, 4);
+		out.truncate(start + 1 + 4 + messageSize);
+
+		// the definitions of the new literals must come first
+		if (YUNI_UNLIKELY(not pDefinitions.empty()))
+			out.insert(start, pDefinitions);
+	}
+
+
+	void BinaryFormat::appendText(Clob& out, const AnyString& text)
+	{
+		sint64 timestamp = Private::LogsDecorator::NowNanoSeconds();
+		sint32 level = Logs::Verbosity::Warning::level;
+		uint32 length = text.size();
+		while (length != 0 and (text[length - 1] == '\n' or text[length - 1] == '\r'))
+			--length;
+
+		// built as a queued record, with the verbosity name as literal
+		Record record(timestamp, level, Logs::Verbosity::Warning::Name());
+		record.string(text.c_str(), length);
+		AnyString data = record.data();
+		append(out, data.c_str(), data.size());
+	}
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
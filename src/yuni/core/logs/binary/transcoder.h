@@ -0,0 +1,84 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "../../hash/flat.h"
+#include "../async/writer.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+namespace BinaryLog
+{
+
+	/*!
+	** \brief Conversion of the queued records into the binary log format (background thread)
+	**
+	** The string literals are referenced by their address in the queue. They are
+	** replaced by an id, the text being written once per file (`rtDefinition`).
+	*/
+	class YUNI_DECL BinaryFormat final : public IRecordFormat
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		BinaryFormat();
+		//! Destructor
+		virtual ~BinaryFormat();
+		//@}
+
+		virtual void reset() override;
+		virtual void begin(Clob& out) override;
+		virtual void append(Clob& out, const char* record, uint size) override;
+		virtual void appendText(Clob& out, const AnyString& text) override;
+
+	private:
+		//! Get the id of a literal, and add its definition if not already done
+		uint32 literal(uint64 address, uint32 size);
+
+	private:
+		enum
+		{
+			//! Number of entries of the cache of literals (power of 2)
+			cacheSize = 256,
+		};
+
+		//! An entry of the cache of literals
+		struct CacheEntry final
+		{
+			uint64 address;
+			uint32 id;
+		};
+
+	private:
+		//! Id of all literals defined so far (by address)
+		Hash::Flat<uint64, uint32> pLiterals;
+		//! The most recently used literals (direct-mapped, in front of `pLiterals`)
+		CacheEntry pCache[cacheSize];
+		//! Definitions of the new literals of the message being converted
+		Clob pDefinitions;
+
+	}; // class BinaryFormat
+
+
+
+
+} // namespace BinaryLog
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
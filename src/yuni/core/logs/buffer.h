@@ -11,6 +11,10 @@
 #pragma once
 #include "../../yuni.h"
 #include "../string.h"
+#include "../static/remove.h"
+#include "literal.h"
+#include "binary/record.h"
+#include "decorators/precisetime.h"
 
 
 
@@ -25,6 +29,30 @@ namespace LogImpl
 	template<class LogT, class V, int E = V::enabled> class Buffer;
 
 
+	/*!
+	** \brief Kind of buffer for a verbosity level (0: disabled, 1: text, 2: binary)
+	**
+	** The binary mode is selected when the handlers have the setting
+	** `binaryFormat` (see Logs::BinaryFile).
+	*/
+	template<class Handlers, class V>
+	class BufferMode final
+	{
+		typedef struct {char a[2];}   TrueType;
+		typedef char  FalseType;
+		template<int> struct Helper;
+
+		template<class C> static TrueType  deduce(C*, Helper<C::binaryFormat>* = 0);
+		template<class C> static FalseType deduce(...);
+
+	public:
+		enum
+		{
+			value = (0 == V::enabled) ? 0 : ((sizeof(deduce<Handlers>(0)) == sizeof(TrueType)) ? 2 : 1),
+		};
+	};
+
+
 
 
 	/*!
@@ -57,7 +85,7 @@ namespace LogImpl
 		inline Buffer(const LoggerType& l, U u) :
 			pLogger(l)
 		{
-			pBuffer.append(u);
+			*this << u;
 		}
 
 		~Buffer()
@@ -75,6 +103,12 @@ namespace LogImpl
 			return *this;
 		}
 
+		Buffer& operator << (const Logs::Literal& u)
+		{
+			pBuffer.append(u.text, u.length());
+			return *this;
+		}
+
 		void appendFormat(const char f[], ...)
 		{
 			va_list parg;
@@ -108,6 +142,78 @@ namespace LogImpl
 
 
 
+	/*!
+	** \brief The buffer for the message, in its binary form
+	**
+	** \internal The values are only copied into a record, dispatched to the
+	**   handlers when this class is destroyed (see Logs::BinaryFile).
+	*/
+	template<class LogT, class V>
+	class YUNI_DECL Buffer<LogT, V, 2> final
+	{
+	public:
+		//! Type of the calling logger
+		typedef LogT LoggerType;
+
+	public:
+		//! \name Constructos & Destructor
+		//@{
+		inline Buffer(const LoggerType& l) :
+			pLogger(l),
+			pRecord(Yuni::Private::LogsDecorator::NowNanoSeconds(), V::level, V::Name())
+		{}
+
+		template<typename U>
+		inline Buffer(const LoggerType& l, U u) :
+			pLogger(l),
+			pRecord(Yuni::Private::LogsDecorator::NowNanoSeconds(), V::level, V::Name())
+		{
+			*this << u;
+		}
+
+		~Buffer()
+		{
+			// Dispatching the record to the handlers
+			pLogger.template dispatchMessageToHandlers<V>(pRecord.data());
+		}
+		//@}
+
+		template<typename U> Buffer& operator << (const U& u)
+		{
+			// Appending the value as it is
+			BinaryLog::Item<typename Static::Remove::Const<U>::Type>::Append(pRecord, u);
+			return *this;
+		}
+
+		void appendFormat(const char f[], ...)
+		{
+			va_list parg;
+			va_start(parg, f);
+			vappendFormat(f, parg);
+			va_end(parg);
+		}
+
+		void vappendFormat(const char f[], va_list parg)
+		{
+			Yuni::CString<256> text;
+			text.vappendFormat(f, parg);
+			pRecord.string(text.data(), text.size());
+		}
+
+
+	private:
+		//! Reference to the original logger
+		const LoggerType& pLogger;
+		//! The message
+		BinaryLog::Record pRecord;
+
+	}; // class Buffer
+
+
+
+
+
+
 	// Specialization when a verbosty level is disabled
 	template<class LogT, class V>
 	class YUNI_DECL Buffer<LogT, V, 0> final
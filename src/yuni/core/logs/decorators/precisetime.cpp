@@ -0,0 +1,236 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "../../system/windows.hdr.h"
+#include "precisetime.h"
+#include <time.h>
+#include <string.h>
+#include <atomic>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogsDecorator
+{
+
+	namespace // anonymous
+	{
+
+		enum : sint64
+		{
+			nanosecondsPerSecond = 1000000000,
+		};
+
+
+		//! The formatted date for the current second (per thread)
+		struct DateCache final
+		{
+			//! The second (since epoch) of the formatted date (-1 if none)
+			sint64 second;
+			//! Length of the formatted date
+			uint length;
+			//! Length of the timezone
+			uint zoneLength;
+			//! The date ('YYYY-MM-DDThh:mm:ss')
+			char date[24];
+			//! The timezone ('+hh:mm')
+			char zone[8];
+		};
+
+		static thread_local DateCache dateCache = { -1, 0, 0, {}, {} };
+
+		//! The last second when the anchor has been checked (per thread)
+		static thread_local sint64 anchorCheck = -1;
+
+
+
+		//! Monotonic clock (ns)
+		inline sint64 MonotonicNow()
+		{
+			# ifdef YUNI_OS_WINDOWS
+			static const sint64 frequency = []() -> sint64
+			{
+				LARGE_INTEGER f;
+				::QueryPerformanceFrequency(&f);
+				return static_cast<sint64>(f.QuadPart);
+			}();
+			LARGE_INTEGER counter;
+			::QueryPerformanceCounter(&counter);
+			sint64 c = static_cast<sint64>(counter.QuadPart);
+			return (c / frequency) * nanosecondsPerSecond + ((c % frequency) * nanosecondsPerSecond) / frequency;
+			# else
+			struct timespec ts;
+			::clock_gettime(CLOCK_MONOTONIC, &ts);
+			return static_cast<sint64>(ts.tv_sec) * nanosecondsPerSecond + ts.tv_nsec;
+			# endif
+		}
+
+
+		//! Wall clock (ns since epoch)
+		inline sint64 RealtimeNow()
+		{
+			# ifdef YUNI_OS_WINDOWS
+			FILETIME ft;
+			::GetSystemTimeAsFileTime(&ft);
+			sint64 t = (static_cast<sint64>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+			// 100ns intervals since 1601-01-01
+			return (t - 116444736000000000LL) * 100;
+			# else
+			struct timespec ts;
+			::clock_gettime(CLOCK_REALTIME, &ts);
+			return static_cast<sint64>(ts.tv_sec) * nanosecondsPerSecond + ts.tv_nsec;
+			# endif
+		}
+
+
+		//! Difference between the wall clock and the monotonic clock
+		std::atomic<sint64>& Anchor()
+		{
+			static std::atomic<sint64> anchor(RealtimeNow() - MonotonicNow());
+			return anchor;
+		}
+
+
+		inline void Write2Digits(char* buffer, int value)
+		{
+			buffer[0] = static_cast<char>('0' + (value / 10) % 10);
+			buffer[1] = static_cast<char>('0' + value % 10);
+		}
+
+
+		//! Format the date and the timezone of a given second
+		void FormatDate(DateCache& cache, sint64 second)
+		{
+			struct tm t;
+			long offset; // seconds east of UTC
+
+			# if defined(YUNI_OS_MSVC)
+			__time64_t rawtime = static_cast<__time64_t>(second);
+			_localtime64_s(&t, &rawtime);
+			# elif defined(YUNI_OS_MINGW)
+			time_t rawtime = static_cast<time_t>(second);
+			// localtime() is thread-safe with the Microsoft C library
+			t = *::localtime(&rawtime);
+			# else
+			time_t rawtime = static_cast<time_t>(second);
+			::localtime_r(&rawtime, &t);
+			# endif
+
+			# ifdef YUNI_OS_WINDOWS
+			long bias = 0;
+			long dstbias = 0;
+			_get_timezone(&bias);
+			if (t.tm_isdst > 0)
+				_get_dstbias(&dstbias);
+			offset = -(bias + dstbias);
+			# else
+			offset = static_cast<long>(t.tm_gmtoff);
+			# endif
+
+			char* p = cache.date;
+			int year = t.tm_year + 1900;
+			Write2Digits(p, year / 100);
+			Write2Digits(p + 2, year);
+			p[4] = '-';
+			Write2Digits(p + 5, t.tm_mon + 1);
+			p[7] = '-';
+			Write2Digits(p + 8, t.tm_mday);
+			p[10] = 'T';
+			Write2Digits(p + 11, t.tm_hour);
+			p[13] = ':';
+			Write2Digits(p + 14, t.tm_min);
+			p[16] = ':';
+			Write2Digits(p + 17, t.tm_sec);
+			cache.length = 19;
+
+			char* z = cache.zone;
+			z[0] = (offset < 0) ? '-' : '+';
+			if (offset < 0)
+				offset = -offset;
+			Write2Digits(z + 1, static_cast<int>(offset / 3600));
+			z[3] = ':';
+			Write2Digits(z + 4, static_cast<int>((offset / 60) % 60));
+			cache.zoneLength = 6;
+			cache.second = second;
+		}
+
+	} // anonymous namespace
+
+
+
+
+	sint64 NowNanoSeconds()
+	{
+		sint64 now = Anchor().load(std::memory_order_relaxed) + MonotonicNow();
+		sint64 second = now / nanosecondsPerSecond;
+
+		if (YUNI_UNLIKELY(second != anchorCheck))
+		{
+			// once per second: checking that the monotonic clock did not drift
+			// away from the system clock (time adjusted by the administrator...)
+			sint64 realtime = RealtimeNow();
+			sint64 gap = realtime - now;
+			if (gap > nanosecondsPerSecond or gap < -nanosecondsPerSecond)
+			{
+				Anchor().store(realtime - MonotonicNow(), std::memory_order_relaxed);
+				now = realtime;
+			}
+			anchorCheck = now / nanosecondsPerSecond;
+		}
+		return now;
+	}
+
+
+	uint WriteTimestampToBuffer(char* buffer, sint64 nanoseconds, uint digits)
+	{
+		sint64 second = nanoseconds / nanosecondsPerSecond;
+		DateCache& cache = dateCache;
+		if (YUNI_UNLIKELY(second != cache.second))
+			FormatDate(cache, second);
+
+		::memcpy(buffer, cache.date, cache.length);
+		uint size = cache.length;
+
+		if (digits != 0)
+		{
+			if (digits > 9)
+				digits = 9;
+			uint fraction = static_cast<uint>(nanoseconds - second * nanosecondsPerSecond);
+			for (uint i = digits; i < 9; ++i)
+				fraction /= 10;
+
+			buffer[size] = '.';
+			for (uint i = digits; i != 0; --i)
+			{
+				buffer[size + i] = static_cast<char>('0' + fraction % 10);
+				fraction /= 10;
+			}
+			size += digits + 1;
+		}
+
+		::memcpy(buffer + size, cache.zone, cache.zoneLength);
+		return size + cache.zoneLength;
+	}
+
+
+	uint WritePreciseTimestampToBuffer(char* buffer, uint digits)
+	{
+		return WriteTimestampToBuffer(buffer, NowNanoSeconds(), digits);
+	}
+
+
+
+
+} // namespace LogsDecorator
+} // namespace Private
+} // namespace Yuni
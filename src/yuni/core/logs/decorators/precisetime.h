@@ -0,0 +1,120 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../null.h"
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	//! Number of digits for the fraction of seconds of a timestamp
+	enum class TimePrecision
+	{
+		seconds = 0,
+		milliseconds = 3,
+		microseconds = 6,
+		nanoseconds = 9,
+	};
+
+
+} // namespace Logs
+} // namespace Yuni
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogsDecorator
+{
+
+	/*!
+	** \brief Write the current local time in ISO-8601 format (ex: 2016-03-01T17:42:05.012345+01:00)
+	**
+	** \param buffer A buffer of at least 48 bytes (not zero-terminated)
+	** \param digits Number of digits for the fraction of seconds (0..9)
+	** \return The number of bytes written
+	*/
+	YUNI_DECL uint WritePreciseTimestampToBuffer(char* buffer, uint digits);
+
+	/*!
+	** \brief Write a given time in ISO-8601 format (local time)
+	**
+	** \param buffer A buffer of at least 48 bytes (not zero-terminated)
+	** \param nanoseconds Nanoseconds since epoch
+	** \param digits Number of digits for the fraction of seconds (0..9)
+	** \return The number of bytes written
+	*/
+	YUNI_DECL uint WriteTimestampToBuffer(char* buffer, sint64 nanoseconds, uint digits);
+
+	/*!
+	** \brief Get the current time (nanoseconds since epoch)
+	**
+	** The time is derived from a monotonic clock, anchored on the wall clock (see PreciseTime).
+	*/
+	YUNI_DECL sint64 NowNanoSeconds();
+
+} // namespace LogsDecorator
+} // namespace Private
+} // namespace Yuni
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	/*!
+	** \brief Decorator: Local time in ISO-8601 format, with a fraction of seconds
+	**
+	** \code
+	** Logs::Logger<Logs::StdCout<>, Logs::PreciseTime<Logs::VerbosityLevel<Logs::Message<> > > > logs;
+	** logs.notice() << "Hello world !"; // [2016-03-01T17:42:05.012345+01:00][notic] Hello world !
+	** \endcode
+	**
+	** The date is formatted once per second and per thread, only the fraction
+	** of seconds is written for each message. The time is derived from a monotonic
+	** clock (anchored on the wall clock), thus the messages are properly ordered
+	** even if the system clock is slightly adjusted. The anchor follows the
+	** system clock when the gap exceeds one second.
+	**
+	** \tparam PrecisionT Number of digits for the fraction of seconds
+	*/
+	template<class LeftType = NullDecorator, TimePrecision PrecisionT = TimePrecision::microseconds>
+	class YUNI_DECL PreciseTime : public LeftType
+	{
+	public:
+		template<class Handler, class VerbosityType, class O>
+		void internalDecoratorAddPrefix(O& out, const AnyString& s) const
+		{
+			char buffer[48];
+			uint size = Private::LogsDecorator::WritePreciseTimestampToBuffer(buffer, static_cast<uint>(PrecisionT));
+
+			out.put('[');
+			out.write(buffer, size);
+			out.put(']');
+
+			// Transmit the message to the next decorator
+			LeftType::template internalDecoratorAddPrefix<Handler, VerbosityType,O>(out, s);
+		}
+
+	}; // class PreciseTime
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
@@ -10,6 +10,7 @@
 */
 #include "../../system/windows.hdr.h"
 #include <time.h>
+#include <string.h>
 #ifdef YUNI_OS_WINDOWS
 # include <wchar.h>
 #endif
@@ -41,6 +42,21 @@ namespace LogsDecorator
 
 	# else
 
+	namespace // anonymous
+	{
+
+		//! The last formatted timestamp (per thread)
+		struct TimestampCache final
+		{
+			sint64 rawtime;
+			char text[32];
+		};
+
+		static thread_local TimestampCache timestampCache = { -1, {} };
+
+	} // anonymous namespace
+
+
 	void WriteCurrentTimestampToBuffer(char buffer[32])
 	{
 		# ifdef YUNI_OS_MSVC
@@ -49,6 +65,14 @@ namespace LogsDecorator
 		time_t rawtime = ::time(nullptr);
 		# endif
 
+		// The date is only formatted once per second
+		TimestampCache& cache = timestampCache;
+		if (static_cast<sint64>(rawtime) == cache.rawtime)
+		{
+			::memcpy(buffer, cache.text, 32);
+			return;
+		}
+
 		struct tm timeinfo;
 
 		# if defined(YUNI_OS_MSVC)
@@ -61,6 +85,9 @@ namespace LogsDecorator
 		::localtime_r(&rawtime, &timeinfo);
 		::asctime_r(&timeinfo, buffer);
 		# endif
+
+		::memcpy(cache.text, buffer, 32);
+		cache.rawtime = static_cast<sint64>(rawtime);
 	}
 
 	# endif
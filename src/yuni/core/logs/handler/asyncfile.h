@@ -0,0 +1,157 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../null.h"
+#include "../async/writer.h"
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	/*!
+	** \brief Log Handler: Single log file, written by a background thread
+	**
+	** The messages are formatted by the calling thread (into a per-thread buffer)
+	** and pushed into a lock-free bounded queue. A background thread writes them
+	** with a few large writes, thus logging costs a copy instead of a write and
+	** a flush per message.
+	**
+	** \code
+	** Logs::Logger<Logs::AsyncFile<> > logs;
+	** logs.logfile("/var/log/myapp.log");
+	** logs.overflow(Logs::Overflow::drop); // never wait when the queue is full
+	** logs.notice() << "Hello world !";
+	** \endcode
+	**
+	** The fatal messages are written to the disk (fsync) before the return
+	** of the logging call. `flush()` does the same for all pending messages.
+	**
+	** The handler is thread-safe by itself: with `Policy::SingleThreaded` as
+	** threading policy for the logger (and if all other handlers and decorators are
+	** thread-safe), the producers never lock.
+	*/
+	template<class NextHandler = NullHandler>
+	class YUNI_DECL AsyncFile : public NextHandler
+	{
+	public:
+		enum Settings
+		{
+			// Colors are not allowed in a file
+			colorsAllowed = 0,
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		AsyncFile();
+		//! Destructor (all pending messages are written)
+		~AsyncFile();
+		//@}
+
+		/*!
+		** \brief Try to (re)open a target log file
+		**
+		** You should use an absolute filename to be able to safely reopen it.
+		** If a log file was already opened, it will be closed before anything else.
+		** If the given filename is empty, true will be returned.
+		**
+		** \param filename A relative or absolute filename
+		** \return True if the operation succeeded, false otherwise
+		*/
+		bool logfile(const AnyString& filename);
+
+		/*!
+		** \brief Get the last opened log file
+		*/
+		String logfile() const;
+
+		/*!
+		** \brief Reopen the log file
+		**
+		** It is safe to call several times this routine.
+		** True will be returned if the log filename is empty.
+		*/
+		bool reopenLogfile();
+
+		/*!
+		** \brief Close the log file
+		**
+		** It is safe to call several times this routine.
+		*/
+		void closeLogfile();
+
+		/*!
+		** \brief Get if a log file is opened
+		*/
+		bool logfileIsOpened() const;
+
+		/*!
+		** \brief Wait for all pending messages to be written
+		**
+		** \param sync True to also wait for the data to be on disk (fsync)
+		*/
+		void flush(bool sync = false) const;
+
+		/*!
+		** \brief Set the capacity of the queue (in bytes, 1MiB by default)
+		**
+		** This value is only taken into account by the first call to `logfile()`.
+		*/
+		void queueCapacity(uint bytes);
+
+		//! Set the behavior when the queue is full (Overflow::block by default)
+		void overflow(Overflow policy);
+		//! Get the behavior when the queue is full
+		Overflow overflow() const;
+
+		//! Get the number of messages discarded so far (full queue)
+		uint64 droppedMessages() const;
+
+
+	public:
+		template<class LoggerT, class VerbosityType>
+		void internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const;
+
+	protected:
+		/*!
+		** \brief Constructor with a conversion of the messages before being written
+		**
+		** \param format The conversion (owned by the handler)
+		*/
+		explicit AsyncFile(Private::LogImpl::IRecordFormat* format);
+
+	protected:
+		//! The originale filename
+		String pOutputFilename;
+		//! The background writer (created on the first call to `logfile()`)
+		Private::LogImpl::AsyncWriter* pWriter;
+		//! Capacity of the queue
+		uint pQueueCapacity;
+		//! Behavior when the queue is full
+		Overflow pOverflow;
+		//! Conversion of the messages (may be null)
+		Private::LogImpl::IRecordFormat* pFormat;
+
+	}; // class AsyncFile
+
+
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
+
+#include "asyncfile.hxx"
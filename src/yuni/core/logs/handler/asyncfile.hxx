@@ -0,0 +1,174 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "asyncfile.h"
+#include "../verbosity.h"
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	template<class NextHandler>
+	inline AsyncFile<NextHandler>::AsyncFile() :
+		pWriter(nullptr),
+		pQueueCapacity(Private::LogImpl::AsyncWriter::defaultCapacity),
+		pOverflow(Overflow::block),
+		pFormat(nullptr)
+	{}
+
+
+	template<class NextHandler>
+	inline AsyncFile<NextHandler>::AsyncFile(Private::LogImpl::IRecordFormat* format) :
+		pWriter(nullptr),
+		pQueueCapacity(Private::LogImpl::AsyncWriter::defaultCapacity),
+		pOverflow(Overflow::block),
+		pFormat(format)
+	{}
+
+
+	template<class NextHandler>
+	inline AsyncFile<NextHandler>::~AsyncFile()
+	{
+		// the writer may still use the conversion until all messages are written
+		delete pWriter;
+		delete pFormat;
+	}
+
+
+	template<class NextHandler>
+	bool AsyncFile<NextHandler>::logfile(const AnyString& filename)
+	{
+		// Assigning the new filename
+		pOutputFilename = filename;
+		// Opening the log file
+		if (pOutputFilename.empty())
+		{
+			closeLogfile();
+			return true;
+		}
+		if (not pWriter)
+		{
+			pWriter = new Private::LogImpl::AsyncWriter(pQueueCapacity, pFormat);
+			pWriter->overflow(pOverflow);
+		}
+		return pWriter->open(pOutputFilename);
+	}
+
+
+	template<class NextHandler>
+	inline void AsyncFile<NextHandler>::closeLogfile()
+	{
+		if (pWriter)
+			pWriter->close();
+	}
+
+
+	template<class NextHandler>
+	inline bool AsyncFile<NextHandler>::reopenLogfile()
+	{
+		if (pOutputFilename.empty())
+		{
+			closeLogfile();
+			return true;
+		}
+		return logfile(String(pOutputFilename));
+	}
+
+
+	template<class NextHandler>
+	inline String AsyncFile<NextHandler>::logfile() const
+	{
+		return pOutputFilename;
+	}
+
+
+	template<class NextHandler>
+	inline bool AsyncFile<NextHandler>::logfileIsOpened() const
+	{
+		return pWriter and pWriter->opened();
+	}
+
+
+	template<class NextHandler>
+	inline void AsyncFile<NextHandler>::flush(bool sync) const
+	{
+		if (pWriter)
+			pWriter->flush(sync);
+	}
+
+
+	template<class NextHandler>
+	inline void AsyncFile<NextHandler>::queueCapacity(uint bytes)
+	{
+		pQueueCapacity = bytes;
+	}
+
+
+	template<class NextHandler>
+	inline void AsyncFile<NextHandler>::overflow(Overflow policy)
+	{
+		pOverflow = policy;
+		if (pWriter)
+			pWriter->overflow(policy);
+	}
+
+
+	template<class NextHandler>
+	inline Overflow AsyncFile<NextHandler>::overflow() const
+	{
+		return pOverflow;
+	}
+
+
+	template<class NextHandler>
+	inline uint64 AsyncFile<NextHandler>::droppedMessages() const
+	{
+		return (pWriter) ? pWriter->dropped() : 0;
+	}
+
+
+
+	template<class NextHandler>
+	template<class LoggerT, class VerbosityType>
+	void AsyncFile<NextHandler>::internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const
+	{
+		if (pWriter and pWriter->opened())
+		{
+			typedef typename LoggerT::DecoratorsType DecoratorsType;
+			// The buffer is kept from one message to another, no allocation
+			static thread_local Clob buffer;
+			buffer.clear();
+			logger.DecoratorsType::template internalDecoratorAddPrefix<AsyncFile, VerbosityType>(buffer, s);
+			# ifdef YUNI_OS_WINDOWS
+			buffer.append("\r\n", 2);
+			# else
+			buffer += '\n';
+			# endif
+			pWriter->push(buffer.data(), buffer.size());
+
+			// The fatal messages must not be lost
+			if ((uint) VerbosityType::level == (uint) Verbosity::Fatal::level)
+				pWriter->flush(true);
+		}
+
+		// Transmit the message to the next handler
+		NextHandler::template internalDecoratorWriteWL<LoggerT, VerbosityType>(logger, s);
+	}
+
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
@@ -0,0 +1,81 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "asyncfile.h"
+#include "../binary/transcoder.h"
+#include <type_traits>
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	/*!
+	** \brief Log Handler: Binary log file, written by a background thread
+	**
+	** The messages are not formatted by the calling thread: the values are
+	** copied as they are (in their binary form), and the string literals wrapped
+	** into Logs::Literal are only referenced by their address, their text being
+	** written once into the file.
+	** The file can be read with Logs::BinaryDecoder (or the tool `yuni-logs-decode`).
+	**
+	** \code
+	** Logs::Logger<Logs::BinaryFile<>, Logs::NullDecorator, Policy::SingleThreaded> logs;
+	** logs.logfile("/var/log/myapp.ynlog");
+	** logs.notice() << Logs::Literal("request ") << id << Logs::Literal(" done in ") << duration << "ms";
+	** \endcode
+	**
+	** The front-end is the same than for the text log handlers, but the decorators
+	** are ignored (each message has a timestamp and a verbosity level).
+	**
+	** \warning The text of a Logs::Literal must remain valid and unmodified until
+	**   the end of the program.
+	** \warning This handler must be the only handler of the logger.
+	*/
+	template<class NextHandler = NullHandler>
+	class YUNI_DECL BinaryFile : public AsyncFile<NextHandler>
+	{
+	public:
+		static_assert(std::is_same<NextHandler, NullHandler>::value, "the binary log handler can not be chained");
+
+		enum Settings
+		{
+			// Colors are not allowed in a file
+			colorsAllowed = 0,
+			// The messages are not formatted (see Private::LogImpl::BufferMode)
+			binaryFormat = 1,
+		};
+
+	public:
+		//! \name Constructor
+		//@{
+		//! Default constructor
+		BinaryFile();
+		//@}
+
+
+	public:
+		template<class LoggerT, class VerbosityType>
+		void internalDecoratorWriteWL(LoggerT& logger, const AnyString& record) const;
+
+	}; // class BinaryFile
+
+
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
+
+#include "binaryfile.hxx"
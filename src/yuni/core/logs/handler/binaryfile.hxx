@@ -0,0 +1,48 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "binaryfile.h"
+#include "../verbosity.h"
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	template<class NextHandler>
+	inline BinaryFile<NextHandler>::BinaryFile() :
+		AsyncFile<NextHandler>(new Private::LogImpl::BinaryLog::BinaryFormat())
+	{}
+
+
+	template<class NextHandler>
+	template<class LoggerT, class VerbosityType>
+	inline void BinaryFile<NextHandler>::internalDecoratorWriteWL(LoggerT&, const AnyString& record) const
+	{
+		Private::LogImpl::AsyncWriter* writer = this->pWriter;
+		if (writer and writer->opened())
+		{
+			writer->push(record.data(), record.size());
+
+			// The fatal messages must not be lost
+			if ((uint) VerbosityType::level == (uint) Verbosity::Fatal::level)
+				writer->flush(true);
+		}
+	}
+
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
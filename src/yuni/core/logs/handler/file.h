@@ -11,6 +11,7 @@
 #pragma once
 #include "../null.h"
 #include "../../../io/file.h"
+#include "../rotation/rotator.h"
 #include <cassert>
 
 
@@ -22,6 +23,27 @@ namespace Logs
 
 	/*!
 	** \brief Log Handler: Single Log file
+	**
+	** The log file can be rotated according to its size and / or periodically:
+	** \code
+	** Job::QueueService queueservice;
+	** queueservice.start();
+	**
+	** Logs::Logger<Logs::File<> > logs;
+	** logs.rotationQueueService(&queueservice);
+	** logs.rotationMaxSize(100 * 1024 * 1024); // 100MiB
+	** logs.rotationInterval(24 * 3600);         // every day
+	** logs.rotationRetention(30);               // keep 30 files
+	** logs.rotationCompression(Logs::Compression::gzip);
+	** logs.logfile("/var/log/myapp.log");
+	** \endcode
+	**
+	** The rotated files are named `<logfile>.YYYYMMDD-hhmmss` (`.gz` / `.zst` once compressed).
+	** The renaming, the opening of the new file, the compression and the removal of
+	** the oldest files are done by the queueservice: the logging thread only swaps
+	** the file handles when the new file is ready (on Windows, an opened file can not
+	** be renamed and the logging thread has to reopen the file itself).
+	** The rotation by time is triggered by the first message after the deadline.
 	*/
 	template<class NextHandler = NullHandler>
 	class YUNI_DECL File : public NextHandler
@@ -73,15 +95,55 @@ namespace Logs
 		bool logfileIsOpened() const;
 
 
+		//! \name Rotation
+		//@{
+		/*!
+		** \brief Set the queueservice for the rotation tasks
+		**
+		** Without queueservice, the rotation is done by the logging thread.
+		** The queueservice must outlive the logger.
+		*/
+		void rotationQueueService(Job::QueueService* queueservice);
+
+		//! Rotate the log file when its size exceeds a limit (in bytes, 0 to disable)
+		void rotationMaxSize(uint64 bytes);
+
+		//! Rotate the log file periodically (in seconds, aligned on the UTC clock, 0 to disable)
+		void rotationInterval(uint seconds);
+
+		/*!
+		** \brief Set how many rotated files should be kept
+		**
+		** \param count Maximum number of rotated files (0 for no limit)
+		** \param maxTotalSize Maximum total size of the rotated files (in bytes, 0 for no limit)
+		*/
+		void rotationRetention(uint count, uint64 maxTotalSize = 0);
+
+		//! Set the compression of the rotated files (none by default)
+		void rotationCompression(Compression mode);
+
+		//! Rotate the log file as soon as possible
+		void rotate();
+		//@}
+
+
 	public:
 		template<class LoggerT, class VerbosityType>
 		void internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const;
 
+	private:
+		//! Get the rotation of the log file (created if needed)
+		Private::LogImpl::Rotator& rotator();
+
 	private:
 		//! The originale filename
 		String pOutputFilename;
 		//! File
 		mutable IO::File::Stream pFile;
+		//! Buffer for formatting the messages
+		mutable Clob pBuffer;
+		//! Rotation of the log file (if enabled)
+		Private::LogImpl::Rotator::Ptr pRotator;
 
 	}; // class File
 
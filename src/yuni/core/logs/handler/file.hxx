@@ -28,7 +28,11 @@ namespace Logs
 			pFile.close();
 			return true;
 		}
-		return pFile.open(pOutputFilename, IO::OpenMode::write | IO::OpenMode::append);
+		if (not pFile.open(pOutputFilename, IO::OpenMode::write | IO::OpenMode::append))
+			return false;
+		if (!(!pRotator))
+			pRotator->reset(pOutputFilename, IO::File::Size(pOutputFilename));
+		return true;
 	}
 
 
@@ -45,7 +49,7 @@ namespace Logs
 		pFile.close();
 		return (pOutputFilename.empty())
 			? true
-			: pFile.open(pOutputFilename, IO::OpenMode::write | IO::OpenMode::append);
+			: logfile(String(pOutputFilename));
 	}
 
 
@@ -64,6 +68,62 @@ namespace Logs
 
 
 
+	template<class NextHandler>
+	Private::LogImpl::Rotator& File<NextHandler>::rotator()
+	{
+		if (!pRotator)
+		{
+			pRotator = new Private::LogImpl::Rotator();
+			if (pFile.opened())
+				pRotator->reset(pOutputFilename, IO::File::Size(pOutputFilename));
+		}
+		return *pRotator;
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotationQueueService(Job::QueueService* queueservice)
+	{
+		rotator().queueservice(queueservice);
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotationMaxSize(uint64 bytes)
+	{
+		rotator().maxSize(bytes);
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotationInterval(uint seconds)
+	{
+		rotator().interval(seconds);
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotationRetention(uint count, uint64 maxTotalSize)
+	{
+		rotator().retention(count, maxTotalSize);
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotationCompression(Compression mode)
+	{
+		rotator().compression(mode);
+	}
+
+
+	template<class NextHandler>
+	void File<NextHandler>::rotate()
+	{
+		rotator().request();
+	}
+
+
+
 	template<class NextHandler>
 	template<class LoggerT, class VerbosityType>
 	void File<NextHandler>::internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const
@@ -71,16 +131,21 @@ namespace Logs
 		if (pFile.opened())
 		{
 			typedef typename LoggerT::DecoratorsType DecoratorsType;
-			// Append the message to the file
-			logger.DecoratorsType::template internalDecoratorAddPrefix<File, VerbosityType>(pFile, s);
-
-			// Flushing the result
+			// Formatting the message (a single write per message)
+			pBuffer.clear();
+			logger.DecoratorsType::template internalDecoratorAddPrefix<File, VerbosityType>(pBuffer, s);
 			# ifdef YUNI_OS_WINDOWS
-			pFile << "\r\n";
+			pBuffer.append("\r\n", 2);
 			# else
-			pFile << '\n';
+			pBuffer += '\n';
 			# endif
+
+			// Flushing the result
+			pFile.write(pBuffer.data(), pBuffer.size());
 			pFile.flush();
+
+			if (!(!pRotator))
+				pRotator->written(pFile, pBuffer.size());
 		}
 
 		// Transmit the message to the next handler
@@ -0,0 +1,62 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	/*!
+	** \brief A string literal, logged by its address only by Logs::BinaryFile
+	**
+	** The binary log handler copies all strings, like any other value. A string
+	** wrapped into a literal is not copied: its text is written once per file,
+	** and must then remain valid and unmodified until the end of the program.
+	**
+	** \code
+	** logs.notice() << Logs::Literal("request ") << id << Logs::Literal(" done");
+	** \endcode
+	**
+	** The text log handlers append it like any other string.
+	*/
+	class YUNI_DECL Literal final
+	{
+	public:
+		//! Constructor from a string literal (or any static array)
+		template<uint N>
+		explicit Literal(const char (&text)[N]) :
+			text(text),
+			size(N)
+		{}
+
+		//! Length of the text (without the final zero)
+		uint length() const
+		{
+			return (text[size - 1] == '\0') ? size - 1 : size;
+		}
+
+	public:
+		//! The text
+		const char* const text;
+		//! Size of the array
+		const uint size;
+
+	}; // class Literal
+
+
+
+
+} // namespace Logs
+} // namespace Yuni
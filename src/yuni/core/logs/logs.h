@@ -13,13 +13,17 @@
 #include "../../thread/policy.h"
 #include "null.h"
 #include "verbosity.h"
+#include "literal.h"
 
 // Default Handler
 #include "handler/stdcout.h"
 #include "handler/file.h"
+#include "handler/asyncfile.h"
+#include "handler/binaryfile.h"
 // Default decorators
 #include "decorators/verbositylevel.h"
 #include "decorators/time.h"
+#include "decorators/precisetime.h"
 #include "decorators/message.h"
 #include "../noncopyable.h"
 #include "buffer.h"
@@ -114,27 +118,37 @@ namespace Logs
 	private:
 		// Aliases (for code clarity)
 		//! Alias for the CheckpointBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Checkpoint>    CheckpointBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Checkpoint,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Checkpoint>::value>  CheckpointBuffer;
 		//! Alias for the NoticeBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Notice>        NoticeBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Notice,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Notice>::value>  NoticeBuffer;
 		//! Alias for the NoticeBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Info>          InfoBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Info,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Info>::value>  InfoBuffer;
 		//! Alias for the WarningBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Warning>       WarningBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Warning,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Warning>::value>  WarningBuffer;
 		//! Alias for the ErrorBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Error>         ErrorBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Error,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Error>::value>  ErrorBuffer;
 		//! Alias for the ProgressBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Progress>      ProgressBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Progress,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Progress>::value>  ProgressBuffer;
 		//! Alias for the CompatibilityBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Compatibility> CompatibilityBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Compatibility,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Compatibility>::value>  CompatibilityBuffer;
 		//! Alias for the FatalBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Fatal>         FatalBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Fatal,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Fatal>::value>  FatalBuffer;
 		//! Alias for the DebugBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Debug>         DebugBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Debug,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Debug>::value>  DebugBuffer;
 		//! Alias for a dummy writer
 		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Info, 0>       DummyBuffer;
 		//! Alias for the UnknownBuffer
-		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Unknown>       UnknownBuffer;
+		typedef Private::LogImpl::Buffer<LoggerType, Verbosity::Unknown,
+			Private::LogImpl::BufferMode<Handlers, Verbosity::Unknown>::value>  UnknownBuffer;
 
 	public:
 		//! \name Constructors & Destructor
@@ -206,7 +220,7 @@ namespace Logs
 
 
 		//! Start a custom verbosity level message
-		template<class C> Private::LogImpl::Buffer<LoggerType,C,C::enabled> custom() const;
+		template<class C> Private::LogImpl::Buffer<LoggerType,C,Private::LogImpl::BufferMode<Handlers,C>::value> custom() const;
 
 		//! Start a message with no verbosity level (always displayed)
 		template<class U> UnknownBuffer operator << (const U& u) const;
@@ -202,10 +202,10 @@ namespace Logs
 
 	template<class Handlers, class Decorators, template<class> class TP>
 	template<class C>
-	inline Private::LogImpl::Buffer<Logger<Handlers,Decorators,TP>, C, C::enabled>
+	inline Private::LogImpl::Buffer<Logger<Handlers,Decorators,TP>, C, Private::LogImpl::BufferMode<Handlers,C>::value>
 	Logger<Handlers,Decorators,TP>::custom() const
 	{
-		return Private::LogImpl::Buffer<LoggerType, C, C::enabled>(*this);
+		return Private::LogImpl::Buffer<LoggerType, C, Private::LogImpl::BufferMode<Handlers,C>::value>(*this);
 	}
 
 
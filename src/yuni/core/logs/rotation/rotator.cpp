@@ -0,0 +1,373 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "rotator.h"
+#include "../../../io/directory/info.h"
+#include "../../../io/filename-manipulation.h"
+#include "../../../job/queue/service.h"
+#include "../../../thread/utility.h"
+#include "../../process/program.h"
+#include <algorithm>
+#include <vector>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+
+	namespace // anonymous
+	{
+
+		//! A rotated log file
+		struct RotatedFile final
+		{
+			//! Timestamp of the rotation ('YYYYMMDD-hhmmss')
+			ShortString16 timestamp;
+			//! Index of the file for the same timestamp
+			uint index;
+			//! Size in bytes
+			uint64 size;
+			//! Full filename
+			String filename;
+		};
+
+
+		//! Get if a rotated file (or one of its compressed version) already exists
+		bool RotatedFileExists(const String& filename)
+		{
+			return Yuni::IO::File::Exists(filename)
+				or Yuni::IO::File::Exists(String(filename) << ".gz")
+				or Yuni::IO::File::Exists(String(filename) << ".zst");
+		}
+
+
+		/*!
+		** \brief Parse the name of a rotated file ('<name>.YYYYMMDD-hhmmss[.N][.gz|.zst]')
+		**
+		** \param[out] file Timestamp and index of the file
+		** \param name Name of a file (without path)
+		** \param prefix Name of the log file (without path) followed by a dot
+		*/
+		bool ParseRotatedFilename(RotatedFile& file, const AnyString& name, const String& prefix)
+		{
+			if (not name.startsWith(prefix))
+				return false;
+			const char* p = name.c_str() + prefix.size();
+			uint size = name.size() - prefix.size();
+			if (size > 3 and name.endsWith(".gz"))
+				size -= 3;
+			else if (size > 4 and name.endsWith(".zst"))
+				size -= 4;
+
+			// 'YYYYMMDD-hhmmss'
+			if (size < 15 or p[8] != '-')
+				return false;
+			for (uint i = 0; i != 15; ++i)
+			{
+				if (i != 8 and not String::IsDigit(p[i]))
+					return false;
+			}
+			file.timestamp.assign(p, 15);
+			file.index = 0;
+
+			// '.N'
+			if (size != 15)
+			{
+				if (size < 17 or p[15] != '.')
+					return false;
+				if (not AnyString(p + 16, size - 16).to(file.index))
+					return false;
+			}
+			return true;
+		}
+
+
+		//! Compress a file with an external program (the original file is removed)
+		void Compress(const String& filename, Logs::Compression mode)
+		{
+			Yuni::Process::Program program;
+			switch (mode)
+			{
+				case Logs::Compression::gzip:
+				{
+					program.program("gzip");
+					program.argumentAdd("-f");
+					break;
+				}
+				case Logs::Compression::zstd:
+				{
+					program.program("zstd");
+					program.argumentAdd("-q");
+					program.argumentAdd("--rm");
+					program.argumentAdd("-f");
+					break;
+				}
+				case Logs::Compression::none:
+					return;
+			}
+			program.argumentAdd(filename);
+			if (program.execute())
+				program.wait();
+		}
+
+	} // anonymous namespace
+
+
+
+
+	Rotator::Rotator() :
+		pSize(0),
+		pDeadline(0),
+		pMaxSize(0),
+		pInterval(0),
+		pState(stIdle),
+		pRetentionCount(0),
+		pRetentionSize(0),
+		pCompression(Logs::Compression::none),
+		pQueueService(nullptr)
+	{}
+
+
+	Rotator::~Rotator()
+	{
+		// nothing to do, the jobs keep a reference to this object
+	}
+
+
+	void Rotator::queueservice(Yuni::Job::QueueService* queueservice)
+	{
+		MutexLocker locker(pMutex);
+		pQueueService = queueservice;
+	}
+
+
+	void Rotator::maxSize(uint64 bytes)
+	{
+		pMaxSize.store(bytes, std::memory_order_relaxed);
+	}
+
+
+	void Rotator::interval(uint seconds)
+	{
+		pInterval.store(seconds, std::memory_order_relaxed);
+		updateDeadline();
+	}
+
+
+	void Rotator::retention(uint count, uint64 maxTotalSize)
+	{
+		MutexLocker locker(pMutex);
+		pRetentionCount = count;
+		pRetentionSize = maxTotalSize;
+	}
+
+
+	void Rotator::compression(Logs::Compression mode)
+	{
+		MutexLocker locker(pMutex);
+		pCompression = mode;
+	}
+
+
+	void Rotator::reset(const AnyString& filename, uint64 size)
+	{
+		{
+			MutexLocker locker(pMutex);
+			pFilename = filename;
+		}
+		pSize = size;
+		updateDeadline();
+	}
+
+
+	void Rotator::updateDeadline()
+	{
+		uint interval = pInterval.load(std::memory_order_relaxed);
+		sint64 deadline = 0;
+		if (interval != 0)
+			deadline = (Yuni::DateTime::Now() / interval + 1) * interval;
+		pDeadline.store(deadline, std::memory_order_relaxed);
+	}
+
+
+	void Rotator::dispatch(void (Rotator::*method)())
+	{
+		Yuni::Job::QueueService* queueservice;
+		{
+			MutexLocker locker(pMutex);
+			queueservice = pQueueService;
+		}
+		if (queueservice)
+		{
+			// keeping a reference, since the log handler may be destroyed meanwhile
+			Ptr self = this;
+			async(*queueservice, [self, method]() { ((*self).*method)(); });
+		}
+		else
+			(this->*method)();
+	}
+
+
+
+
+	void Rotator::request()
+	{
+		int expected = stIdle;
+		if (pState.compare_exchange_strong(expected, stRequested))
+			dispatch(&Rotator::prepare);
+	}
+
+
+	void Rotator::prepare()
+	{
+		MutexLocker locker(pMutex);
+		if (pFilename.empty())
+		{
+			pState.store(stIdle);
+			return;
+		}
+
+		String rotated;
+		rotated << pFilename << '.';
+		Yuni::DateTime::TimestampToString(rotated, "%Y%m%d-%H%M%S", 0, false);
+		if (RotatedFileExists(rotated))
+		{
+			const uint length = rotated.size();
+			uint index = 1;
+			do
+			{
+				rotated.truncate(length);
+				rotated << '.' << index++;
+			}
+			while (RotatedFileExists(rotated));
+		}
+		pRotatedFilename = rotated;
+
+		# ifndef YUNI_OS_WINDOWS
+		// the writing thread may continue to write into the renamed file, until the swap
+		if (Yuni::IO::errNone != Yuni::IO::File::Rename(pFilename, rotated))
+		{
+			pState.store(stIdle);
+			return;
+		}
+		if (not pNextFile.open(pFilename, Yuni::IO::OpenMode::write | Yuni::IO::OpenMode::append))
+		{
+			// keeping the current log file
+			Yuni::IO::File::Rename(rotated, pFilename);
+			pState.store(stIdle);
+			return;
+		}
+		# else
+		// an opened file can not be renamed, the writing thread will do it (see swap())
+		# endif
+
+		pState.store(stReady, std::memory_order_release);
+	}
+
+
+	void Rotator::swap(Yuni::IO::File::Stream& file)
+	{
+		# ifndef YUNI_OS_WINDOWS
+		file.swap(pNextFile);
+		# else
+		{
+			MutexLocker locker(pMutex);
+			file.close();
+			Yuni::IO::File::Rename(pFilename, pRotatedFilename);
+			file.open(pFilename, Yuni::IO::OpenMode::write | Yuni::IO::OpenMode::append);
+		}
+		# endif
+		pSize = 0;
+		pState.store(stArchiving, std::memory_order_release);
+		dispatch(&Rotator::archive);
+	}
+
+
+	void Rotator::archive()
+	{
+		String filename;
+		String rotated;
+		Logs::Compression compression;
+		{
+			MutexLocker locker(pMutex);
+			filename = pFilename;
+			rotated = pRotatedFilename;
+			compression = pCompression;
+		}
+		// the previous log file
+		pNextFile.close();
+		// another rotation can be started from now on
+		pState.store(stIdle, std::memory_order_release);
+
+		MutexLocker locker(pArchiveMutex);
+		if (compression != Logs::Compression::none)
+			Compress(rotated, compression);
+		prune(filename);
+	}
+
+
+	void Rotator::prune(const String& filename)
+	{
+		uint count;
+		uint64 maxTotalSize;
+		{
+			MutexLocker locker(pMutex);
+			count = pRetentionCount;
+			maxTotalSize = pRetentionSize;
+		}
+		if (count == 0 and maxTotalSize == 0)
+			return;
+
+		String path;
+		String prefix;
+		Yuni::IO::ExtractFilePathAndName(path, prefix, filename);
+		if (path.empty())
+			path = '.';
+		prefix << '.';
+
+		std::vector<RotatedFile> files;
+		Yuni::IO::Directory::Info info(path);
+		Yuni::IO::Directory::Info::file_iterator end = info.file_end();
+		for (Yuni::IO::Directory::Info::file_iterator it = info.file_begin(); it != end; ++it)
+		{
+			RotatedFile file;
+			if (ParseRotatedFilename(file, *it, prefix))
+			{
+				file.size = it.size();
+				file.filename = it.filename();
+				files.push_back(file);
+			}
+		}
+
+		// the most recent first
+		std::sort(files.begin(), files.end(), [](const RotatedFile& a, const RotatedFile& b) -> bool
+		{
+			return (a.timestamp != b.timestamp) ? (a.timestamp > b.timestamp) : (a.index > b.index);
+		});
+
+		uint64 totalSize = 0;
+		for (uint i = 0; i != static_cast<uint>(files.size()); ++i)
+		{
+			totalSize += files[i].size;
+			if ((count != 0 and i >= count) or (maxTotalSize != 0 and totalSize > maxTotalSize))
+				Yuni::IO::File::Delete(files[i].filename);
+		}
+	}
+
+
+
+
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
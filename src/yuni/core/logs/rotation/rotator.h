@@ -0,0 +1,204 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../string.h"
+#include "../../noncopyable.h"
+#include "../../smartptr/intrusive.h"
+#include "../../../thread/mutex.h"
+#include "../../../io/file.h"
+#include <atomic>
+
+
+
+namespace Yuni
+{
+namespace Job
+{
+
+	// Forward declaration
+	class QueueService;
+
+} // namespace Job
+} // namespace Yuni
+
+
+namespace Yuni
+{
+namespace Logs
+{
+
+	//! Compression of the rotated log files
+	enum class Compression
+	{
+		//! No compression
+		none,
+		//! gzip (the program `gzip` must be available)
+		gzip,
+		//! zstd (the program `zstd` must be available)
+		zstd,
+	};
+
+
+} // namespace Logs
+} // namespace Yuni
+
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+
+	/*!
+	** \brief Rotation of log files (by size and / or by time)
+	**
+	** The writing thread only checks some counters after each message. When a
+	** rotation is required, a job renames the log file (`<filename>.YYYYMMDD-hhmmss`)
+	** and opens a new one, which is then taken by the writing thread by swapping
+	** the file handles. The previous file is then closed, compressed and the old
+	** files removed by another job.
+	**
+	** \internal The writing thread is the only one to write into the log file, and
+	**   the only one to touch `pSize`. `pState` orders the accesses to `pNextFile`,
+	**   shared with the jobs.
+	*/
+	class YUNI_DECL Rotator final
+		: public IIntrusiveSmartPtr<Rotator, false>
+		, private NonCopyable<Rotator>
+	{
+	public:
+		//! Ancestor
+		typedef IIntrusiveSmartPtr<Rotator, false>  Ancestor;
+		//! The most suitable smart pointer for the class
+		typedef Ancestor::SmartPtrType<Rotator>::PtrThreadSafe Ptr;
+		//! The threading policy
+		typedef Ancestor::ThreadingPolicy ThreadingPolicy;
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		Rotator();
+		//! Destructor
+		~Rotator();
+		//@}
+
+
+		//! \name Settings
+		//@{
+		//! Set the queueservice for the background tasks (null: done by the writing thread)
+		void queueservice(Yuni::Job::QueueService* queueservice);
+		//! Set the maximum size of a log file (0 to disable)
+		void maxSize(uint64 bytes);
+		//! Set the interval (in seconds, aligned on the UTC clock) between two rotations (0 to disable)
+		void interval(uint seconds);
+		//! Set the maximum number of rotated files and their maximum total size (0 for no limit)
+		void retention(uint count, uint64 maxTotalSize);
+		//! Set the compression of the rotated files
+		void compression(Logs::Compression mode);
+		//@}
+
+
+		//! \name Writing thread
+		//@{
+		/*!
+		** \brief Reset the counters for a newly opened log file
+		**
+		** \param filename Filename of the log file
+		** \param size Current size of the log file
+		*/
+		void reset(const AnyString& filename, uint64 size);
+
+		/*!
+		** \brief Account for some data written into the log file
+		**
+		** \param file The log file (may be swapped with a new one)
+		** \param size Size of the data written
+		*/
+		void written(Yuni::IO::File::Stream& file, uint64 size);
+
+		//! Request a rotation as soon as possible
+		void request();
+		//@}
+
+
+	private:
+		enum State
+		{
+			//! No rotation in progress
+			stIdle,
+			//! A rotation has been requested
+			stRequested,
+			//! The new log file is ready to be taken by the writing thread
+			stReady,
+			//! The previous log file is being archived
+			stArchiving,
+		};
+
+		//! Rename the log file and open a new one (job)
+		void prepare();
+		//! Take the new log file (writing thread)
+		void swap(Yuni::IO::File::Stream& file);
+		//! Close and compress the rotated file, then remove the oldest ones (job)
+		void archive();
+		//! Remove the oldest rotated files, according to the retention settings
+		void prune(const String& filename);
+		//! Run a task in the background (or immediately without queueservice)
+		void dispatch(void (Rotator::*method)());
+		//! Compute the next deadline according to the interval
+		void updateDeadline();
+
+	private:
+		//! Current size of the log file
+		uint64 pSize;
+		//! Time (timestamp) of the next rotation (0 if none)
+		std::atomic<sint64> pDeadline;
+		//! Maximum size of the log file (0 if no limit)
+		std::atomic<uint64> pMaxSize;
+		//! Interval between two rotations (0 if none)
+		std::atomic<uint> pInterval;
+		//! State of the rotation
+		std::atomic<int> pState;
+
+		//! Mutex for the settings below
+		Yuni::Mutex pMutex;
+		//! Filename of the log file
+		String pFilename;
+		//! Filename of the last rotated file
+		String pRotatedFilename;
+		//! Maximum number of rotated files
+		uint pRetentionCount;
+		//! Maximum total size of the rotated files
+		uint64 pRetentionSize;
+		//! Compression of the rotated files
+		Logs::Compression pCompression;
+		//! Queueservice for the background tasks
+		Yuni::Job::QueueService* pQueueService;
+
+		//! The new log file (rotation in progress), then the previous one (until archived)
+		Yuni::IO::File::Stream pNextFile;
+		//! Mutex for archiving (serializes the compressions and the removals)
+		Yuni::Mutex pArchiveMutex;
+
+	}; // class Rotator
+
+
+
+
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
+
+#include "rotator.hxx"
@@ -0,0 +1,46 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "rotator.h"
+#include "../../../datetime/timestamp.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace LogImpl
+{
+
+	inline void Rotator::written(Yuni::IO::File::Stream& file, uint64 size)
+	{
+		pSize += size;
+
+		uint64 maxSize = pMaxSize.load(std::memory_order_relaxed);
+		sint64 deadline = pDeadline.load(std::memory_order_relaxed);
+		if ((maxSize != 0 and pSize >= maxSize) or (deadline != 0 and Yuni::DateTime::Now() >= deadline))
+		{
+			updateDeadline();
+			request();
+		}
+
+		// the new log file is ready
+		if (YUNI_UNLIKELY(pState.load(std::memory_order_acquire) == stReady))
+			swap(file);
+	}
+
+
+
+
+} // namespace LogImpl
+} // namespace Private
+} // namespace Yuni
@@ -50,6 +50,7 @@
 #include "traits/fill.h"
 #include "traits/vnsprintf.h"
 #include "traits/into.h"
+#include "../hash/buffer.h"
 #include <utility>
 
 
@@ -1660,7 +1661,10 @@ namespace Yuni
 		** \brief Perform a full check about UTF8 validity
 		**
 		** This check will iterate through the whole string to
-		** detect any bad-formed UTF8 character.
+		** detect any bad-formed UTF8 character (overlong sequences, surrogates
+		** and code points beyond U+10FFFF included).
+		** The ASCII blocks and the lookup tables are processed with SSE2 / AVX2
+		** when available.
 		*/
 		bool utf8valid() const;
 
@@ -1670,6 +1674,7 @@ namespace Yuni
 		** This check will iterate through the whole string to
 		** detect any bad-formed UTF8 character.
 		** \param[out] offset The offset in the string of the misformed UTF8 character
+		**   (the size of the string if valid)
 		** \return UTF8::errNone if the string is valid
 		*/
 		UTF8::Error utf8valid(Size& offset) const;
@@ -1833,7 +1838,9 @@ namespace Yuni
 		//! \name Misc
 		//@{
 		/*!
-		** \brief Get the hash of the string (SDBM Hash Function)
+		** \brief Get the hash of the string
+		**
+		** \see Hash::Buffer()
 		*/
 		size_t hash() const;
 
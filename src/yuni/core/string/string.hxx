@@ -774,12 +774,7 @@ namespace Yuni
 	bool
 	CString<ChunkSizeT,ExpandableT>::hasChar(char c) const
 	{
-		for (Size i = 0; i != AncestorType::size; ++i)
-		{
-			if (c == AncestorType::data[i])
-				return true;
-		}
-		return false;
+		return nullptr != Yuni::Private::CStringImpl::FindChar(AncestorType::data, AncestorType::size, c);
 	}
 
 
@@ -787,13 +782,7 @@ namespace Yuni
 	uint
 	CString<ChunkSizeT,ExpandableT>::countChar(char c) const
 	{
-		uint r = 0;
-		for (Size i = 0; i != AncestorType::size; ++i)
-		{
-			if (c == AncestorType::data[i])
-				++r;
-		}
-		return r;
+		return Yuni::Private::CStringImpl::CountChar(AncestorType::data, AncestorType::size, c);
 	}
 
 
@@ -819,14 +808,10 @@ namespace Yuni
 	{
 		if (offset < AncestorType::size)
 		{
-			const char* p   = AncestorType::data + offset;
-			const char* end = AncestorType::data + (AncestorType::size);
-
-			for (; p != end; ++p)
-			{
-				if (c == *p)
-					return static_cast<Size>(p - AncestorType::data);
-			}
+			const char* p = Yuni::Private::CStringImpl::FindChar(AncestorType::data + offset,
+				AncestorType::size - offset, c);
+			if (p)
+				return static_cast<Size>(p - AncestorType::data);
 		}
 		return npos;
 	}
@@ -836,20 +821,12 @@ namespace Yuni
 	typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::find(const char* const cstr, Size offset, Size len) const
 	{
-		if (cstr and len and len <= AncestorType::size)
+		if (cstr and len and offset < AncestorType::size and len <= AncestorType::size - offset)
 		{
-			// Size end = AncestorType::size - len + 1;
-			const char* p   = AncestorType::data + offset;
-			const char* end = AncestorType::data + (AncestorType::size - len + 1);
-			char needle     = *cstr;
-			for (; p != end; ++p)
-			{
-				if (*p == needle)
-				{
-					if (0 == ::memcmp(p, cstr, len))
-						return static_cast<Size>(p - AncestorType::data);
-				}
-			}
+			const char* p = Yuni::Private::CStringImpl::Find(AncestorType::data + offset,
+				AncestorType::size - offset, cstr, len);
+			if (p)
+				return static_cast<Size>(p - AncestorType::data);
 		}
 		return npos;
 	}
@@ -888,13 +865,7 @@ namespace Yuni
 	typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::ifind(char c) const
 	{
-		c = static_cast<char>(ToLower(c));
-		for (Size i = 0; i != AncestorType::size; ++i)
-		{
-			if (c == static_cast<char>(ToLower(AncestorType::data[i])))
-				return i;
-		}
-		return npos;
+		return ifind(c, 0);
 	}
 
 
@@ -902,11 +873,12 @@ namespace Yuni
 	typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::ifind(char c, Size offset) const
 	{
-		c = static_cast<char>(ToLower(c));
-		for (Size i = offset; i < AncestorType::size; ++i)
+		if (offset < AncestorType::size)
 		{
-			if (c == static_cast<char>(ToLower(AncestorType::data[i])))
-				return i;
+			const char* p = Yuni::Private::CStringImpl::IFindChar(AncestorType::data + offset,
+				AncestorType::size - offset, c);
+			if (p)
+				return static_cast<Size>(p - AncestorType::data);
 		}
 		return npos;
 	}
@@ -916,17 +888,12 @@ namespace Yuni
 	typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::ifind(const char* const cstr, Size offset, Size len) const
 	{
-		if (cstr and len and len <= AncestorType::size)
+		if (cstr and len and offset < AncestorType::size and len <= AncestorType::size - offset)
 		{
-			Size end = AncestorType::size - len + 1;
-			for (Size i = offset; i < end; ++i)
-			{
-				if (ToLower(AncestorType::data[i]) == ToLower(*cstr))
-				{
-					if (!CompareInsensitive(AncestorType::data + i, len, cstr, len))
-						return i;
-				}
-			}
+			const char* p = Yuni::Private::CStringImpl::IFind(AncestorType::data + offset,
+				AncestorType::size - offset, cstr, len);
+			if (p)
+				return static_cast<Size>(p - AncestorType::data);
 		}
 		return npos;
 	}
@@ -1202,12 +1169,7 @@ namespace Yuni
 	uint
 	CString<ChunkSizeT,ExpandableT>::indexOf(Size offset, char c) const
 	{
-		for (; offset < AncestorType::size; ++offset)
-		{
-			if (c == AncestorType::data[offset])
-				return offset;
-		}
-		return npos;
+		return find(c, offset);
 	}
 
 
@@ -1396,19 +1358,7 @@ namespace Yuni
 	uint
 	CString<ChunkSizeT,ExpandableT>::indexOf(Size offset, const char* const cstr, Size len) const
 	{
-		if (cstr and len and len <= AncestorType::size)
-		{
-			Size end = AncestorType::size - len + 1;
-			for (; offset < end; ++offset)
-			{
-				if (AncestorType::data[offset] == *cstr)
-				{
-					if (0 == ::memcmp(AncestorType::data + offset, cstr, len))
-						return offset;
-				}
-			}
-		}
-		return npos;
+		return find(cstr, offset, len);
 	}
 
 
@@ -1455,19 +1405,7 @@ namespace Yuni
 	inline typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::ifind_first_of(char c, Size offset) const
 	{
-		if (offset < AncestorType::size)
-		{
-			c = static_cast<char>(ToLower(c));
-			const char* p   = AncestorType::data + offset;
-			const char* end = AncestorType::data + (AncestorType::size);
-
-			for (; p != end; ++p)
-			{
-				if (c == static_cast<char>(ToLower(*p)))
-					return static_cast<Size>(p - AncestorType::data);
-			}
-		}
-		return npos;
+		return ifind(c, offset);
 	}
 
 
@@ -1478,20 +1416,10 @@ namespace Yuni
 	{
 		if (offset < AncestorType::size and not sequence.empty())
 		{
-			const char* p    = AncestorType::data + offset;
-			const char* end  = AncestorType::data + (AncestorType::size);
-
-			const char* jfirst = sequence.c_str();
-			const char* jend   = jfirst + sequence.size();
-
-			for (; p != end; ++p)
-			{
-				for (const char* j = jfirst; j != jend; ++j)
-				{
-					if (*j == *p)
-						return static_cast<Size>(p - AncestorType::data);
-				}
-			}
+			const char* p = Yuni::Private::CStringImpl::FindFirstOf(AncestorType::data + offset,
+				AncestorType::size - offset, sequence.c_str(), sequence.size());
+			if (p)
+				return static_cast<Size>(p - AncestorType::data);
 		}
 		return npos;
 	}
@@ -2172,15 +2100,7 @@ namespace Yuni
 	inline typename CString<ChunkSizeT,ExpandableT>::Size
 	CString<ChunkSizeT,ExpandableT>::utf8size() const
 	{
-		// this routine is not exactly as fast as strlen, but it should make no
-		// measurable difference
-		Size r = 0;
-		for (uint i = 0; i != AncestorType::size; ++i)
-		{
-			if ((AncestorType::data[i] & 0xc0) != 0x80)
-				++r;
-		}
-		return r;
+		return Yuni::Private::CStringImpl::UTF8Count(AncestorType::data, AncestorType::size);
 	}
 
 
@@ -2194,18 +2114,10 @@ namespace Yuni
 
 
 	template<uint ChunkSizeT, bool ExpandableT>
-	UTF8::Error
+	inline UTF8::Error
 	CString<ChunkSizeT,ExpandableT>::utf8valid(Size& offset) const
 	{
-		offset = 0;
-		do
-		{
-			UTF8::Char c;
-			UTF8::Error e;
-			if (UTF8::errNone != ((e = utf8next<false>(offset, c))))
-				return (e == UTF8::errOutOfBound) ? UTF8::errNone : e;
-		}
-		while (true);
+		return Yuni::Private::CStringImpl::UTF8Validate(AncestorType::data, AncestorType::size, offset);
 	}
 
 
@@ -3416,12 +3328,7 @@ namespace Yuni
 	template<uint ChunkSizeT, bool ExpandableT>
 	inline size_t CString<ChunkSizeT,ExpandableT>::hash() const
 	{
-		size_t hash = 0;
-		const char* p   = AncestorType::data;
-		const char* end = AncestorType::data + AncestorType::size;
-		for (; p != end; ++p)
-			hash = static_cast<uint>(*p) + (hash << 6) + (hash << 16) - hash;
-		return hash;
+		return Yuni::Hash::Buffer(AncestorType::data, AncestorType::size);
 	}
 
 
@@ -3453,27 +3360,26 @@ namespace Yuni
 		if ((wbuffer == nullptr) or wsize == 0)
 			return false;
 
-		size_t needed = Yuni::Private::CStringImpl::WCharToUTF8SizeNeeded(wbuffer, wsize);
-		if (needed == 0)
+		// worst case: 4 bytes per UTF-32 code point, 3 bytes per UTF-16 code unit
+		// (a surrogate pair is 2 code units for 4 bytes)
+		const Size maxBytesPerUnit = (sizeof(wchar_t) == 4) ? 4 : 3;
+		if (wsize > (static_cast<Size>(-1) - AncestorType::size - 1) / maxBytesPerUnit)
 			return false;
-
-		// resize the internal buffer
-		reserve(AncestorType::size + static_cast<Size>(needed) + zeroTerminated);
-
-		Size maxAllowedSize = capacity() - AncestorType::size;
-		if (maxAllowedSize <= 1)
-			return false; // failed to extend the string
-		maxAllowedSize -= static_cast<uint>(zeroTerminated);
+		reserve(AncestorType::size + wsize * maxBytesPerUnit + zeroTerminated);
 
 		char* cstr = data();
-		if (cstr == nullptr) // making sure that the buffer has been allocated
-			return false;
+		if (cstr == nullptr or capacity() < AncestorType::size + wsize * maxBytesPerUnit)
+			return false; // failed to extend the string
 		cstr += AncestorType::size;
 
-		size_t written = Yuni::Private::CStringImpl::WCharToUTF8(cstr, maxAllowedSize, wbuffer, wsize);
-		if (written != 0)
+		size_t written;
+		if (sizeof(wchar_t) == 4)
+			written = Yuni::Private::CStringImpl::UTF32ToUTF8(cstr, reinterpret_cast<const uint32*>(wbuffer), wsize);
+		else
+			written = Yuni::Private::CStringImpl::UTF16ToUTF8(cstr, reinterpret_cast<const uint16*>(wbuffer), wsize);
+
+		if (written != 0 and written != static_cast<size_t>(-1))
 		{
-			assert(AncestorType::size + written < capacity());
 			resize(AncestorType::size + static_cast<Size>(written)); // making sure that the string is zero-terminated
 			return true;
 		}
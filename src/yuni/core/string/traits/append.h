@@ -180,15 +180,10 @@ namespace CString
 				}
 				# else
 				{
-					typename CStringT::Type buffer[32];
-					// On Windows, it may return a negative value
-					if (YUNI_PRIVATE_MEMBUF_SPTRINF(buffer, sizeof(buffer), "%p", rhs) >= 0)
-					{
-						s.appendWithoutChecking(buffer,
-							Yuni::Traits::Length<typename CStringT::Type*, typename CStringT::Size>::Value(buffer));
-					}
-					else
-						s.appendWithoutChecking("0x0", 3);
+					// like printf("%p")
+					s.appendWithoutChecking("0x", 2);
+					Yuni::Private::CStringImpl::From<Math::Base::HexaLowercase, uintptr_t>::AppendTo(s,
+						reinterpret_cast<uintptr_t>(rhs));
 				}
 				# endif
 			}
@@ -211,24 +206,6 @@ namespace CString
 
 
 
-# define YUNI_PRIVATE_MEMORY_BUFFER_APPEND_IMPL(BUFSIZE, FORMAT, TYPE) \
-	template<class CStringT> \
-	class Append<CStringT, TYPE> final \
-	{ \
-	public: \
-		static void Perform(CStringT& s, const TYPE rhs) \
-		{ \
-			typename CStringT::Type buffer[BUFSIZE]; \
-			/* On Windows, it may return a negative value */ \
-			if (YUNI_PRIVATE_MEMBUF_SPTRINF(buffer, BUFSIZE, FORMAT, rhs) >= 0) \
-			{ \
-				buffer[BUFSIZE - 1] = '\0'; /* making sure that it is zero-terminated */ \
-				s.appendWithoutChecking(buffer, \
-					Yuni::Traits::Length<typename CStringT::Type*, typename CStringT::Size>::Value(buffer)); \
-			} \
-		} \
-	}
-
 # define YUNI_PRIVATE_MEMORY_BUFFER_APPEND_IMPL_INT(TYPE) \
 	template<class CStringT> \
 	class Append<CStringT, TYPE> final \
@@ -252,8 +229,31 @@ namespace CString
 	YUNI_PRIVATE_MEMORY_BUFFER_APPEND_IMPL_INT(unsigned long);
 	# endif
 
-	YUNI_PRIVATE_MEMORY_BUFFER_APPEND_IMPL(256, "%f",  float);
-	YUNI_PRIVATE_MEMORY_BUFFER_APPEND_IMPL(256, "%f",  double);
+
+
+	// double (like printf("%f"), without depending on the current locale)
+	template<class CStringT>
+	class Append<CStringT, double> final
+	{
+	public:
+		static void Perform(CStringT& s, const double rhs)
+		{
+			char buffer[Yuni::Private::CStringImpl::formatDoubleCapacity];
+			s.appendWithoutChecking(buffer, Yuni::Private::CStringImpl::FormatDouble(buffer, rhs));
+		}
+	};
+
+	// float (promoted to double, like printf)
+	template<class CStringT>
+	class Append<CStringT, float> final
+	{
+	public:
+		static void Perform(CStringT& s, const float rhs)
+		{
+			char buffer[Yuni::Private::CStringImpl::formatDoubleCapacity];
+			s.appendWithoutChecking(buffer, Yuni::Private::CStringImpl::FormatDouble(buffer, static_cast<double>(rhs)));
+		}
+	};
 
 
 
@@ -10,7 +10,10 @@
 */
 #pragma once
 #include "../../math/base.h"
+#include "number.h"
 #include <cmath>
+#include <cassert>
+#include <type_traits>
 
 
 namespace Yuni
@@ -70,12 +73,33 @@ namespace CStringImpl
 			** \internal The operator '>' is used to avoid a compiler warning
 			*/
 			strictlyPositiveByContract = (Type(-1) > 0),
+
+			//! Maximum length of a value in base 10 (20 digits + sign)
+			decimalCapacity = 21,
 		};
 
 	public:
 		template<class S>
 		static void AppendTo(S& str, Type value, int /* precision */= 0)
 		{
+			if (BaseT::n == 10)
+			{
+				// base 10: 2 digits at a time (see FormatDecimal())
+				char buffer[static_cast<uint>(decimalCapacity)];
+				char* const end = buffer + sizeof(buffer);
+				const bool negative = IsNegative(value, std::integral_constant<bool, (0 != strictlyPositiveByContract)>());
+				// the magnitude of the minimum value is not representable by Type
+				uint count = FormatDecimal(end, (negative)
+					? uint64(0) - static_cast<uint64>(value) : static_cast<uint64>(value));
+				assert(count < sizeof(buffer));
+				if (YUNI_UNLIKELY(count >= sizeof(buffer)))
+					count = sizeof(buffer) - 1;
+				if (negative)
+					*(end - (++count)) = '-';
+				str.appendWithoutChecking(end - count, count);
+				return;
+			}
+
 			if (!value)
 			{
 				// nothing to do if equals to 0
@@ -126,6 +150,11 @@ namespace CStringImpl
 			}
 		}
 
+	private:
+		//! Get if a value is negative (never for an unsigned type)
+		static bool IsNegative(Type, std::true_type) { return false; }
+		static bool IsNegative(Type value, std::false_type) { return value < 0; }
+
 	}; // class From<T>
 
 
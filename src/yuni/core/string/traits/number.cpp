@@ -0,0 +1,434 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "number.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <locale.h>
+#if defined(YUNI_OS_MAC) || defined(YUNI_OS_FREEBSD)
+#	include <xlocale.h>
+#endif
+
+// Clinger's fast path requires the floating point operations to be performed
+// with the precision of their type (not the case with the x87 FPU for example)
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#	define YUNI_STRING_NUMBER_CLINGER
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	namespace // anonymous
+	{
+
+		//! Write 6 decimal digits (zero-padded)
+		inline void FormatSixDigits(char* p, uint32 v)
+		{
+			const char* const pairs = DigitPairs();
+			uint a = (v / 10000u) * 2;
+			uint b = ((v / 100u) % 100u) * 2;
+			uint c = (v % 100u) * 2;
+			p[0] = pairs[a];
+			p[1] = pairs[a + 1];
+			p[2] = pairs[b];
+			p[3] = pairs[b + 1];
+			p[4] = pairs[c];
+			p[5] = pairs[c + 1];
+		}
+
+
+		/*!
+		** \brief Write a big integer `m * 2^e` in base 10 (the integral part of large doubles)
+		** \return The number of digits
+		*/
+		uint FormatBigInteger(char* buffer, uint64 m, uint e)
+		{
+			// 2^1024 requires 33 limbs of 32 bits
+			enum { limbCount = 34 };
+			uint32 limbs[limbCount];
+			memset(limbs, 0, sizeof(limbs));
+			uint index = e / 32;
+			uint shift = e % 32;
+			uint64 low = m << shift;
+			uint64 high = (shift != 0) ? (m >> (64 - shift)) : 0;
+			limbs[index] = static_cast<uint32>(low);
+			limbs[index + 1] = static_cast<uint32>(low >> 32);
+			if (index + 2 < static_cast<uint>(limbCount))
+				limbs[index + 2] = static_cast<uint32>(high);
+			uint used = (index + 3 < static_cast<uint>(limbCount)) ? index + 3 : static_cast<uint>(limbCount);
+
+			// chunks of 9 digits, the least significant first
+			char chunks[limbCount * 10 + 9];
+			char* end = chunks + sizeof(chunks);
+			char* p = end;
+			while (used != 0)
+			{
+				uint64 remainder = 0;
+				for (uint i = used; i-- != 0; )
+				{
+					uint64 current = (remainder << 32) | limbs[i];
+					limbs[i] = static_cast<uint32>(current / 1000000000u);
+					remainder = current % 1000000000u;
+				}
+				while (used != 0 and limbs[used - 1] == 0)
+					--used;
+
+				uint32 chunk = static_cast<uint32>(remainder);
+				if (used != 0)
+				{
+					for (uint d = 0; d != 9; ++d, chunk /= 10)
+						*--p = static_cast<char>('0' + chunk % 10);
+				}
+				else
+					p -= FormatDecimal(p, chunk);
+			}
+			uint length = static_cast<uint>(end - p);
+			memcpy(buffer, p, length);
+			return length;
+		}
+
+
+		/*!
+		** \brief Round `f * 10^6 / 2^shift` to the nearest integer, ties to even
+		**
+		** \param f The fractional part (< 2^shift, < 2^53)
+		** \param shift The number of fractional bits (1..73)
+		*/
+		inline uint32 RoundMillionths(uint64 f, uint shift)
+		{
+			// f * 10^6 on 128 bits (f < 2^53, hence the high part of f < 2^21)
+			uint64 t = (f >> 32) * 1000000u;
+			uint64 l = (f & 0xFFFFFFFFu) * 1000000u;
+			uint64 lo = (t << 32) + l;
+			uint64 hi = (t >> 32) + ((lo < l) ? 1 : 0);
+
+			uint64 q;
+			bool roundBit;
+			bool sticky;
+			if (shift < 64)
+			{
+				q = (hi << (64 - shift)) | (lo >> shift);
+				roundBit = 0 != ((lo >> (shift - 1)) & 1u);
+				sticky = (shift > 1) and 0 != (lo & ((uint64(1) << (shift - 1)) - 1));
+			}
+			else
+			{
+				q = hi >> (shift - 64);
+				uint k = shift - 1; // the round bit
+				if (k >= 64)
+				{
+					roundBit = 0 != ((hi >> (k - 64)) & 1u);
+					sticky = lo != 0 or (k > 64 and 0 != (hi & ((uint64(1) << (k - 64)) - 1)));
+				}
+				else
+				{
+					roundBit = 0 != (lo >> 63);
+					sticky = 0 != (lo & ((uint64(1) << 63) - 1));
+				}
+			}
+			if (roundBit and (sticky or (q & 1u)))
+				++q;
+			return static_cast<uint32>(q);
+		}
+
+
+		# ifdef YUNI_STRING_NUMBER_CLINGER
+		//! Powers of 10 exactly representable by a double
+		const double exactPowers10[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+		};
+
+		//! Powers of 10 exactly representable by a float
+		const float exactPowers10f[] =
+		{
+			1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+		};
+		# endif
+
+
+		/*!
+		** \brief Decompose a plain decimal number (`[+-]digits[.digits][(e|E)[+-]digits]`)
+		**
+		** \param[out] w The significant digits (19 at most)
+		** \param[out] exp10 The power of 10
+		** \return False if the string is not a plain decimal number, or too long
+		*/
+		bool DecomposeDecimal(const char* s, uint len, bool& negative, uint64& w, int& exp10)
+		{
+			uint i = 0;
+			negative = false;
+			if (i < len and (s[i] == '-' or s[i] == '+'))
+			{
+				negative = (s[i] == '-');
+				++i;
+			}
+
+			w = 0;
+			exp10 = 0;
+			uint digits = 0;
+			bool any = false;
+			for (; i < len and s[i] >= '0' and s[i] <= '9'; ++i)
+			{
+				any = true;
+				uint d = static_cast<uint>(s[i] - '0');
+				if (w != 0 or d != 0)
+				{
+					if (++digits > 19)
+						return false;
+					w = w * 10 + d;
+				}
+			}
+			if (i < len and s[i] == '.')
+			{
+				for (++i; i < len and s[i] >= '0' and s[i] <= '9'; ++i)
+				{
+					any = true;
+					uint d = static_cast<uint>(s[i] - '0');
+					if (w != 0 or d != 0)
+					{
+						if (++digits > 19)
+							return false;
+						w = w * 10 + d;
+					}
+					--exp10;
+				}
+			}
+			if (not any)
+				return false;
+
+			if (i < len and (s[i] == 'e' or s[i] == 'E'))
+			{
+				++i;
+				bool negativeExponent = false;
+				if (i < len and (s[i] == '-' or s[i] == '+'))
+				{
+					negativeExponent = (s[i] == '-');
+					++i;
+				}
+				if (i == len)
+					return false;
+				int e = 0;
+				for (; i < len and s[i] >= '0' and s[i] <= '9'; ++i)
+				{
+					if (e > 100000) // far beyond the fast path anyway
+						return false;
+					e = e * 10 + (s[i] - '0');
+				}
+				exp10 += (negativeExponent) ? -e : e;
+			}
+			return (i == len);
+		}
+
+
+		# if defined(YUNI_OS_LINUX) || defined(YUNI_OS_MAC) || defined(YUNI_OS_FREEBSD)
+
+		locale_t CLocale()
+		{
+			static const locale_t locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
+			return locale;
+		}
+
+		inline double StrToD(const char* s, char** end) { return strtod_l(s, end, CLocale()); }
+		inline float StrToF(const char* s, char** end) { return strtof_l(s, end, CLocale()); }
+
+		# elif defined(YUNI_OS_MSVC)
+
+		_locale_t CLocale()
+		{
+			static const _locale_t locale = _create_locale(LC_ALL, "C");
+			return locale;
+		}
+
+		inline double StrToD(const char* s, char** end) { return _strtod_l(s, end, CLocale()); }
+		// Visual Studio did not support strtof
+		inline float StrToF(const char* s, char** end) { return static_cast<float>(_strtod_l(s, end, CLocale())); }
+
+		# else
+
+		inline double StrToD(const char* s, char** end) { return ::strtod(s, end); }
+		inline float StrToF(const char* s, char** end) { return ::strtof(s, end); }
+
+		# endif
+
+
+		//! The C routines, for everything not handled by the fast path (hexadecimal, inf, nan...)
+		template<class T, T (*ConvertT)(const char*, char**)>
+		bool ParseWithCRoutine(const char* s, uint len, T& out)
+		{
+			char stackBuffer[256];
+			char* buffer = (len < sizeof(stackBuffer)) ? stackBuffer : new char[len + 1];
+			memcpy(buffer, s, len);
+			buffer[len] = '\0';
+
+			char* end = nullptr;
+			out = ConvertT(buffer, &end);
+			bool success = (end == buffer + len);
+
+			if (buffer != stackBuffer)
+				delete[] buffer;
+			return success;
+		}
+
+
+	} // anonymous namespace
+
+
+
+
+	uint FormatDouble(char* buffer, double value)
+	{
+		uint64 bits;
+		memcpy(&bits, &value, sizeof(bits));
+		uint biasedExponent = static_cast<uint>((bits >> 52) & 0x7FFu);
+		if (biasedExponent == 0x7FFu)
+		{
+			// inf / nan: the spelling depends on the C library
+			int n = ::snprintf(buffer, formatDoubleCapacity, "%f", value);
+			return (n > 0) ? static_cast<uint>(n) : 0;
+		}
+
+		char* p = buffer;
+		if (0 != (bits >> 63))
+			*p++ = '-';
+
+		uint64 m = bits & ((uint64(1) << 52) - 1);
+		int e;
+		if (biasedExponent != 0)
+		{
+			m |= uint64(1) << 52;
+			e = static_cast<int>(biasedExponent) - 1075;
+		}
+		else
+			e = -1074; // subnormal
+
+		uint64 integral;
+		uint32 millionths;
+		if (e >= 0)
+		{
+			if (e > 11) // more than 64 bits
+			{
+				p += FormatBigInteger(p, m, static_cast<uint>(e));
+				memcpy(p, ".000000", 7);
+				return static_cast<uint>(p + 7 - buffer);
+			}
+			integral = m << e;
+			millionths = 0;
+		}
+		else
+		{
+			uint shift = static_cast<uint>(-e);
+			if (shift >= 74 or m == 0)
+			{
+				// m * 10^6 < 2^73: always rounded to 0
+				integral = 0;
+				millionths = 0;
+			}
+			else
+			{
+				integral = (shift < 64) ? (m >> shift) : 0;
+				uint64 f = (shift < 64) ? (m & ((uint64(1) << shift) - 1)) : m;
+				millionths = RoundMillionths(f, shift);
+				if (millionths == 1000000u)
+				{
+					millionths = 0;
+					++integral;
+				}
+			}
+		}
+
+		char digits[20];
+		uint count = FormatDecimal(digits + sizeof(digits), integral);
+		memcpy(p, digits + sizeof(digits) - count, count);
+		p += count;
+		*p++ = '.';
+		FormatSixDigits(p, millionths);
+		return static_cast<uint>(p + 6 - buffer);
+	}
+
+
+	bool ParseDouble(const char* s, uint len, double& out)
+	{
+		# ifdef YUNI_STRING_NUMBER_CLINGER
+		bool negative;
+		uint64 w;
+		int exp10;
+		if (DecomposeDecimal(s, len, negative, w, exp10))
+		{
+			if (w == 0)
+			{
+				out = (negative) ? -0. : 0.;
+				return true;
+			}
+			// both the significand and the power of 10 are exact: a single rounding
+			if (w <= (uint64(1) << 53) and exp10 >= -22 and exp10 <= 22)
+			{
+				double d = static_cast<double>(w);
+				d = (exp10 < 0) ? d / exactPowers10[-exp10] : d * exactPowers10[exp10];
+				out = (negative) ? -d : d;
+				return true;
+			}
+		}
+		# endif
+		return ParseWithCRoutine<double, &StrToD>(s, len, out);
+	}
+
+
+	bool ParseFloat(const char* s, uint len, float& out)
+	{
+		# ifdef YUNI_STRING_NUMBER_CLINGER
+		bool negative;
+		uint64 w;
+		int exp10;
+		if (DecomposeDecimal(s, len, negative, w, exp10))
+		{
+			if (w == 0)
+			{
+				out = (negative) ? -0.f : 0.f;
+				return true;
+			}
+			# ifndef YUNI_OS_MSVC
+			if (w <= (uint64(1) << 24) and exp10 >= -10 and exp10 <= 10)
+			{
+				float f = static_cast<float>(w);
+				f = (exp10 < 0) ? f / exactPowers10f[-exp10] : f * exactPowers10f[exp10];
+				out = (negative) ? -f : f;
+				return true;
+			}
+			# else
+			// rounded to a double first, like before
+			if (w <= (uint64(1) << 53) and exp10 >= -22 and exp10 <= 22)
+			{
+				double d = static_cast<double>(w);
+				d = (exp10 < 0) ? d / exactPowers10[-exp10] : d * exactPowers10[exp10];
+				out = static_cast<float>((negative) ? -d : d);
+				return true;
+			}
+			# endif
+		}
+		# endif
+		return ParseWithCRoutine<float, &StrToF>(s, len, out);
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
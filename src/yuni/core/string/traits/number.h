@@ -0,0 +1,90 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+
+/*
+** Locale-free conversions between numbers and strings, working directly on
+** non-zero-terminated buffers (no copy, no allocation in the common cases).
+**
+** The results are the same as the C routines used previously (`printf("%f")`,
+** `strtol()` and co, `strtod()`) in the "C" locale.
+*/
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	//! Pairs of decimal digits, from "00" to "99"
+	const char* DigitPairs();
+
+	/*!
+	** \brief Write an unsigned integer in base 10, backward from the end of a buffer
+	**
+	** \param end The end of the buffer (the last digit is written at `end[-1]`)
+	** \return The number of digits (20 at most)
+	*/
+	uint FormatDecimal(char* end, uint64 value);
+
+
+	enum
+	{
+		//! Minimum capacity for the buffer given to FormatDouble()
+		formatDoubleCapacity = 320,
+	};
+
+	/*!
+	** \brief Format a double like `printf("%f")` in the "C" locale
+	**
+	** \param buffer A buffer of `formatDoubleCapacity` bytes at least (not zero-terminated)
+	** \return The length of the result
+	*/
+	YUNI_DECL uint FormatDouble(char* buffer, double value);
+
+
+	/*!
+	** \brief Parse an integer like `strtol()` and co
+	**
+	** The base is detected from the prefix (`#` or `0x` for hexadecimal values).
+	** Out-of-range values are saturated, and negative values for unsigned types
+	** are negated, like the C routines.
+	** \tparam T The result type of the C routine (long, long long, unsigned long or unsigned long long)
+	** \return True if the whole string has been consumed
+	*/
+	template<class T> bool ParseInteger(const char* s, uint len, T& out);
+
+	/*!
+	** \brief Parse a double like `strtod()` in the "C" locale
+	**
+	** \return True if the whole string has been consumed
+	*/
+	YUNI_DECL bool ParseDouble(const char* s, uint len, double& out);
+
+	/*!
+	** \brief Parse a float like `strtof()` in the "C" locale
+	**
+	** \return True if the whole string has been consumed
+	*/
+	YUNI_DECL bool ParseFloat(const char* s, uint len, float& out);
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
+
+#include "number.hxx"
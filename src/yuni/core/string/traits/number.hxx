@@ -0,0 +1,203 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "number.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	inline const char* DigitPairs()
+	{
+		return
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+	}
+
+
+	inline uint FormatDecimal(char* end, uint64 value)
+	{
+		const char* const pairs = DigitPairs();
+		char* p = end;
+
+		// 64 bits divisions only when really required
+		while (value > 0xFFFFFFFFu)
+		{
+			uint i = static_cast<uint>(value % 100u) * 2;
+			value /= 100u;
+			p -= 2;
+			p[0] = pairs[i];
+			p[1] = pairs[i + 1];
+		}
+
+		uint32 v = static_cast<uint32>(value);
+		while (v >= 100)
+		{
+			uint i = (v % 100u) * 2;
+			v /= 100u;
+			p -= 2;
+			p[0] = pairs[i];
+			p[1] = pairs[i + 1];
+		}
+		if (v >= 10)
+		{
+			p -= 2;
+			p[0] = pairs[v * 2];
+			p[1] = pairs[v * 2 + 1];
+		}
+		else
+			*--p = static_cast<char>('0' + v);
+		return static_cast<uint>(end - p);
+	}
+
+
+
+
+	namespace NumberImpl
+	{
+
+		//! Value of a digit (in any base up to 36), 36 or more if not a digit
+		inline uint DigitValue(char c)
+		{
+			if (c >= '0' and c <= '9')
+				return static_cast<uint>(c - '0');
+			if (c >= 'a' and c <= 'z')
+				return static_cast<uint>(c - 'a' + 10);
+			if (c >= 'A' and c <= 'Z')
+				return static_cast<uint>(c - 'A' + 10);
+			return 36;
+		}
+
+		//! isspace() in the "C" locale
+		inline bool IsSpace(char c)
+		{
+			return c == ' ' or (c >= '\t' and c <= '\r');
+		}
+
+
+		template<class T, bool SignedT = (T(-1) < T(0))>
+		struct IntegerLimits final
+		{
+			static T Max() { return static_cast<T>(~T(0)); }
+			static T Saturate(bool) { return Max(); }
+		};
+
+		template<class T>
+		struct IntegerLimits<T, true> final
+		{
+			typedef unsigned long long U;
+			static T Max() { return static_cast<T>(static_cast<U>(~U(0)) >> (64 - sizeof(T) * 8 + 1)); }
+			static T Saturate(bool negative) { return (negative) ? static_cast<T>(-Max() - 1) : Max(); }
+		};
+
+	} // namespace NumberImpl
+
+
+	template<class T>
+	bool ParseInteger(const char* s, uint len, T& out)
+	{
+		using namespace NumberImpl;
+		typedef unsigned long long U;
+
+		// prefix for hexadecimal values (`#`, `0x`), before anything else
+		uint i = 0;
+		uint base = 10;
+		if (len != 0)
+		{
+			if (s[0] == '#')
+			{
+				base = 16;
+				i = 1;
+			}
+			else if (len > 2 and s[0] == '0' and (s[1] == 'x' or s[1] == 'X'))
+			{
+				base = 16;
+				i = 2;
+			}
+		}
+		const uint prefix = i;
+
+		// spaces and sign
+		while (i < len and IsSpace(s[i]))
+			++i;
+		bool negative = false;
+		if (i < len and (s[i] == '-' or s[i] == '+'))
+		{
+			negative = (s[i] == '-');
+			++i;
+		}
+		// strtol() accepts (again) the prefix `0x` in base 16
+		if (base == 16 and i + 2 < len and s[i] == '0' and (s[i + 1] == 'x' or s[i + 1] == 'X')
+			and DigitValue(s[i + 2]) < 16)
+			i += 2;
+
+		const uint first = i;
+		const U limit = static_cast<U>(IntegerLimits<T>::Max());
+		const U cutoff = limit / base;
+		const uint cutlim = static_cast<uint>(limit % base);
+		U acc = 0;
+		bool overflow = false;
+		for (; i < len; ++i)
+		{
+			uint d = DigitValue(s[i]);
+			if (d >= base)
+				break;
+			if (acc > cutoff or (acc == cutoff and d > cutlim))
+				overflow = true;
+			else
+				acc = acc * base + d;
+		}
+
+		if (i == first)
+		{
+			// no conversion, the end is right after the prefix
+			out = T();
+			return (prefix == len);
+		}
+
+		if (T(-1) < T(0))
+		{
+			// signed: the minimum (whose magnitude is greater than the maximum)
+			// is reached by saturation
+			if (overflow)
+				out = IntegerLimits<T>::Saturate(negative);
+			else
+				out = (negative) ? static_cast<T>(-static_cast<T>(acc)) : static_cast<T>(acc);
+		}
+		else
+		{
+			if (overflow)
+				out = IntegerLimits<T>::Max();
+			else
+				out = (negative) ? static_cast<T>(U(0) - acc) : static_cast<T>(acc);
+		}
+		return (i == len);
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
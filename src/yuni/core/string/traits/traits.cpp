@@ -11,11 +11,6 @@
 #include "../../../yuni.h"
 #include "traits.h"
 #include <ctype.h>
-#ifndef YUNI_OS_WINDOWS
-#include <wchar.h>
-#else
-#include "../../../core/system/windows.hdr.h"
-#endif
 #include <limits.h>
 
 
@@ -126,37 +121,46 @@ namespace CStringImpl
 		if (length > INT_MAX) // consistency between platforms (windows)
 			return 0;
 
-		#ifndef YUNI_OS_WINDOWS
+		// wchar_t is UTF-32 on unixes, UTF-16 on Windows (no locale involved)
+		size_t needed = 0;
+		for (size_t i = 0; i != length; ++i)
 		{
-			mbstate_t state;
-			memset (&state, '\0', sizeof (state));
-			size_t written = wcsnrtombs(nullptr, &wbuffer, length, 0, &state);
-			return (written != (size_t) -1) ? written : 0;
-		}
-		#else
-		{
-			int sizeRequired = WideCharToMultiByte(CP_UTF8, 0, wbuffer, static_cast<int>(length), nullptr, 0,  nullptr, nullptr);
-			return sizeRequired > 0 ? (size_t) sizeRequired : 0;
+			uint32 cp = static_cast<uint32>(wbuffer[i]);
+			if (cp < 0x80u)
+				needed += 1;
+			else if (cp < 0x800u)
+				needed += 2;
+			else if (cp >= 0xD800u and cp <= 0xDFFFu)
+			{
+				// surrogate pair (UTF-16 only)
+				if (sizeof(wchar_t) == 4 or cp >= 0xDC00u or i + 1 == length)
+					return 0;
+				uint32 low = static_cast<uint32>(wbuffer[++i]);
+				if (low < 0xDC00u or low > 0xDFFFu)
+					return 0;
+				needed += 4;
+			}
+			else if (cp < 0x10000u)
+				needed += 3;
+			else if (cp <= 0x10FFFFu)
+				needed += 4;
+			else
+				return 0;
 		}
-		#endif
+		return needed;
 	}
 
 
 	size_t WCharToUTF8(char*& out, size_t maxlength, const wchar_t* wbuffer, size_t length)
 	{
-		#ifndef YUNI_OS_WINDOWS
-		{
-			mbstate_t state;
-			memset (&state, '\0', sizeof (state));
-			size_t written = wcsnrtombs(out, &wbuffer, length, maxlength, &state);
-			return (written != (size_t) -1) ? written : 0;
-		}
-		#else
-		{
-			int written = WideCharToMultiByte(CP_UTF8, 0, wbuffer, static_cast<int>(length), out, maxlength,  nullptr, nullptr);
-			return (written > 0) ? (size_t) written : 0;
-		}
-		#endif
+		size_t needed = WCharToUTF8SizeNeeded(wbuffer, length);
+		if (needed == 0 or needed > maxlength)
+			return 0;
+
+		size_t written = (sizeof(wchar_t) == 4)
+			? UTF32ToUTF8(out, reinterpret_cast<const uint32*>(wbuffer), length)
+			: UTF16ToUTF8(out, reinterpret_cast<const uint16*>(wbuffer), length);
+		return (written != static_cast<size_t>(-1)) ? written : 0;
 	}
 
 
@@ -15,6 +15,7 @@
 #endif
 #include <string.h>
 #include "../../math/math.h"
+#include "../utf8char.h"
 
 
 
@@ -40,6 +41,38 @@ namespace CStringImpl
 	YUNI_DECL bool Glob(const char* const s, uint l1, const char* const pattern, uint patternlen);
 
 
+	/*!
+	** \brief Search primitives (SSE2 / AVX2 when available, selected at runtime)
+	**
+	** All functions return a pointer to the first match within `s` (`len` bytes)
+	** or null if not found. The case-insensitive variants only fold ASCII letters.
+	*/
+	YUNI_DECL const char* FindChar(const char* s, uint len, char c);
+	YUNI_DECL const char* IFindChar(const char* s, uint len, char c);
+	YUNI_DECL const char* FindFirstOf(const char* s, uint len, const char* set, uint setlen);
+	YUNI_DECL const char* Find(const char* s, uint len, const char* needle, uint nlen);
+	YUNI_DECL const char* IFind(const char* s, uint len, const char* needle, uint nlen);
+	YUNI_DECL uint CountChar(const char* s, uint len, char c);
+
+
+	/*!
+	** \brief UTF-8 primitives (SSE2 / AVX2 when available, selected at runtime)
+	**
+	** The validation is strict (overlong sequences, surrogates and code points
+	** beyond U+10FFFF are rejected). `offset` is the offset of the first invalid
+	** sequence, or `len` if the string is valid.
+	** The transcoders return the number of code units written, `(size_t) -1` if
+	** the input is invalid. The output must be large enough for the worst case:
+	** `len` units from UTF-8, `4 * len` bytes from UTF-32 and `3 * len` bytes from UTF-16.
+	*/
+	YUNI_DECL UTF8::Error UTF8Validate(const char* s, uint len, uint& offset);
+	YUNI_DECL uint UTF8Count(const char* s, uint len);
+	YUNI_DECL size_t UTF8ToUTF32(uint32* out, const char* s, size_t len);
+	YUNI_DECL size_t UTF8ToUTF16(uint16* out, const char* s, size_t len);
+	YUNI_DECL size_t UTF32ToUTF8(char* out, const uint32* s, size_t len);
+	YUNI_DECL size_t UTF16ToUTF8(char* out, const uint16* s, size_t len);
+
+
 	YUNI_DECL size_t WCharToUTF8SizeNeeded(const wchar_t* wbuffer, size_t length);
 	YUNI_DECL size_t WCharToUTF8(char*& out, size_t maxlength, const wchar_t* wbuffer, size_t length);
 
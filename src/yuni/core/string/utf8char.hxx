@@ -10,6 +10,9 @@
 */
 #pragma once
 #include "utf8char.h"
+#ifdef YUNI_HAS_STL_HASH
+#	include <functional>
+#endif
 
 
 
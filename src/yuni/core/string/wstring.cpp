@@ -9,11 +9,7 @@
 ** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
 */
 #include "wstring.h"
-#ifdef YUNI_OS_WINDOWS
-#include "../system/windows.hdr.h"
-#else
-#include <wchar.h>
-#endif
+#include "traits/traits.h"
 #include "limits.h"
 
 
@@ -26,7 +22,7 @@ namespace Yuni
 		: pSize(rhs.pSize)
 	{
 		pWString = (wchar_t*)::malloc(sizeof(wchar_t) * (pSize + 1));
-		memcpy(pWString, rhs.pWString, pSize + 1);
+		memcpy(pWString, rhs.pWString, sizeof(wchar_t) * (pSize + 1));
 	}
 
 
@@ -35,7 +31,7 @@ namespace Yuni
 		free(pWString);
 		pSize = rhs.pSize;
 		pWString = (wchar_t*)::malloc(sizeof(wchar_t) * (pSize + 1));
-		memcpy(pWString, rhs.pWString, pSize + 1);
+		memcpy(pWString, rhs.pWString, sizeof(wchar_t) * (pSize + 1));
 		return *this;
 	}
 
@@ -68,67 +64,25 @@ namespace Yuni
 		// Offset according to the presence of the UNC prefix
 		const uint offset = (not uncprefix) ? 0 : 4;
 
-		#ifdef YUNI_OS_WINDOWS
+		// The UTF-8 string never requires more code units than its size in bytes
+		// (UTF-32 on unixes, UTF-16 on Windows, no locale involved)
+		pSize = string.size() + offset;
+		pWString = (wchar_t*) realloc(pWString, sizeof(wchar_t) * (pSize + 1));
+		if (nullptr == pWString) // Impossible to allocate the buffer. Aborting.
 		{
-			// Allocate and convert the C-String. Several iterations may be required
-			// for allocating enough room for the conversion.
-			const int sizeRequired = MultiByteToWideChar(CP_UTF8, 0, string.c_str(), string.size(), nullptr, 0);
-			if (sizeRequired <= 0)
-			{
-				clear();
-				return;
-			}
-
-			pSize = sizeRequired + offset;
-
-			pWString = (wchar_t*) realloc(pWString, sizeof(wchar_t) * (pSize + 1));
-			if (nullptr == pWString) // Impossible to allocate the buffer. Aborting.
-			{
-				clear();
-				return;
-			}
-
-			// Converting into Wide String
-			const int n = MultiByteToWideChar(CP_UTF8, 0, string.c_str(), static_cast<int>(string.size()), pWString + offset, static_cast<int>(pSize - offset));
-			if (n != sizeRequired)
-			{
-				assert(false and "most likely an error");
-				clear();
-				return;
-			}
+			clear();
+			return;
 		}
-		#else
-		{
-			const char* wcstr = string.c_str();
-
-			mbstate_t state;
-			memset (&state, '\0', sizeof (state));
 
-			size_t sizeRequired = mbsnrtowcs(nullptr, &wcstr, string.size(), 0, &state);
-			if (0 == sizeRequired or (size_t) -1 == sizeRequired)
-			{
-				clear();
-				return;
-			}
-
-			pSize = sizeRequired + offset;
-
-			pWString = (wchar_t*) realloc(pWString, sizeof(wchar_t) * (pSize + 1));
-			if (nullptr == pWString) // Impossible to allocate the buffer. Aborting.
-			{
-				clear();
-				return;
-			}
-
-			memset (&state, '\0', sizeof (state));
-			size_t written = mbsnrtowcs(pWString + offset, &wcstr, string.size(), pSize - offset, &state);
-			if (0 == written or (size_t) -1 == written)
-			{
-				clear();
-				return;
-			}
+		size_t written = (sizeof(wchar_t) == 4)
+			? Private::CStringImpl::UTF8ToUTF32(reinterpret_cast<uint32*>(pWString + offset), string.c_str(), string.size())
+			: Private::CStringImpl::UTF8ToUTF16(reinterpret_cast<uint16*>(pWString + offset), string.c_str(), string.size());
+		if (0 == written or (size_t) -1 == written)
+		{
+			clear();
+			return;
 		}
-		#endif
+		pSize = written + offset;
 
 
 		// prepend the Windows UNC prefix
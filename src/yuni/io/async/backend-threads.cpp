@@ -0,0 +1,295 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "backend.h"
+#include "../../thread/thread.h"
+#include <vector>
+#ifdef YUNI_OS_WINDOWS
+#	include "../../core/system/windows.hdr.h"
+#else
+#	include <sys/types.h>
+#	include <unistd.h>
+#	include <errno.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace AsyncIO
+{
+
+	namespace // anonymous
+	{
+
+		//! Read or write all buffers of a request (blocking), until the end of the file
+		sint64 Transfer(const Request& request, bool isRead)
+		{
+			uint64 total = 0;
+			uint64 offset = request.offset;
+			for (uint i = 0; i != request.count; ++i)
+			{
+				char* data = static_cast<char*>(request.buffers[i].data);
+				uint64 remaining = request.buffers[i].size;
+				while (remaining != 0)
+				{
+					# ifdef YUNI_OS_WINDOWS
+					DWORD chunk = (remaining > 0x40000000u) ? 0x40000000u : static_cast<DWORD>(remaining);
+					OVERLAPPED overlapped;
+					::ZeroMemory(&overlapped, sizeof(overlapped));
+					overlapped.Offset = static_cast<DWORD>(offset);
+					overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+					DWORD done = 0;
+					BOOL success = (isRead)
+						? ::ReadFile(request.handle, data, chunk, &done, &overlapped)
+						: ::WriteFile(request.handle, data, chunk, &done, &overlapped);
+					if (not success)
+					{
+						DWORD error = ::GetLastError();
+						if (error == ERROR_HANDLE_EOF)
+							return static_cast<sint64>(total);
+						return -static_cast<sint64>(error);
+					}
+					sint64 n = static_cast<sint64>(done);
+					# else
+					ssize_t n = (isRead)
+						? ::pread(request.handle, data, remaining, static_cast<off_t>(offset))
+						: ::pwrite(request.handle, data, remaining, static_cast<off_t>(offset));
+					if (n < 0)
+					{
+						if (errno == EINTR)
+							continue;
+						return -static_cast<sint64>(errno);
+					}
+					# endif
+					if (n == 0)
+						return static_cast<sint64>(total); // end of file
+					data += n;
+					remaining -= static_cast<uint64>(n);
+					offset += static_cast<uint64>(n);
+					total += static_cast<uint64>(n);
+				}
+			}
+			return static_cast<sint64>(total);
+		}
+
+
+		//! Flush a file to disk (blocking)
+		sint64 Sync(const Request& request)
+		{
+			# ifdef YUNI_OS_WINDOWS
+			return (::FlushFileBuffers(request.handle)) ? 0 : -static_cast<sint64>(::GetLastError());
+			# else
+			# ifdef YUNI_OS_LINUX
+			int error = (request.operation == Yuni::IO::Async::Operation::fdatasync)
+				? ::fdatasync(request.handle)
+				: ::fsync(request.handle);
+			# else
+			int error = ::fsync(request.handle);
+			# endif
+			return (error == 0) ? 0 : -static_cast<sint64>(errno);
+			# endif
+		}
+
+
+		//! Perform a request (blocking)
+		void Perform(Request& request)
+		{
+			switch (request.operation)
+			{
+				case Yuni::IO::Async::Operation::read:
+				case Yuni::IO::Async::Operation::readv:
+					request.result = Transfer(request, true);
+					break;
+				case Yuni::IO::Async::Operation::write:
+				case Yuni::IO::Async::Operation::writev:
+					request.result = Transfer(request, false);
+					break;
+				case Yuni::IO::Async::Operation::fsync:
+				case Yuni::IO::Async::Operation::fdatasync:
+					request.result = Sync(request);
+					break;
+			}
+		}
+
+
+
+
+		/*!
+		** \brief Backend performing blocking operations with a few threads
+		**
+		** Fallback when io_uring is not available. The number of operations in
+		** flight is the number of threads.
+		*/
+		class ThreadsBackend final : public IBackend
+		{
+		public:
+			explicit ThreadsBackend(Dispatcher& dispatcher) :
+				pDispatcher(dispatcher),
+				pHead(nullptr),
+				pTail(nullptr),
+				pStopping(false)
+			{}
+
+			virtual ~ThreadsBackend();
+
+			bool start(uint threadCount);
+			virtual void submit(Request* head, Request* tail) override;
+			virtual void stop() override;
+
+		private:
+			class Worker;
+
+			//! Get the next request (null if stopping)
+			Request* next();
+
+		private:
+			Dispatcher& pDispatcher;
+			Yuni::Mutex pMutex;
+			//! Notified when new requests are available (a single thread is woken up at a time)
+			Yuni::Thread::Signal pSignal;
+			//! The requests waiting for a thread
+			Request* pHead;
+			Request* pTail;
+			bool pStopping;
+			std::vector<Yuni::Thread::IThread*> pWorkers;
+
+		}; // class ThreadsBackend
+
+
+
+
+		class ThreadsBackend::Worker final : public Yuni::Thread::IThread
+		{
+		public:
+			explicit Worker(ThreadsBackend& backend) :
+				pBackend(backend)
+			{}
+
+			virtual ~Worker() {}
+
+		protected:
+			virtual bool onExecute() override
+			{
+				while (Request* request = pBackend.next())
+				{
+					Perform(*request);
+					request->next = nullptr;
+					pBackend.pDispatcher.complete(request);
+				}
+				return false;
+			}
+
+		private:
+			ThreadsBackend& pBackend;
+
+		}; // class ThreadsBackend::Worker
+
+
+
+
+		ThreadsBackend::~ThreadsBackend()
+		{
+			for (auto* worker : pWorkers)
+				delete worker;
+		}
+
+
+		bool ThreadsBackend::start(uint threadCount)
+		{
+			for (uint i = 0; i != threadCount; ++i)
+			{
+				Worker* worker = new Worker(*this);
+				if (worker->start() != Yuni::Thread::errNone)
+				{
+					delete worker;
+					break;
+				}
+				pWorkers.push_back(worker);
+			}
+			return not pWorkers.empty();
+		}
+
+
+		void ThreadsBackend::submit(Request* head, Request* tail)
+		{
+			Yuni::MutexLocker locker(pMutex);
+			if (pTail)
+				pTail->next = head;
+			else
+				pHead = head;
+			pTail = tail;
+			pSignal.notify();
+		}
+
+
+		Request* ThreadsBackend::next()
+		{
+			for (;;)
+			{
+				{
+					Yuni::MutexLocker locker(pMutex);
+					if (pHead)
+					{
+						Request* request = pHead;
+						pHead = request->next;
+						if (not pHead)
+							pTail = nullptr;
+						else
+							pSignal.notify(); // waking up another thread
+						return request;
+					}
+					if (pStopping)
+					{
+						pSignal.notify(); // waking up another thread, for stopping as well
+						return nullptr;
+					}
+					pSignal.reset();
+				}
+				pSignal.wait();
+			}
+		}
+
+
+		void ThreadsBackend::stop()
+		{
+			{
+				Yuni::MutexLocker locker(pMutex);
+				pStopping = true;
+				pSignal.notify();
+			}
+			// the remaining requests are performed before the threads exit
+			for (auto* worker : pWorkers)
+				worker->wait();
+		}
+
+
+	} // anonymous namespace
+
+
+
+
+	IBackend* IBackend::CreateThreads(Dispatcher& dispatcher, uint threadCount)
+	{
+		ThreadsBackend* backend = new ThreadsBackend(dispatcher);
+		if (backend->start(threadCount))
+			return backend;
+		delete backend;
+		return nullptr;
+	}
+
+
+
+
+} // namespace AsyncIO
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,434 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "backend.h"
+#if defined(YUNI_OS_LINUX) and defined(YUNI_HAS_LINUX_IO_URING_H)
+#	include "../../thread/thread.h"
+#	include <linux/io_uring.h>
+#	include <sys/syscall.h>
+#	include <sys/mman.h>
+#	include <sys/uio.h>
+#	include <unistd.h>
+#	include <errno.h>
+#	include <string.h>
+#	include <stddef.h>
+#	define YUNI_ASYNCIO_HAS_URING
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace AsyncIO
+{
+
+	# ifdef YUNI_ASYNCIO_HAS_URING
+
+	// the buffers are directly given to the kernel
+	static_assert(sizeof(Yuni::IO::Async::Buffer) == sizeof(struct iovec), "Buffer must match struct iovec");
+	static_assert(offsetof(Yuni::IO::Async::Buffer, data) == offsetof(struct iovec, iov_base), "Buffer must match struct iovec");
+	static_assert(offsetof(Yuni::IO::Async::Buffer, size) == offsetof(struct iovec, iov_len), "Buffer must match struct iovec");
+
+
+	namespace // anonymous
+	{
+
+		inline int SysSetup(uint entries, struct io_uring_params* params)
+		{
+			return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+		}
+
+
+		inline int SysEnter(int fd, uint toSubmit, uint minComplete, uint flags)
+		{
+			return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+		}
+
+
+
+
+		/*!
+		** \brief io_uring backend
+		**
+		** The requests are written into the submission queue by the submitting thread,
+		** then submitted with a single system call per batch. A single thread waits for
+		** the completions. The number of requests in flight is limited by the size of the
+		** completion queue (minus one, for waking up the thread), the other ones are kept
+		** in a list and submitted as soon as some requests are completed.
+		**
+		** Only `IORING_OP_READV` / `WRITEV` / `FSYNC` are used (kernel 5.1+).
+		*/
+		class UringBackend final : public IBackend
+		{
+		public:
+			explicit UringBackend(Dispatcher& dispatcher);
+			virtual ~UringBackend();
+
+			bool start(uint queueDepth);
+			virtual void submit(Request* head, Request* tail) override;
+			virtual void stop() override;
+
+		private:
+			class CompletionThread;
+
+			//! Write the pending requests into the submission queue and submit them
+			void flushWL();
+			//! Wait for completions and deliver them (completion thread)
+			bool reap();
+			//! Release all resources
+			void release();
+
+		private:
+			Dispatcher& pDispatcher;
+			Yuni::Mutex pMutex;
+			//! The requests not submitted yet
+			Request* pPendingHead;
+			Request* pPendingTail;
+			//! Number of requests in flight (submission queue and kernel)
+			uint pInflight;
+			//! Maximum number of requests in flight
+			uint pCapacity;
+			//! Stop requested, the completion thread must be woken up
+			bool pStopping;
+			bool pWakeupSubmitted;
+
+			int pFd;
+			void* pSQRing;
+			size_t pSQRingSize;
+			void* pCQRing;
+			size_t pCQRingSize;
+			struct io_uring_sqe* pSQEs;
+			size_t pSQEsSize;
+
+			uint* pSQHead;
+			uint* pSQTail;
+			uint pSQMask;
+			uint pSQEntries;
+			uint* pSQArray;
+			//! Tail of the submission queue (owned by the submitting threads)
+			uint pSQLocalTail;
+			uint* pCQHead;
+			uint* pCQTail;
+			uint pCQMask;
+			struct io_uring_cqe* pCQEs;
+
+			Yuni::Thread::IThread* pThread;
+
+		}; // class UringBackend
+
+
+
+
+		class UringBackend::CompletionThread final : public Yuni::Thread::IThread
+		{
+		public:
+			explicit CompletionThread(UringBackend& backend) :
+				pBackend(backend)
+			{}
+
+			virtual ~CompletionThread() {}
+
+		protected:
+			virtual bool onExecute() override
+			{
+				while (pBackend.reap())
+				{
+					// continue
+				}
+				return false;
+			}
+
+		private:
+			UringBackend& pBackend;
+
+		}; // class UringBackend::CompletionThread
+
+
+
+
+		UringBackend::UringBackend(Dispatcher& dispatcher) :
+			pDispatcher(dispatcher),
+			pPendingHead(nullptr),
+			pPendingTail(nullptr),
+			pInflight(0),
+			pCapacity(0),
+			pStopping(false),
+			pWakeupSubmitted(false),
+			pFd(-1),
+			pSQRing(MAP_FAILED),
+			pSQRingSize(0),
+			pCQRing(MAP_FAILED),
+			pCQRingSize(0),
+			pSQEs(static_cast<struct io_uring_sqe*>(MAP_FAILED)),
+			pSQEsSize(0),
+			pThread(nullptr)
+		{}
+
+
+		UringBackend::~UringBackend()
+		{
+			release();
+		}
+
+
+		void UringBackend::release()
+		{
+			if (pThread)
+			{
+				delete pThread;
+				pThread = nullptr;
+			}
+			if (pSQEs != MAP_FAILED)
+				::munmap(pSQEs, pSQEsSize);
+			if (pCQRing != MAP_FAILED and pCQRing != pSQRing)
+				::munmap(pCQRing, pCQRingSize);
+			if (pSQRing != MAP_FAILED)
+				::munmap(pSQRing, pSQRingSize);
+			if (pFd >= 0)
+				::close(pFd);
+			pSQEs = static_cast<struct io_uring_sqe*>(MAP_FAILED);
+			pCQRing = MAP_FAILED;
+			pSQRing = MAP_FAILED;
+			pFd = -1;
+		}
+
+
+		bool UringBackend::start(uint queueDepth)
+		{
+			struct io_uring_params params;
+			::memset(&params, 0, sizeof(params));
+			pFd = SysSetup(queueDepth, &params);
+			if (pFd < 0)
+				return false;
+
+			pSQRingSize = params.sq_off.array + params.sq_entries * sizeof(uint);
+			pCQRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+			bool singleMap = (0 != (params.features & IORING_FEAT_SINGLE_MMAP));
+			if (singleMap)
+			{
+				if (pCQRingSize > pSQRingSize)
+					pSQRingSize = pCQRingSize;
+				pCQRingSize = pSQRingSize;
+			}
+
+			pSQRing = ::mmap(nullptr, pSQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				pFd, IORING_OFF_SQ_RING);
+			if (pSQRing == MAP_FAILED)
+				return false;
+			pCQRing = (singleMap)
+				? pSQRing
+				: ::mmap(nullptr, pCQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pFd, IORING_OFF_CQ_RING);
+			if (pCQRing == MAP_FAILED)
+				return false;
+			pSQEsSize = params.sq_entries * sizeof(struct io_uring_sqe);
+			pSQEs = static_cast<struct io_uring_sqe*>(::mmap(nullptr, pSQEsSize, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, pFd, IORING_OFF_SQES));
+			if (pSQEs == MAP_FAILED)
+				return false;
+
+			char* sq = static_cast<char*>(pSQRing);
+			pSQHead    = reinterpret_cast<uint*>(sq + params.sq_off.head);
+			pSQTail    = reinterpret_cast<uint*>(sq + params.sq_off.tail);
+			pSQMask    = *reinterpret_cast<uint*>(sq + params.sq_off.ring_mask);
+			pSQEntries = *reinterpret_cast<uint*>(sq + params.sq_off.ring_entries);
+			pSQArray   = reinterpret_cast<uint*>(sq + params.sq_off.array);
+			pSQLocalTail = *pSQTail;
+
+			char* cq = static_cast<char*>(pCQRing);
+			pCQHead = reinterpret_cast<uint*>(cq + params.cq_off.head);
+			pCQTail = reinterpret_cast<uint*>(cq + params.cq_off.tail);
+			pCQMask = *reinterpret_cast<uint*>(cq + params.cq_off.ring_mask);
+			pCQEs   = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+			// one entry of the completion queue is kept for waking up the thread
+			pCapacity = params.cq_entries - 1;
+
+			pThread = new CompletionThread(*this);
+			return (pThread->start() == Yuni::Thread::errNone);
+		}
+
+
+		void UringBackend::submit(Request* head, Request* tail)
+		{
+			Yuni::MutexLocker locker(pMutex);
+			if (pPendingTail)
+				pPendingTail->next = head;
+			else
+				pPendingHead = head;
+			pPendingTail = tail;
+			flushWL();
+		}
+
+
+		void UringBackend::flushWL()
+		{
+			uint tail = pSQLocalTail;
+			uint head = __atomic_load_n(pSQHead, __ATOMIC_ACQUIRE);
+
+			if (pStopping and not pWakeupSubmitted and tail - head < pSQEntries)
+			{
+				uint index = tail & pSQMask;
+				struct io_uring_sqe& sqe = pSQEs[index];
+				::memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_NOP;
+				sqe.user_data = 0;
+				pSQArray[index] = index;
+				++tail;
+				pWakeupSubmitted = true;
+			}
+
+			while (pPendingHead and pInflight < pCapacity and tail - head < pSQEntries)
+			{
+				Request* request = pPendingHead;
+				pPendingHead = request->next;
+				request->next = nullptr;
+
+				uint index = tail & pSQMask;
+				struct io_uring_sqe& sqe = pSQEs[index];
+				::memset(&sqe, 0, sizeof(sqe));
+				sqe.fd = request->handle;
+				sqe.user_data = reinterpret_cast<uint64>(request);
+				switch (request->operation)
+				{
+					case Yuni::IO::Async::Operation::read:
+					case Yuni::IO::Async::Operation::readv:
+					case Yuni::IO::Async::Operation::write:
+					case Yuni::IO::Async::Operation::writev:
+					{
+						bool isRead = (request->operation == Yuni::IO::Async::Operation::read
+							or request->operation == Yuni::IO::Async::Operation::readv);
+						sqe.opcode = (isRead) ? IORING_OP_READV : IORING_OP_WRITEV;
+						sqe.addr = reinterpret_cast<uint64>(request->buffers);
+						sqe.len = request->count;
+						sqe.off = request->offset;
+						break;
+					}
+					case Yuni::IO::Async::Operation::fsync:
+					case Yuni::IO::Async::Operation::fdatasync:
+					{
+						sqe.opcode = IORING_OP_FSYNC;
+						if (request->operation == Yuni::IO::Async::Operation::fdatasync)
+							sqe.fsync_flags = IORING_FSYNC_DATASYNC;
+						break;
+					}
+				}
+				pSQArray[index] = index;
+				++tail;
+				++pInflight;
+			}
+			if (not pPendingHead)
+				pPendingTail = nullptr;
+
+			if (tail != pSQLocalTail)
+			{
+				pSQLocalTail = tail;
+				__atomic_store_n(pSQTail, tail, __ATOMIC_RELEASE);
+			}
+
+			// submitting all entries not consumed by the kernel yet
+			uint toSubmit = tail - head;
+			while (toSubmit != 0)
+			{
+				int submitted = SysEnter(pFd, toSubmit, 0, 0);
+				if (submitted >= 0)
+					break;
+				if (errno != EINTR)
+					break; // EAGAIN / EBUSY, the entries will be submitted with the next ones
+			}
+		}
+
+
+		bool UringBackend::reap()
+		{
+			if (SysEnter(pFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 and errno != EINTR and errno != EAGAIN and errno != EBUSY)
+				return false;
+
+			Request* completed = nullptr;
+			Request* last = nullptr;
+			uint count = 0;
+
+			uint head = *pCQHead;
+			uint tail = __atomic_load_n(pCQTail, __ATOMIC_ACQUIRE);
+			for (; head != tail; ++head)
+			{
+				const struct io_uring_cqe& cqe = pCQEs[head & pCQMask];
+				Request* request = reinterpret_cast<Request*>(cqe.user_data);
+				if (not request)
+					continue; // wake up
+				request->result = cqe.res;
+				if (last)
+					last->next = request;
+				else
+					completed = request;
+				last = request;
+				++count;
+			}
+			__atomic_store_n(pCQHead, head, __ATOMIC_RELEASE);
+
+			bool shouldContinue;
+			{
+				Yuni::MutexLocker locker(pMutex);
+				pInflight -= count;
+				flushWL();
+				shouldContinue = not (pStopping and pWakeupSubmitted and pInflight == 0 and not pPendingHead);
+			}
+
+			pDispatcher.complete(completed);
+			return shouldContinue;
+		}
+
+
+		void UringBackend::stop()
+		{
+			{
+				Yuni::MutexLocker locker(pMutex);
+				pStopping = true;
+				flushWL();
+			}
+			if (pThread)
+				pThread->wait();
+			release();
+		}
+
+
+	} // anonymous namespace
+
+
+
+
+	IBackend* IBackend::CreateUring(Dispatcher& dispatcher, uint queueDepth)
+	{
+		UringBackend* backend = new UringBackend(dispatcher);
+		if (backend->start(queueDepth))
+			return backend;
+		delete backend;
+		return nullptr;
+	}
+
+
+	# else // YUNI_ASYNCIO_HAS_URING
+
+
+	IBackend* IBackend::CreateUring(Dispatcher&, uint)
+	{
+		return nullptr;
+	}
+
+
+	# endif // YUNI_ASYNCIO_HAS_URING
+
+
+
+
+} // namespace AsyncIO
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,153 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "service.h"
+#include "../../core/smartptr/intrusive.h"
+#include "../../thread/signal.h"
+#include <atomic>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace AsyncIO
+{
+
+	//! An asynchronous operation
+	class Request final
+	{
+	public:
+		//! Default constructor
+		Request() :
+			next(nullptr),
+			buffers(inlineBuffers),
+			count(0),
+			result(0)
+		{}
+		//! Destructor
+		~Request()
+		{
+			if (buffers != inlineBuffers)
+				delete[] buffers;
+		}
+
+		//! Set the buffers of the operation (copied)
+		void assign(const Yuni::IO::Async::Buffer* list, uint size)
+		{
+			if (size > maxInlineBuffers)
+				buffers = new Yuni::IO::Async::Buffer[size];
+			for (uint i = 0; i != size; ++i)
+				buffers[i] = list[i];
+			count = size;
+		}
+
+	public:
+		enum
+		{
+			//! Number of buffers stored within the request
+			maxInlineBuffers = 4,
+		};
+
+		//! The next request (intrusive list)
+		Request* next;
+		//! The operation
+		Yuni::IO::Async::Operation operation;
+		//! The native handle
+		Yuni::IO::Async::Handle handle;
+		//! Offset within the file
+		uint64 offset;
+		//! The buffers (`inlineBuffers` or allocated)
+		Yuni::IO::Async::Buffer* buffers;
+		//! The number of buffers
+		uint count;
+		//! The result (number of bytes, or the negated error code)
+		sint64 result;
+		//! The callback
+		Yuni::IO::Async::Callback callback;
+		//! Inline storage for the buffers
+		Yuni::IO::Async::Buffer inlineBuffers[maxInlineBuffers];
+
+	}; // class Request
+
+
+
+
+	/*!
+	** \brief Delivery of the completions (callbacks)
+	**
+	** \internal Shared between the service, its backend and the jobs executing the callbacks
+	*/
+	class Dispatcher final : public IIntrusiveSmartPtr<Dispatcher, false>
+	{
+	public:
+		//! Ancestor
+		typedef IIntrusiveSmartPtr<Dispatcher, false>  Ancestor;
+		//! The most suitable smart pointer for the class
+		typedef Ancestor::SmartPtrType<Dispatcher>::PtrThreadSafe Ptr;
+
+	public:
+		//! Constructor
+		explicit Dispatcher(Yuni::Job::QueueService* queueservice);
+
+		//! Some operations are about to be submitted
+		void submitted(uint count);
+		//! Deliver the completions of a list of requests (the requests are destroyed)
+		void complete(Request* list);
+		//! Wait for all completions
+		void wait();
+
+	public:
+		//! The queueservice for the callbacks (if any)
+		Yuni::Job::QueueService* const queueservice;
+		//! Number of operations not completed yet (callbacks included)
+		std::atomic<uint> pending;
+
+	private:
+		//! Execute the callback of a request and destroy it
+		void execute(Request* request);
+
+	private:
+		//! Notified when there is no pending operation
+		Yuni::Thread::Signal pIdle;
+
+	}; // class Dispatcher
+
+
+
+
+	//! Implementation of the asynchronous operations
+	class IBackend
+	{
+	public:
+		//! Create an io_uring backend (null if not available)
+		static IBackend* CreateUring(Dispatcher& dispatcher, uint queueDepth);
+		//! Create a backend with threads (null if failed)
+		static IBackend* CreateThreads(Dispatcher& dispatcher, uint threadCount);
+
+	public:
+		//! Destructor
+		virtual ~IBackend() {}
+
+		//! Submit a list of requests
+		virtual void submit(Request* head, Request* tail) = 0;
+		//! Wait for the completion of all requests, then stop
+		virtual void stop() = 0;
+
+	}; // class IBackend
+
+
+
+
+} // namespace AsyncIO
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,488 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "backend.h"
+#include "../../thread/utility.h"
+#include "../../job/queue/service.h"
+#include <cassert>
+#ifdef YUNI_OS_WINDOWS
+#	include "../../core/system/windows.hdr.h"
+#	include <io.h>
+#	include <stdio.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace AsyncIO
+{
+
+	namespace // anonymous
+	{
+
+		Request* CreateRequest(Yuni::IO::Async::Operation operation, Yuni::IO::Async::Handle handle,
+			uint64 offset, const Yuni::IO::Async::Callback& callback)
+		{
+			Request* request = new Request();
+			request->operation = operation;
+			request->handle = handle;
+			request->offset = offset;
+			request->callback = callback;
+			return request;
+		}
+
+
+		Request* CreateRequest(Yuni::IO::Async::Operation operation, Yuni::IO::Async::Handle handle,
+			const void* buffer, uint size, uint64 offset, const Yuni::IO::Async::Callback& callback)
+		{
+			Request* request = CreateRequest(operation, handle, offset, callback);
+			Yuni::IO::Async::Buffer single;
+			single.data = const_cast<void*>(buffer);
+			single.size = size;
+			request->assign(&single, 1);
+			return request;
+		}
+
+
+		Request* CreateRequest(Yuni::IO::Async::Operation operation, Yuni::IO::Async::Handle handle,
+			const Yuni::IO::Async::Buffer* buffers, uint count, uint64 offset, const Yuni::IO::Async::Callback& callback)
+		{
+			Request* request = CreateRequest(operation, handle, offset, callback);
+			request->assign(buffers, count);
+			return request;
+		}
+
+
+		void DeleteRequests(Request* list)
+		{
+			while (list)
+			{
+				Request* next = list->next;
+				delete list;
+				list = next;
+			}
+		}
+
+	} // anonymous namespace
+
+
+
+
+	Dispatcher::Dispatcher(Yuni::Job::QueueService* queueservice) :
+		queueservice(queueservice),
+		pending(0)
+	{
+		pIdle.notify();
+	}
+
+
+	void Dispatcher::submitted(uint count)
+	{
+		pending.fetch_add(count);
+	}
+
+
+	void Dispatcher::wait()
+	{
+		for (;;)
+		{
+			pIdle.reset();
+			// checking again, a completion may have occurred meanwhile
+			if (pending.load() == 0)
+			{
+				pIdle.notify(); // waking up the other waiting threads, if any
+				return;
+			}
+			pIdle.wait();
+		}
+	}
+
+
+	void Dispatcher::complete(Request* list)
+	{
+		while (list)
+		{
+			Request* request = list;
+			list = list->next;
+
+			if (queueservice)
+			{
+				// keeping a reference, since the service may be destroyed meanwhile
+				Ptr self = this;
+				async(*queueservice, [self, request]() { self->execute(request); });
+			}
+			else
+				execute(request);
+		}
+	}
+
+
+	void Dispatcher::execute(Request* request)
+	{
+		if (not request->callback.empty())
+		{
+			Yuni::IO::Async::Completion completion;
+			completion.operation = request->operation;
+			completion.handle = request->handle;
+			completion.offset = request->offset;
+			if (request->result >= 0)
+			{
+				completion.bytes = static_cast<uint64>(request->result);
+				completion.error = 0;
+			}
+			else
+			{
+				completion.bytes = 0;
+				completion.error = static_cast<int>(-request->result);
+			}
+
+			try
+			{
+				request->callback(completion);
+			}
+			catch (...) {}
+		}
+		delete request;
+
+		if (1 == pending.fetch_sub(1))
+			pIdle.notify();
+	}
+
+
+
+
+} // namespace AsyncIO
+} // namespace Private
+} // namespace Yuni
+
+
+
+
+namespace Yuni
+{
+namespace IO
+{
+namespace Async
+{
+
+	Handle NativeHandle(const IO::File::Stream& stream)
+	{
+		FILE* file = stream.nativeHandle();
+		# ifdef YUNI_OS_WINDOWS
+		return (file) ? reinterpret_cast<Handle>(::_get_osfhandle(::_fileno(file))) : INVALID_HANDLE_VALUE;
+		# else
+		return (file) ? ::fileno(file) : -1;
+		# endif
+	}
+
+
+
+
+	Batch::Batch() :
+		pHead(nullptr),
+		pTail(nullptr),
+		pCount(0)
+	{}
+
+
+	Batch::~Batch()
+	{
+		Private::AsyncIO::DeleteRequests(pHead);
+	}
+
+
+	void Batch::clear()
+	{
+		Private::AsyncIO::DeleteRequests(pHead);
+		pHead = nullptr;
+		pTail = nullptr;
+		pCount = 0;
+	}
+
+
+	uint Batch::size() const
+	{
+		return pCount;
+	}
+
+
+	bool Batch::empty() const
+	{
+		return 0 == pCount;
+	}
+
+
+	void Batch::append(Private::AsyncIO::Request* request)
+	{
+		if (pTail)
+			pTail->next = request;
+		else
+			pHead = request;
+		pTail = request;
+		++pCount;
+	}
+
+
+	void Batch::read(Handle handle, void* buffer, uint size, uint64 offset, const Callback& callback)
+	{
+		append(Private::AsyncIO::CreateRequest(Operation::read, handle, buffer, size, offset, callback));
+	}
+
+
+	void Batch::write(Handle handle, const void* buffer, uint size, uint64 offset, const Callback& callback)
+	{
+		append(Private::AsyncIO::CreateRequest(Operation::write, handle, buffer, size, offset, callback));
+	}
+
+
+	void Batch::readv(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback)
+	{
+		append(Private::AsyncIO::CreateRequest(Operation::readv, handle, buffers, count, offset, callback));
+	}
+
+
+	void Batch::writev(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback)
+	{
+		append(Private::AsyncIO::CreateRequest(Operation::writev, handle, buffers, count, offset, callback));
+	}
+
+
+	void Batch::fsync(Handle handle, const Callback& callback, bool dataOnly)
+	{
+		Operation operation = (dataOnly) ? Operation::fdatasync : Operation::fsync;
+		append(Private::AsyncIO::CreateRequest(operation, handle, 0, callback));
+	}
+
+
+
+
+	Service::Service() :
+		pDispatcher(new Private::AsyncIO::Dispatcher(nullptr)),
+		pBackend(nullptr),
+		pBackendType(Backend::none),
+		pQueueDepth(256),
+		pThreadCount(4)
+	{
+		pDispatcher->addRef();
+	}
+
+
+	Service::Service(Job::QueueService& queueservice) :
+		pDispatcher(new Private::AsyncIO::Dispatcher(&queueservice)),
+		pBackend(nullptr),
+		pBackendType(Backend::none),
+		pQueueDepth(256),
+		pThreadCount(4)
+	{
+		pDispatcher->addRef();
+	}
+
+
+	Service::~Service()
+	{
+		stop();
+		if (pDispatcher->release())
+			delete pDispatcher;
+	}
+
+
+	bool Service::start(Backend backend)
+	{
+		MutexLocker locker(pMutex);
+		if (pBackend)
+			return (backend == Backend::automatic or backend == pBackendType);
+
+		if (backend == Backend::automatic or backend == Backend::uring)
+		{
+			pBackend = Private::AsyncIO::IBackend::CreateUring(*pDispatcher, pQueueDepth);
+			if (pBackend)
+			{
+				pBackendType = Backend::uring;
+				return true;
+			}
+			if (backend == Backend::uring)
+				return false;
+		}
+		if (backend == Backend::automatic or backend == Backend::threads)
+		{
+			pBackend = Private::AsyncIO::IBackend::CreateThreads(*pDispatcher, pThreadCount);
+			if (pBackend)
+			{
+				pBackendType = Backend::threads;
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	void Service::stop()
+	{
+		Private::AsyncIO::IBackend* backend;
+		{
+			MutexLocker locker(pMutex);
+			backend = pBackend;
+			pBackend = nullptr;
+			pBackendType = Backend::none;
+		}
+		if (backend)
+		{
+			backend->stop();
+			delete backend;
+		}
+	}
+
+
+	bool Service::started() const
+	{
+		MutexLocker locker(pMutex);
+		return pBackend != nullptr;
+	}
+
+
+	Backend Service::backend() const
+	{
+		MutexLocker locker(pMutex);
+		return pBackendType;
+	}
+
+
+	void Service::wait()
+	{
+		pDispatcher->wait();
+	}
+
+
+	uint Service::pending() const
+	{
+		return pDispatcher->pending.load();
+	}
+
+
+	void Service::queueDepth(uint count)
+	{
+		MutexLocker locker(pMutex);
+		pQueueDepth = (count < 2) ? 2 : count;
+	}
+
+
+	uint Service::queueDepth() const
+	{
+		MutexLocker locker(pMutex);
+		return pQueueDepth;
+	}
+
+
+	void Service::threadCount(uint count)
+	{
+		MutexLocker locker(pMutex);
+		pThreadCount = (count != 0) ? count : 1;
+	}
+
+
+	uint Service::threadCount() const
+	{
+		MutexLocker locker(pMutex);
+		return pThreadCount;
+	}
+
+
+	bool Service::submit(Private::AsyncIO::Request* head, uint count)
+	{
+		MutexLocker locker(pMutex);
+		if (YUNI_UNLIKELY(not pBackend))
+			return false;
+
+		Private::AsyncIO::Request* tail = head;
+		while (tail->next)
+			tail = tail->next;
+		pDispatcher->submitted(count);
+		pBackend->submit(head, tail);
+		return true;
+	}
+
+
+	bool Service::submit(Batch& batch)
+	{
+		if (batch.empty())
+			return true;
+		if (not submit(batch.pHead, batch.pCount))
+			return false;
+		batch.pHead = nullptr;
+		batch.pTail = nullptr;
+		batch.pCount = 0;
+		return true;
+	}
+
+
+	bool Service::read(Handle handle, void* buffer, uint size, uint64 offset, const Callback& callback)
+	{
+		Private::AsyncIO::Request* request =
+			Private::AsyncIO::CreateRequest(Operation::read, handle, buffer, size, offset, callback);
+		if (submit(request, 1))
+			return true;
+		delete request;
+		return false;
+	}
+
+
+	bool Service::write(Handle handle, const void* buffer, uint size, uint64 offset, const Callback& callback)
+	{
+		Private::AsyncIO::Request* request =
+			Private::AsyncIO::CreateRequest(Operation::write, handle, buffer, size, offset, callback);
+		if (submit(request, 1))
+			return true;
+		delete request;
+		return false;
+	}
+
+
+	bool Service::readv(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback)
+	{
+		Private::AsyncIO::Request* request =
+			Private::AsyncIO::CreateRequest(Operation::readv, handle, buffers, count, offset, callback);
+		if (submit(request, 1))
+			return true;
+		delete request;
+		return false;
+	}
+
+
+	bool Service::writev(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback)
+	{
+		Private::AsyncIO::Request* request =
+			Private::AsyncIO::CreateRequest(Operation::writev, handle, buffers, count, offset, callback);
+		if (submit(request, 1))
+			return true;
+		delete request;
+		return false;
+	}
+
+
+	bool Service::fsync(Handle handle, const Callback& callback, bool dataOnly)
+	{
+		Operation operation = (dataOnly) ? Operation::fdatasync : Operation::fsync;
+		Private::AsyncIO::Request* request =
+			Private::AsyncIO::CreateRequest(operation, handle, 0, callback);
+		if (submit(request, 1))
+			return true;
+		delete request;
+		return false;
+	}
+
+
+
+
+} // namespace Async
+} // namespace IO
+} // namespace Yuni
@@ -0,0 +1,308 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../../core/bind.h"
+#include "../../core/noncopyable.h"
+#include "../../thread/mutex.h"
+#include "../file/stream.h"
+#include <stddef.h>
+
+namespace Yuni { namespace Job { class QueueService; }}
+namespace Yuni { namespace Private { namespace AsyncIO { class Request; class Dispatcher; class IBackend; }}}
+
+
+
+namespace Yuni
+{
+namespace IO
+{
+namespace Async
+{
+
+	# ifdef YUNI_OS_WINDOWS
+	//! Native handle of a file (HANDLE)
+	typedef void* Handle;
+	# else
+	//! Native handle of a file (file descriptor)
+	typedef int Handle;
+	# endif
+
+
+	//! Get the native handle of an opened stream
+	YUNI_DECL Handle NativeHandle(const IO::File::Stream& stream);
+
+
+	//! Asynchronous operations
+	enum class Operation
+	{
+		read,
+		write,
+		readv,
+		writev,
+		fsync,
+		fdatasync,
+	};
+
+
+	//! Implementations of the asynchronous operations
+	enum class Backend
+	{
+		//! The service is not started
+		none,
+		//! io_uring if available, threads otherwise
+		automatic,
+		//! io_uring (Linux only)
+		uring,
+		//! Blocking operations, performed by a few threads
+		threads,
+	};
+
+
+	//! A buffer for the vectored operations (readv / writev)
+	struct Buffer final
+	{
+		//! The data
+		void* data;
+		//! Size of the data in bytes
+		size_t size;
+	};
+
+
+	//! The result of an asynchronous operation
+	struct Completion final
+	{
+		//! Get if the operation has succeeded
+		bool succeeded() const { return error == 0; }
+
+		//! The operation
+		Operation operation;
+		//! The native handle
+		Handle handle;
+		//! The offset within the file
+		uint64 offset;
+		//! The number of bytes transferred (less than requested at the end of the file)
+		uint64 bytes;
+		//! Error code (errno / GetLastError(), 0 if none)
+		int error;
+	};
+
+
+	//! Callback for completions
+	typedef Bind<void (const Completion&)> Callback;
+
+
+
+
+	/*!
+	** \brief A list of asynchronous operations, to submit at once
+	**
+	** The operations are started in the same order, but may complete in any order.
+	** \code
+	** IO::Async::Batch batch;
+	** for (uint i = 0; i != 64; ++i)
+	**	batch.read(fd, buffers[i], 4096, i * 4096, onRead);
+	** service.submit(batch); // the batch is now empty
+	** \endcode
+	**
+	** \note A batch is not thread-safe
+	*/
+	class YUNI_DECL Batch final : private NonCopyable<Batch>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		Batch();
+		//! Destructor (the operations not submitted are discarded)
+		~Batch();
+		//@}
+
+
+		//! \name Operations
+		//@{
+		//! Read `size` bytes at `offset` into `buffer`
+		void read(Handle handle, void* buffer, uint size, uint64 offset, const Callback& callback);
+		//! Write `size` bytes from `buffer` at `offset`
+		void write(Handle handle, const void* buffer, uint size, uint64 offset, const Callback& callback);
+		//! Read at `offset` into several buffers (the array of buffers is copied)
+		void readv(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback);
+		//! Write several buffers at `offset` (the array of buffers is copied)
+		void writev(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback);
+		//! Flush the data and the metadata of a file to disk (only the data if `dataOnly`)
+		void fsync(Handle handle, const Callback& callback, bool dataOnly = false);
+		//@}
+
+
+		//! \name Informations
+		//@{
+		//! Get the number of operations
+		uint size() const;
+		//! Get if the batch is empty
+		bool empty() const;
+		//! Discard all operations
+		void clear();
+		//@}
+
+
+	private:
+		//! Append a new operation
+		void append(Private::AsyncIO::Request* request);
+
+	private:
+		//! The first operation
+		Private::AsyncIO::Request* pHead;
+		//! The last operation
+		Private::AsyncIO::Request* pTail;
+		//! The number of operations
+		uint pCount;
+		// friend
+		friend class Service;
+
+	}; // class Batch
+
+
+
+
+	/*!
+	** \brief Service for asynchronous file operations (read, write, fsync...)
+	**
+	** On Linux, the operations are submitted to the kernel via io_uring: hundreds
+	** of operations may be in flight, with a single thread for the completions. When
+	** io_uring is not available, the operations are performed by a few threads
+	** (blocking calls).
+	**
+	** The callbacks are either executed by the thread(s) of the service, or
+	** dispatched as jobs to a queueservice when provided.
+	**
+	** \code
+	** IO::Async::Service service(queueservice);
+	** service.start();
+	**
+	** IO::File::Stream file("data.bin");
+	** char buffer[4096];
+	** service.read(IO::Async::NativeHandle(file), buffer, sizeof(buffer), 0,
+	**	[&](const IO::Async::Completion& completion) {
+	**		if (completion.succeeded())
+	**			std::cout << completion.bytes << " bytes read" << std::endl;
+	**	});
+	** service.wait(); // all callbacks have been executed
+	** \endcode
+	**
+	** The buffers and the files must remain valid until the completion. The
+	** operations rely on offsets and never alter the current position of the file
+	** (the buffers of an `IO::File::Stream` are not used either).
+	*/
+	class YUNI_DECL Service final : private NonCopyable<Service>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor, the callbacks being executed by the thread(s) of the service
+		Service();
+		//! Constructor, the callbacks being executed by a queueservice
+		explicit Service(Job::QueueService& queueservice);
+		//! Destructor (will stop the service)
+		~Service();
+		//@}
+
+
+		//! \name Service
+		//@{
+		/*!
+		** \brief Start the service
+		**
+		** \param backend The implementation to use (`automatic`, `uring` or `threads`)
+		** \return True if the service is running (with the given backend)
+		*/
+		bool start(Backend backend = Backend::automatic);
+		/*!
+		** \brief Stop the service
+		**
+		** All operations already submitted are completed first (the callbacks
+		** dispatched to a queueservice may be executed afterwards).
+		*/
+		void stop();
+		//! Get if the service is running
+		bool started() const;
+		//! Get the backend in use (`none` if not started)
+		Backend backend() const;
+
+		//! Wait for the completion of all operations (callbacks included)
+		void wait();
+		//! Get the number of operations not completed yet (callbacks included)
+		uint pending() const;
+		//@}
+
+
+		//! \name Settings (before starting the service)
+		//@{
+		//! Set the maximum number of operations in flight for io_uring (default: 256)
+		void queueDepth(uint count);
+		//! Get the maximum number of operations in flight for io_uring
+		uint queueDepth() const;
+		//! Set the number of threads when io_uring is not available (default: 4)
+		void threadCount(uint count);
+		//! Get the number of threads when io_uring is not available
+		uint threadCount() const;
+		//@}
+
+
+		//! \name Operations
+		//@{
+		//! Read `size` bytes at `offset` into `buffer`
+		bool read(Handle handle, void* buffer, uint size, uint64 offset, const Callback& callback);
+		//! Write `size` bytes from `buffer` at `offset`
+		bool write(Handle handle, const void* buffer, uint size, uint64 offset, const Callback& callback);
+		//! Read at `offset` into several buffers (the array of buffers is copied)
+		bool readv(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback);
+		//! Write several buffers at `offset` (the array of buffers is copied)
+		bool writev(Handle handle, const Buffer* buffers, uint count, uint64 offset, const Callback& callback);
+		//! Flush the data and the metadata of a file to disk (only the data if `dataOnly`)
+		bool fsync(Handle handle, const Callback& callback, bool dataOnly = false);
+
+		/*!
+		** \brief Submit all operations of a batch at once
+		**
+		** \return False if the service is not running (the batch is left untouched)
+		*/
+		bool submit(Batch& batch);
+		//@}
+
+
+	private:
+		//! Submit a list of operations
+		bool submit(Private::AsyncIO::Request* head, uint count);
+
+	private:
+		//! Mutex for the backend
+		mutable Mutex pMutex;
+		//! Delivery of the completions (always valid, with its own reference)
+		Private::AsyncIO::Dispatcher* pDispatcher;
+		//! The backend, if started
+		Private::AsyncIO::IBackend* pBackend;
+		//! The backend in use
+		Backend pBackendType;
+		//! Maximum number of operations in flight for io_uring
+		uint pQueueDepth;
+		//! Number of threads for the fallback
+		uint pThreadCount;
+
+	}; // class Service
+
+
+
+
+
+
+} // namespace Async
+} // namespace IO
+} // namespace Yuni
@@ -13,6 +13,7 @@
 #include "../directory.h"
 #include <cctype>
 #include <cstring>
+#include <cstdio>
 #include "../../core/string/wstring.h"
 
 #ifndef YUNI_OS_WINDOWS
@@ -153,6 +154,36 @@ namespace File
 	}
 
 
+	Yuni::IO::Error Rename(const AnyString& from, const AnyString& to)
+	{
+		if (from.empty() or to.empty())
+			return Yuni::IO::errUnknown;
+
+		# ifndef YUNI_OS_WINDOWS
+
+		return (::rename(String(from).c_str(), String(to).c_str()))
+			? Yuni::IO::errUnknown
+			: Yuni::IO::errNone;
+
+		# else
+
+		String norm;
+		Yuni::IO::Normalize(norm, from);
+		WString wfrom(norm, true);
+		Yuni::IO::Normalize(norm, to);
+		WString wto(norm, true);
+		if (wfrom.empty() or wto.empty())
+			return Yuni::IO::errUnknown;
+		wfrom.replace('/', '\\');
+		wto.replace('/', '\\');
+
+		return (MoveFileExW(wfrom.c_str(), wto.c_str(), MOVEFILE_REPLACE_EXISTING))
+			? Yuni::IO::errNone
+			: Yuni::IO::errUnknown;
+		# endif
+	}
+
+
 
 
 	# ifdef YUNI_OS_WINDOWS
@@ -155,6 +155,15 @@ namespace File
 	IO::Error Delete(const AnyString& filename);
 
 
+	/*!
+	** \brief Rename (or move) a file, replacing the target file if it already exists
+	**
+	** \param from The source file
+	** \param to The new filename (on the same volume)
+	*/
+	IO::Error Rename(const AnyString& from, const AnyString& to);
+
+
 	/*!
 	** \brief Create or erase a file
 	**
@@ -210,5 +219,6 @@ namespace File
 } // namespace Yuni
 
 #include "stream.h"
+#include "mappedview.h"
 #include "file.hxx"
 
@@ -0,0 +1,280 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "mappedview.h"
+#include "../filename-manipulation.h"
+#include "../../core/string/wstring.h"
+#ifdef YUNI_OS_WINDOWS
+#	include "../../core/system/windows.hdr.h"
+#else
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace IO
+{
+namespace File
+{
+
+	namespace // anonymous
+	{
+
+		//! Alignment of the offset of a mapping
+		uint64 MappingGranularity()
+		{
+			# ifdef YUNI_OS_WINDOWS
+			SYSTEM_INFO info;
+			::GetSystemInfo(&info);
+			return static_cast<uint64>(info.dwAllocationGranularity);
+			# else
+			long pagesize = ::sysconf(_SC_PAGESIZE);
+			return (pagesize > 0) ? static_cast<uint64>(pagesize) : 4096u;
+			# endif
+		}
+
+	} // anonymous namespace
+
+
+
+
+	MappedView::MappedView() :
+		# ifdef YUNI_OS_WINDOWS
+		pHandle(INVALID_HANDLE_VALUE),
+		pMapping(nullptr),
+		# else
+		pFd(-1),
+		# endif
+		pBase(nullptr),
+		pBaseSize(0),
+		pData(nullptr),
+		pSize(0),
+		pOffset(0),
+		pFileSize(0),
+		pWritable(false)
+	{}
+
+
+	Yuni::IO::Error MappedView::open(const AnyString& filename, int mode, bool mapAll)
+	{
+		close();
+		if (filename.empty())
+			return Yuni::IO::errBadFilename;
+		pWritable = (0 != (mode & OpenMode::write));
+
+		# ifdef YUNI_OS_WINDOWS
+		{
+			String norm;
+			Yuni::IO::Normalize(norm, filename);
+			WString wfilename(norm, true);
+			if (wfilename.empty())
+				return Yuni::IO::errBadFilename;
+			wfilename.replace('/', '\\');
+
+			DWORD access = (pWritable) ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+			pHandle = ::CreateFileW(wfilename.c_str(), access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (pHandle == INVALID_HANDLE_VALUE)
+				return Yuni::IO::errNotFound;
+
+			LARGE_INTEGER size;
+			if (not ::GetFileSizeEx(pHandle, &size))
+			{
+				close();
+				return Yuni::IO::errReadFailed;
+			}
+			pFileSize = static_cast<uint64>(size.QuadPart);
+			if (pFileSize != 0)
+			{
+				// an empty file can not be mapped
+				pMapping = ::CreateFileMappingW(pHandle, nullptr, (pWritable) ? PAGE_READWRITE : PAGE_READONLY,
+					0, 0, nullptr);
+				if (not pMapping)
+				{
+					close();
+					return Yuni::IO::errReadFailed;
+				}
+			}
+		}
+		# else
+		{
+			pFd = ::open(String(filename).c_str(), (pWritable) ? O_RDWR : O_RDONLY);
+			if (pFd < 0)
+				return Yuni::IO::errNotFound;
+
+			struct stat st;
+			if (0 != ::fstat(pFd, &st) or not S_ISREG(st.st_mode))
+			{
+				close();
+				return Yuni::IO::errReadFailed;
+			}
+			pFileSize = static_cast<uint64>(st.st_size);
+		}
+		# endif
+
+		if (mapAll and not map(0))
+		{
+			close();
+			return Yuni::IO::errMemoryLimit;
+		}
+		return Yuni::IO::errNone;
+	}
+
+
+	void MappedView::close()
+	{
+		unmap();
+		# ifdef YUNI_OS_WINDOWS
+		if (pMapping)
+		{
+			::CloseHandle(pMapping);
+			pMapping = nullptr;
+		}
+		if (pHandle != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(pHandle);
+			pHandle = INVALID_HANDLE_VALUE;
+		}
+		# else
+		if (pFd >= 0)
+		{
+			::close(pFd);
+			pFd = -1;
+		}
+		# endif
+		pFileSize = 0;
+		pWritable = false;
+	}
+
+
+	bool MappedView::opened() const
+	{
+		# ifdef YUNI_OS_WINDOWS
+		return pHandle != INVALID_HANDLE_VALUE;
+		# else
+		return pFd >= 0;
+		# endif
+	}
+
+
+	bool MappedView::map(uint64 offset, uint64 size)
+	{
+		unmap();
+		if (not opened() or offset > pFileSize)
+			return false;
+
+		if (size == 0 or size > pFileSize - offset)
+			size = pFileSize - offset;
+		pOffset = offset;
+		if (size == 0)
+			return true; // nothing to map
+
+		if (sizeof(size_t) < 8 and size > static_cast<uint64>(static_cast<size_t>(-1) / 2))
+			return false; // not enough address space
+
+		// the offset of a mapping must be aligned
+		static const uint64 granularity = MappingGranularity();
+		const uint64 base = offset - (offset % granularity);
+		const uint64 baseSize = size + (offset - base);
+
+		# ifdef YUNI_OS_WINDOWS
+		void* address = ::MapViewOfFile(pMapping, (pWritable) ? (FILE_MAP_READ | FILE_MAP_WRITE) : FILE_MAP_READ,
+			static_cast<DWORD>(base >> 32), static_cast<DWORD>(base & 0xFFFFFFFFu), static_cast<SIZE_T>(baseSize));
+		if (not address)
+			return false;
+		# else
+		void* address = ::mmap(nullptr, static_cast<size_t>(baseSize), (pWritable) ? (PROT_READ | PROT_WRITE) : PROT_READ,
+			MAP_SHARED, pFd, static_cast<off_t>(base));
+		if (address == MAP_FAILED)
+			return false;
+		# endif
+
+		pBase = static_cast<char*>(address);
+		pBaseSize = baseSize;
+		pData = pBase + (offset - base);
+		pSize = size;
+		return true;
+	}
+
+
+	void MappedView::unmap()
+	{
+		if (pBase)
+		{
+			# ifdef YUNI_OS_WINDOWS
+			::UnmapViewOfFile(pBase);
+			# else
+			::munmap(pBase, static_cast<size_t>(pBaseSize));
+			# endif
+			pBase = nullptr;
+			pBaseSize = 0;
+		}
+		pData = nullptr;
+		pSize = 0;
+		pOffset = 0;
+	}
+
+
+	bool MappedView::advise(Advice advice)
+	{
+		if (not pBase)
+			return false;
+
+		# ifdef YUNI_OS_WINDOWS
+		if (advice == Advice::willneed)
+		{
+			// PrefetchVirtualMemory is not available on all versions, touching the pages instead
+			volatile char sink = 0;
+			for (uint64 i = 0; i < pBaseSize; i += 4096)
+				sink ^= pBase[i];
+			(void) sink;
+		}
+		return true; // no equivalent for the other hints
+		# else
+		int flag;
+		switch (advice)
+		{
+			case Advice::sequential: flag = MADV_SEQUENTIAL; break;
+			case Advice::random:     flag = MADV_RANDOM; break;
+			case Advice::willneed:   flag = MADV_WILLNEED; break;
+			default:                 flag = MADV_NORMAL; break;
+		}
+		return 0 == ::madvise(pBase, static_cast<size_t>(pBaseSize), flag);
+		# endif
+	}
+
+
+	bool MappedView::sync(bool wait)
+	{
+		if (not pBase or not pWritable)
+			return false;
+
+		# ifdef YUNI_OS_WINDOWS
+		if (not ::FlushViewOfFile(pBase, static_cast<SIZE_T>(pBaseSize)))
+			return false;
+		return (not wait) or (0 != ::FlushFileBuffers(pHandle));
+		# else
+		return 0 == ::msync(pBase, static_cast<size_t>(pBaseSize), (wait) ? MS_SYNC : MS_ASYNC);
+		# endif
+	}
+
+
+
+
+
+} // namespace File
+} // namespace IO
+} // namespace Yuni
@@ -0,0 +1,197 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../../core/string.h"
+#include "../../core/noncopyable.h"
+#include "../error.h"
+#include "openmode.h"
+
+
+
+namespace Yuni
+{
+namespace IO
+{
+namespace File
+{
+
+	//! Hint about the way a mapped file will be accessed
+	enum class Advice
+	{
+		//! No particular hint
+		normal,
+		//! Sequential access (aggressive read-ahead, the pages can be freed soon after being read)
+		sequential,
+		//! Random access (no read-ahead)
+		random,
+		//! The data will be needed soon (prefetch)
+		willneed,
+	};
+
+
+
+
+	/*!
+	** \brief Memory-mapped view of a file
+	**
+	** The content of the file is directly accessible from the page cache,
+	** without any copy:
+	** \code
+	** IO::File::MappedView view;
+	** if (IO::errNone == view.open("/path/to/data.csv"))
+	** {
+	**	view.advise(IO::File::Advice::sequential);
+	**	AnyString content = view.content();
+	**	...
+	** }
+	** \endcode
+	**
+	** Huge files can be mapped by windows:
+	** \code
+	** IO::File::MappedView view;
+	** if (IO::errNone == view.open(filename, IO::OpenMode::read, false))
+	** {
+	**	const uint64 window = 256 * 1024 * 1024;
+	**	for (uint64 offset = 0; offset < view.fileSize(); offset += window)
+	**	{
+	**		if (not view.map(offset, window))
+	**			break;
+	**		consume(view.data(), view.size());
+	**	}
+	** }
+	** \endcode
+	**
+	** In write mode (`OpenMode::read | OpenMode::write`), the modifications are
+	** shared with the file. The size of the file can not be changed.
+	*/
+	class YUNI_DECL MappedView final : private NonCopyable<MappedView>
+	{
+	public:
+		//! \name Constructors & Destructor
+		//@{
+		//! Default constructor
+		MappedView();
+		//! Open and map a whole file
+		explicit MappedView(const AnyString& filename, int mode = OpenMode::read);
+		//! Destructor
+		~MappedView();
+		//@}
+
+
+		//! \name File
+		//@{
+		/*!
+		** \brief Open a file, and map all of it
+		**
+		** \param filename The filename
+		** \param mode OpenMode::read or OpenMode::read | OpenMode::write (no creation, no truncation)
+		** \param mapAll False to only open the file (see `map()`)
+		** \return errNone if successful
+		*/
+		Yuni::IO::Error open(const AnyString& filename, int mode = OpenMode::read, bool mapAll = true);
+
+		//! Unmap and close the file
+		void close();
+
+		//! Get if a file is opened
+		bool opened() const;
+
+		//! Get the size of the file (when opened)
+		uint64 fileSize() const;
+		//@}
+
+
+		//! \name Mapping
+		//@{
+		/*!
+		** \brief Map a part of the file (the previous one is unmapped)
+		**
+		** \param offset Offset in the file (no alignment required)
+		** \param size Size in bytes (truncated to the end of the file, 0 for the remaining of the file)
+		** \return True if the operation succeeded
+		*/
+		bool map(uint64 offset, uint64 size = 0);
+
+		//! Unmap the current part of the file
+		void unmap();
+
+		//! Give a hint about the way the mapped part will be accessed
+		bool advise(Advice advice);
+
+		/*!
+		** \brief Write the modifications back to the file (write mode)
+		**
+		** \param wait True to wait for the data to be written
+		*/
+		bool sync(bool wait = true);
+		//@}
+
+
+		//! \name Content
+		//@{
+		//! The mapped data (null if nothing is mapped)
+		const char* data() const;
+		//! The mapped data (must not be modified unless opened in write mode)
+		char* data();
+		//! Size of the mapped data
+		uint64 size() const;
+		//! Offset of the mapped data in the file
+		uint64 offset() const;
+		//! Get if the mapped data is empty
+		bool empty() const;
+
+		/*!
+		** \brief The mapped data as a string (zero-copy, not zero-terminated)
+		**
+		** The mapped part must be smaller than 4GiB (see `map()`).
+		*/
+		AnyString content() const;
+		//@}
+
+
+	private:
+		# ifdef YUNI_OS_WINDOWS
+		//! Handle of the file
+		void* pHandle;
+		//! Handle of the file mapping
+		void* pMapping;
+		# else
+		//! File descriptor
+		int pFd;
+		# endif
+		//! Address of the mapping (aligned)
+		char* pBase;
+		//! Size of the mapping
+		uint64 pBaseSize;
+		//! The mapped data
+		char* pData;
+		//! Size of the mapped data
+		uint64 pSize;
+		//! Offset of the mapped data
+		uint64 pOffset;
+		//! Size of the file
+		uint64 pFileSize;
+		//! True if opened for writing
+		bool pWritable;
+
+	}; // class MappedView
+
+
+
+
+
+
+} // namespace File
+} // namespace IO
+} // namespace Yuni
+
+#include "mappedview.hxx"
@@ -0,0 +1,85 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "mappedview.h"
+#include <cassert>
+
+
+
+namespace Yuni
+{
+namespace IO
+{
+namespace File
+{
+
+	inline MappedView::MappedView(const AnyString& filename, int mode) :
+		MappedView()
+	{
+		open(filename, mode);
+	}
+
+
+	inline MappedView::~MappedView()
+	{
+		close();
+	}
+
+
+	inline uint64 MappedView::fileSize() const
+	{
+		return pFileSize;
+	}
+
+
+	inline const char* MappedView::data() const
+	{
+		return pData;
+	}
+
+
+	inline char* MappedView::data()
+	{
+		return pData;
+	}
+
+
+	inline uint64 MappedView::size() const
+	{
+		return pSize;
+	}
+
+
+	inline uint64 MappedView::offset() const
+	{
+		return pOffset;
+	}
+
+
+	inline bool MappedView::empty() const
+	{
+		return 0 == pSize;
+	}
+
+
+	inline AnyString MappedView::content() const
+	{
+		assert(pSize <= static_cast<uint64>(static_cast<AnyString::Size>(-1)) and "the mapped data is too large");
+		return AnyString(pData, static_cast<AnyString::Size>(pSize));
+	}
+
+
+
+
+
+} // namespace File
+} // namespace IO
+} // namespace Yuni
@@ -408,6 +408,8 @@ namespace File
 		//@{
 		//! Get the OS Dependant handle
 		HandleType nativeHandle() const;
+		//! Exchange the underlying files of two streams
+		void swap(Stream& other);
 		//@}
 
 
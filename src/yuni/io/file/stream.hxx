@@ -383,6 +383,14 @@ namespace File
 	}
 
 
+	inline void Stream::swap(Stream& other)
+	{
+		HandleType fd = pFd;
+		pFd = other.pFd;
+		other.pFd = fd;
+	}
+
+
 
 
 
@@ -0,0 +1,686 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "graph.h"
+#include "queue/service.h"
+#include "../core/smartptr/intrusive.h"
+#include "../thread/signal.h"
+#include "../datetime/timestamp.h"
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+
+
+
+namespace Yuni
+{
+namespace Job
+{
+
+	class Graph::State final : public IIntrusiveSmartPtr<Graph::State, false>
+	{
+	public:
+		//! Ancestor
+		typedef IIntrusiveSmartPtr<Graph::State, false>  Ancestor;
+		//! The most suitable smart pointer for the class
+		typedef Ancestor::SmartPtrType<Graph::State>::PtrThreadSafe Ptr;
+		//! The threading policy
+		typedef Ancestor::ThreadingPolicy ThreadingPolicy;
+
+		//! A single node
+		struct Node final
+		{
+			//! Name of the node
+			String name;
+			//! The callback to call
+			Bind<bool (IJob&)> callback;
+			//! The attached queueservice
+			QueueService* queueservice;
+			//! All predecessors
+			std::vector<NodeID> predecessors;
+			//! All successors
+			std::vector<NodeID> successors;
+			//! Number of predecessors not terminated yet
+			uint remaining;
+			//! Status of the node
+			Status status;
+			//! Timestamps (ms) of the last execution
+			sint64 readyAt, startedAt, finishedAt;
+			//! The job currently executing the node, if any
+			IJob::Ptr job;
+		};
+
+		//! An event of the graph, to fire once unlocked
+		struct PendingEvent final
+		{
+			//! True for `started`, false for `terminated`
+			bool started;
+			//! The status of the graph (`terminated`)
+			Status status;
+		};
+
+
+	public:
+		State(Graph& graph, QueueService& queueservice, bool cancelOnError)
+			: graph(&graph)
+			, defaultQueueservice(queueservice)
+			, cancelOnError(cancelOnError)
+		{}
+
+		~State()
+		{
+			assert(not running and "a graph can not be destroyed while running");
+		}
+
+		bool start();
+		void cancelWL(Status reason);
+		void cancelNodeWL(NodeID node, Status reason);
+		bool nodeStarted(NodeID node, const IJob* job);
+		void nodeTerminated(NodeID node, const IJob* job, bool success);
+		void checkTerminatedWL();
+		//! Fire the pending events (the mutex must not be locked)
+		void fireEvents();
+		//! Detach the graph, once its events are no longer fired
+		void detach();
+
+	public:
+		//! The attached graph (null when destroyed)
+		Graph* graph;
+		//! The default queueservice
+		QueueService& defaultQueueservice;
+		//! True to automatically cancel when the first error is encountered
+		const bool cancelOnError;
+		//! All nodes
+		std::vector<Node> nodes;
+		//! Flag to know if the graph is running
+		bool running = false;
+		//! Flag to know if the graph has been executed at least once
+		bool executed = false;
+		//! Current status of the graph
+		// (should not be directly used if the graph is still running)
+		Status status = stSucceeded;
+		//! The total number of nodes which have terminated (or have been canceled)
+		uint doneCount = 0;
+		//! Timestamps (ms) of the last execution
+		sint64 startedAt = 0, finishedAt = 0;
+		//! Signal for notifyng that the graph has finished
+		Thread::Signal signalStopped;
+		//! Events not fired yet, in order
+		std::deque<PendingEvent> events;
+		//! Flag to know if some events are being fired
+		bool firing = false;
+		//! The thread firing the events
+		std::thread::id firingThread;
+
+	private:
+		void dispatchWL(NodeID node, sint64 now);
+		void terminateWL();
+
+	}; // class Graph::State
+
+
+
+
+	class Graph::NodeJob final : public IJob
+	{
+	public:
+		NodeJob(Graph::State& state, NodeID node, const Bind<bool (IJob&)>& callback)
+			: state(&state)
+			, node(node)
+			, callback(callback)
+		{}
+
+		virtual ~NodeJob() {}
+
+	public:
+		//! The internal data of the graph
+		Graph::State::Ptr state;
+		//! The node executed by the job
+		const NodeID node;
+		//! The callback to call
+		Bind<bool (IJob&)> callback;
+
+	protected:
+		virtual void onExecute() override
+		{
+			// the node may have been canceled in the meantime
+			if (not state->nodeStarted(node, this))
+				return;
+
+			bool success = false;
+			try { success = callback(*this); } catch (...) {}
+			state->nodeTerminated(node, this, success);
+			state->fireEvents();
+		}
+
+	}; // class Graph::NodeJob
+
+
+
+
+
+
+	inline void Graph::State::dispatchWL(NodeID id, sint64 now)
+	{
+		Node& node = nodes[id];
+		node.status = stRunning;
+		node.readyAt = now;
+		node.job = new NodeJob(*this, id, node.callback);
+		node.queueservice->add(node.job);
+	}
+
+
+	inline void Graph::State::terminateWL()
+	{
+		running = false;
+		executed = true;
+		finishedAt = DateTime::NowMilliSeconds();
+
+		if (graph)
+			events.push_back(PendingEvent{false, status});
+		// notify waiters
+		signalStopped.notify();
+	}
+
+
+	void Graph::State::checkTerminatedWL()
+	{
+		if (doneCount == (uint) nodes.size())
+			terminateWL();
+	}
+
+
+	bool Graph::State::start()
+	{
+		ThreadingPolicy::MutexLocker locker(*this);
+		if (running)
+			return false;
+
+		uint count = static_cast<uint>(nodes.size());
+
+		// checking for cycles (Kahn's algorithm)
+		{
+			std::vector<NodeID> ready;
+			for (uint i = 0; i != count; ++i)
+			{
+				nodes[i].remaining = static_cast<uint>(nodes[i].predecessors.size());
+				if (0 == nodes[i].remaining)
+					ready.push_back(i);
+			}
+			uint visited = 0;
+			while (not ready.empty())
+			{
+				NodeID id = ready.back();
+				ready.pop_back();
+				++visited;
+				for (auto successor: nodes[id].successors)
+				{
+					if (0 == --(nodes[successor].remaining))
+						ready.push_back(successor);
+				}
+			}
+			if (visited != count)
+				return false;
+		}
+
+		sint64 now = DateTime::NowMilliSeconds();
+		running = true;
+		status = stSucceeded;
+		doneCount = 0;
+		startedAt = now;
+		finishedAt = 0;
+		signalStopped.reset();
+
+		if (graph)
+			events.push_back(PendingEvent{true, stRunning});
+
+		if (0 == count)
+		{
+			terminateWL();
+			return true;
+		}
+
+		for (uint i = 0; i != count; ++i)
+		{
+			Node& node = nodes[i];
+			node.remaining = static_cast<uint>(node.predecessors.size());
+			node.status = stWaiting;
+			node.readyAt = 0;
+			node.startedAt = 0;
+			node.finishedAt = 0;
+		}
+		for (uint i = 0; i != count; ++i)
+		{
+			if (0 == nodes[i].remaining)
+				dispatchWL(i, now);
+		}
+		return true;
+	}
+
+
+	void Graph::State::fireEvents()
+	{
+		// The events are fired without lock (the observers may query or restart the
+		// graph), by a single thread at a time to keep them in order
+		{
+			ThreadingPolicy::MutexLocker locker(*this);
+			// the thread already firing (maybe this one, from an observer) will fire
+			// these events as well
+			if (firing or events.empty())
+				return;
+			firing = true;
+			firingThread = std::this_thread::get_id();
+		}
+
+		for (;;)
+		{
+			PendingEvent event;
+			Graph* target;
+			{
+				ThreadingPolicy::MutexLocker locker(*this);
+				if (events.empty() or not graph)
+				{
+					events.clear();
+					firing = false;
+					return;
+				}
+				event = events.front();
+				events.pop_front();
+				target = graph;
+			}
+
+			if (event.started)
+				target->on.started();
+			else
+				target->on.terminated(event.status);
+		}
+	}
+
+
+	void Graph::State::detach()
+	{
+		// the events being fired by another thread still reference the graph
+		for (;;)
+		{
+			{
+				ThreadingPolicy::MutexLocker locker(*this);
+				if (not firing or firingThread == std::this_thread::get_id())
+				{
+					graph = nullptr;
+					events.clear();
+					return;
+				}
+			}
+			std::this_thread::yield();
+		}
+	}
+
+
+	void Graph::State::cancelNodeWL(NodeID id, Status reason)
+	{
+		std::vector<NodeID> pending;
+		pending.push_back(id);
+		sint64 now = DateTime::NowMilliSeconds();
+
+		while (not pending.empty())
+		{
+			Node& node = nodes[pending.back()];
+			pending.pop_back();
+			if (node.status != stWaiting and node.status != stRunning)
+				continue;
+
+			if (node.status == stRunning)
+			{
+				node.finishedAt = now;
+				if (!(!node.job))
+				{
+					node.job->cancel();
+					node.job = nullptr;
+				}
+			}
+			node.status = reason;
+			++doneCount;
+			// propagating along the edges
+			for (auto successor: node.successors)
+				pending.push_back(successor);
+		}
+	}
+
+
+	void Graph::State::cancelWL(Status reason)
+	{
+		if (not running)
+			return;
+		if (status == stSucceeded)
+			status = reason;
+
+		for (uint i = 0; i != (uint) nodes.size(); ++i)
+			cancelNodeWL(i, stCanceled);
+		checkTerminatedWL();
+	}
+
+
+	bool Graph::State::nodeStarted(NodeID id, const IJob* job)
+	{
+		ThreadingPolicy::MutexLocker locker(*this);
+		if (running and id < (uint) nodes.size())
+		{
+			Node& node = nodes[id];
+			if (IJob::Ptr::WeakPointer(node.job) == job)
+			{
+				node.startedAt = DateTime::NowMilliSeconds();
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	void Graph::State::nodeTerminated(NodeID id, const IJob* job, bool success)
+	{
+		ThreadingPolicy::MutexLocker locker(*this);
+		if (not running or not (id < (uint) nodes.size()))
+			return;
+		Node& node = nodes[id];
+		if (IJob::Ptr::WeakPointer(node.job) != job) // canceled in the meantime
+			return;
+
+		sint64 now = DateTime::NowMilliSeconds();
+		node.finishedAt = now;
+		node.status = (success) ? stSucceeded : stFailed;
+		node.job = nullptr;
+		++doneCount;
+
+		if (success)
+		{
+			// releasing all successors which do not wait for anything else
+			for (auto successor: node.successors)
+			{
+				Node& next = nodes[successor];
+				if (0 == --next.remaining and next.status == stWaiting)
+					dispatchWL(successor, now);
+			}
+		}
+		else
+		{
+			if (status == stSucceeded)
+				status = stFailed;
+
+			if (cancelOnError)
+			{
+				cancelWL(stFailed);
+				return;
+			}
+			// only the nodes depending on this one can not be executed
+			for (auto successor: node.successors)
+				cancelNodeWL(successor, stCanceled);
+		}
+		checkTerminatedWL();
+	}
+
+
+
+
+
+
+	Graph::Graph(QueueService& queueservice, bool cancelOnError)
+		: pState(new State(*this, queueservice, cancelOnError))
+	{
+		pState->addRef();
+	}
+
+
+	Graph::~Graph()
+	{
+		{
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			pState->cancelWL(stCanceled);
+		}
+		pState->fireEvents();
+		pState->detach();
+		if (pState->release())
+			delete pState;
+	}
+
+
+	Graph::NodeID Graph::add(const AnyString& name, const Bind<bool (IJob&)>& callback)
+	{
+		return add(pState->defaultQueueservice, name, callback);
+	}
+
+
+	Graph::NodeID Graph::add(QueueService& queueservice, const AnyString& name, const Bind<bool (IJob&)>& callback)
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		if (pState->running)
+			return invalid;
+
+		NodeID id = static_cast<NodeID>(pState->nodes.size());
+		pState->nodes.emplace_back();
+		State::Node& node = pState->nodes.back();
+		node.name = name;
+		node.callback = callback;
+		node.queueservice = &queueservice;
+		node.remaining = 0;
+		node.status = stWaiting;
+		node.readyAt = 0;
+		node.startedAt = 0;
+		node.finishedAt = 0;
+		return id;
+	}
+
+
+	bool Graph::depends(NodeID node, NodeID predecessor)
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		uint count = static_cast<uint>(pState->nodes.size());
+		if (pState->running or not (node < count) or not (predecessor < count) or node == predecessor)
+			return false;
+
+		auto& predecessors = pState->nodes[node].predecessors;
+		if (std::find(predecessors.begin(), predecessors.end(), predecessor) == predecessors.end())
+		{
+			predecessors.push_back(predecessor);
+			pState->nodes[predecessor].successors.push_back(node);
+		}
+		return true;
+	}
+
+
+	uint Graph::size() const
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		return static_cast<uint>(pState->nodes.size());
+	}
+
+
+	bool Graph::clear()
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		if (pState->running)
+			return false;
+		pState->nodes.clear();
+		pState->executed = false;
+		return true;
+	}
+
+
+	bool Graph::start()
+	{
+		bool started = pState->start();
+		pState->fireEvents();
+		return started;
+	}
+
+
+	void Graph::cancel()
+	{
+		{
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			pState->cancelWL(stCanceled);
+		}
+		pState->fireEvents();
+	}
+
+
+	void Graph::cancel(NodeID node)
+	{
+		{
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			if (pState->running and node < (uint) pState->nodes.size())
+			{
+				if (pState->status == stSucceeded)
+					pState->status = stCanceled;
+				pState->cancelNodeWL(node, stCanceled);
+				pState->checkTerminatedWL();
+			}
+		}
+		pState->fireEvents();
+	}
+
+
+	Graph::Status Graph::wait()
+	{
+		// checking if not already stopped
+		{
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			if (not pState->running)
+				return pState->status;
+		}
+
+		// wait
+		pState->signalStopped.wait();
+
+		// getting the return value
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		return pState->status;
+	}
+
+
+	Graph::Status Graph::wait(uint timeout)
+	{
+		// checking if not already stopped
+		{
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			if (not pState->running)
+				return pState->status;
+		}
+
+		if (pState->signalStopped.wait(timeout)) // received notification
+		{
+			// getting the return value
+			State::ThreadingPolicy::MutexLocker locker(*pState);
+			return pState->status;
+		}
+
+		// the timeout has been reached
+		return stRunning;
+	}
+
+
+	Graph::Status Graph::status(uint* nodeCount, uint* doneCount) const
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		if (nodeCount != nullptr)
+			*nodeCount = (uint) pState->nodes.size();
+		if (doneCount != nullptr)
+			*doneCount = pState->doneCount;
+
+		return (not pState->running) ? pState->status : stRunning;
+	}
+
+
+	Graph::Status Graph::status(NodeID node) const
+	{
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		return (node < (uint) pState->nodes.size()) ? pState->nodes[node].status : stFailed;
+	}
+
+
+	bool Graph::criticalPath(CriticalPath& out) const
+	{
+		out.steps.clear();
+		out.duration = 0;
+		out.waited = 0;
+
+		State::ThreadingPolicy::MutexLocker locker(*pState);
+		if (pState->running or not pState->executed)
+			return false;
+
+		auto& nodes = pState->nodes;
+		auto executed = [&](NodeID id) -> bool
+		{
+			return nodes[id].startedAt != 0
+				and (nodes[id].status == stSucceeded or nodes[id].status == stFailed);
+		};
+
+		// the last executed node to finish
+		NodeID last = invalid;
+		for (uint i = 0; i != (uint) nodes.size(); ++i)
+		{
+			if (executed(i) and (last == invalid or nodes[i].finishedAt > nodes[last].finishedAt))
+				last = i;
+		}
+		if (last == invalid)
+			return true;
+		out.duration = static_cast<uint64>(nodes[last].finishedAt - pState->startedAt);
+
+		// going backward, following the predecessors which have finished last
+		while (last != invalid)
+		{
+			const State::Node& node = nodes[last];
+			out.steps.emplace_back();
+			CriticalPath::Step& step = out.steps.back();
+			step.node = last;
+			step.name = node.name;
+			step.waited = static_cast<uint64>(node.startedAt - node.readyAt);
+			step.duration = static_cast<uint64>(node.finishedAt - node.startedAt);
+			out.waited += step.waited;
+
+			last = invalid;
+			for (auto predecessor: node.predecessors)
+			{
+				if (executed(predecessor)
+					and (last == invalid or nodes[predecessor].finishedAt > nodes[last].finishedAt))
+					last = predecessor;
+			}
+		}
+		std::reverse(out.steps.begin(), out.steps.end());
+		return true;
+	}
+
+
+	String Graph::criticalPathReport() const
+	{
+		String report;
+		CriticalPath path;
+		if (not criticalPath(path))
+		{
+			report << "critical path: not available\n";
+			return report;
+		}
+
+		report << "critical path: " << path.duration << "ms (" << path.steps.size()
+			<< " nodes, waited: " << path.waited << "ms)\n";
+		for (auto& step: path.steps)
+		{
+			report << "  #" << step.node << ' ' << step.name << ": " << step.duration
+				<< "ms (waited: " << step.waited << "ms)\n";
+		}
+		return report;
+	}
+
+
+
+
+
+} // namespace Job
+} // namespace Yuni
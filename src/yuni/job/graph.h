@@ -0,0 +1,277 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../yuni.h"
+#include "../core/string.h"
+#include "../core/event/event.h"
+#include "../core/noncopyable.h"
+#include <vector>
+
+
+
+
+namespace Yuni
+{
+namespace Job
+{
+
+	//! Forward declaration
+	class IJob;
+	class QueueService;
+
+
+
+	/*!
+	** \brief Graph of jobs with dependencies (directed acyclic graph)
+	**
+	** Each node of the graph is a job, which is added to its queueservice as soon as
+	** all its predecessors have succeeded. Nodes without any dependency between them
+	** may run in parallel.
+	**
+	** When a node fails (or is canceled), all its successors (directly or not) are
+	** canceled. If `cancelOnError` is true, the whole graph is canceled instead.
+	**
+	** \code
+	** Job::QueueService queueservice;
+	** queueservice.start();
+	** Job::Graph graph(queueservice);
+	**
+	** auto parse = graph.add("parse", [&](IJob&) -> bool { return true; });
+	** auto merge = graph.add("merge", [&](IJob&) -> bool { return true; });
+	** for (uint i = 0; i != 4; ++i)
+	** {
+	**	auto transform = graph.add("transform", [&, i](IJob&) -> bool { return true; });
+	**	graph.depends(transform, parse);
+	**	graph.depends(merge, transform);
+	** }
+	**
+	** graph.start();
+	** if (graph.wait() == Job::Graph::stSucceeded)
+	**	std::cout << graph.criticalPathReport() << std::endl;
+	** \endcode
+	**
+	** Nodes and dependencies can not be modified while the graph is running.
+	** \internal This class must keep the fewer dependencies as possible
+	*/
+	class YUNI_DECL Graph final : public NonCopyable<Graph>
+	{
+	public:
+		//! Identifier of a node within the graph
+		typedef uint NodeID;
+
+		enum
+		{
+			//! Invalid node identifier
+			invalid = (uint) -1,
+		};
+
+		enum Status
+		{
+			//! The graph (or the node) is currently running
+			stRunning,
+			//! The graph (or the node) has succeeded
+			stSucceeded,
+			//! The graph (or the node) has failed
+			stFailed,
+			//! The graph (or the node) has been canceled
+			stCanceled,
+			//! The node is waiting for its predecessors (or for the graph to start)
+			stWaiting,
+		};
+
+		/*!
+		** \brief Critical path of the last execution of the graph
+		**
+		** The critical path is the chain of nodes which determined the total
+		** duration of the graph: each node of the path is the last predecessor
+		** to finish of the next one. All timings are in milliseconds.
+		*/
+		struct CriticalPath final
+		{
+			struct Step final
+			{
+				//! The node
+				NodeID node;
+				//! Name of the node
+				String name;
+				//! Time spent in the queue once ready, before being executed
+				uint64 waited;
+				//! Execution time of the node
+				uint64 duration;
+			};
+			//! All nodes of the critical path, in order of execution
+			std::vector<Step> steps;
+			//! Time elapsed from the start of the graph to the end of the critical path
+			uint64 duration;
+			//! Total time spent in the queues by the nodes of the critical path
+			uint64 waited;
+		};
+
+
+	public:
+		//! \name Constructors & Destructor
+		//@{
+		/*!
+		** \brief Default constructor
+		** \param queueservice The default queueservice to use when not specified
+		** \param cancelOnError True to cancel the whole graph at the first failure
+		*/
+		explicit Graph(QueueService& queueservice, bool cancelOnError = true);
+		/*!
+		** \brief Destructor
+		**
+		** The graph will be canceled if running. Use `wait()` to avoid this behavior
+		*/
+		~Graph();
+		//@}
+
+
+		//! \name Nodes
+		//@{
+		/*!
+		** \brief Add a new node, executed by the default queueservice
+		**
+		** \param name Name of the node (for reporting)
+		** \param callback A functor / lambda
+		** \return The identifier of the new node, `invalid` if the graph is running
+		*/
+		NodeID add(const AnyString& name, const Bind<bool (IJob&)>& callback);
+
+		/*!
+		** \brief Add a new node, executed by a specific queueservice
+		**
+		** \param queueservice Any queueservice can be used.
+		** \param name Name of the node (for reporting)
+		** \param callback A functor / lambda
+		** \return The identifier of the new node, `invalid` if the graph is running
+		*/
+		NodeID add(QueueService& queueservice, const AnyString& name, const Bind<bool (IJob&)>& callback);
+
+		/*!
+		** \brief Make a node depend on another one
+		**
+		** The node will only be executed once the predecessor has succeeded.
+		** \return False if the graph is running or if one of the nodes is invalid
+		*/
+		bool depends(NodeID node, NodeID predecessor);
+
+		//! Get the number of nodes
+		uint size() const;
+
+		//! Remove all nodes (not if running)
+		bool clear();
+		//@}
+
+
+		//! \name Execution
+		//@{
+		/*!
+		** \brief Run the graph
+		**
+		** All nodes without any predecessor are added to their queueservice.
+		** \return False if the graph is already running or if it contains a cycle
+		*/
+		bool start();
+
+		/*!
+		** \brief Cancel the graph
+		**
+		** All running nodes will be stopped as soon as possible, and the
+		** waiting ones will never be executed
+		*/
+		void cancel();
+
+		/*!
+		** \brief Cancel a single node and all its successors
+		*/
+		void cancel(NodeID node);
+
+		/*!
+		** \brief Wait for the graph being complete
+		** \return The status of the graph
+		*/
+		Status wait();
+
+		/*!
+		** \brief Wait for the graph being complete (with timeout)
+		**
+		** \param timeout A timeout, in milliseconds
+		** \return The status of the graph. stRunning if the timeout has been reached
+		*/
+		Status wait(uint timeout);
+
+		/*!
+		** \brief Get the current status of the graph and Fetch various information in the same time
+		**
+		** \param[out] nodeCount The total number of nodes [optional]
+		** \param[out] doneCount The total number of nodes which have terminated (or canceled) [optional]
+		** \return status The current status of the graph
+		*/
+		Status status(uint* nodeCount = nullptr, uint* doneCount = nullptr) const;
+
+		//! Get the status of a single node
+		Status status(NodeID node) const;
+		//@}
+
+
+		//! \name Report
+		//@{
+		/*!
+		** \brief Get the critical path of the last execution
+		**
+		** \return False if the graph has never been executed or is still running
+		*/
+		bool criticalPath(CriticalPath& out) const;
+
+		/*!
+		** \brief Get a human-readable report of the critical path of the last execution
+		*/
+		String criticalPathReport() const;
+		//@}
+
+
+	public:
+		/*!
+		** \brief All events
+		**
+		** The events are fired in order, without any internal lock held: an observer
+		** may query the graph, wait for it or start it again.
+		*/
+		struct
+		{
+			//! Event: the graph has started (can be called from any thread)
+			Event<void ()> started;
+			//! Event: the graph has terminated its work (can be called from any thread)
+			Event<void (Status status)> terminated;
+		}
+		on;
+
+
+	private:
+		//! Internal data, shared with the jobs
+		class State;
+		//! Job for a single node
+		class NodeJob;
+
+	private:
+		//! Internal data (always valid, with its own reference)
+		State* pState;
+
+	}; // class Graph
+
+
+
+
+
+
+
+} // namespace Job
+} // namespace Yuni
@@ -0,0 +1,76 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "local-queue.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace QueueService
+{
+
+	enum
+	{
+		//! Initial capacity of a local queue (power of 2)
+		initialCapacity = 256,
+	};
+
+
+	LocalQueue::LocalQueue()
+		: pTop(0)
+		, pBottom(0)
+	{
+		Buffer* buffer = new Buffer();
+		buffer->capacity = initialCapacity;
+		buffer->slots    = new std::atomic<Yuni::Job::IJob*>[initialCapacity];
+		buffer->previous = nullptr;
+		pBuffer.store(buffer, std::memory_order_relaxed);
+	}
+
+
+	LocalQueue::~LocalQueue()
+	{
+		Buffer* buffer = pBuffer.load(std::memory_order_relaxed);
+		while (buffer)
+		{
+			Buffer* previous = buffer->previous;
+			delete[] buffer->slots;
+			delete buffer;
+			buffer = previous;
+		}
+	}
+
+
+	LocalQueue::Buffer* LocalQueue::grow(Buffer* buffer, sint64 top, sint64 bottom)
+	{
+		Buffer* newbuffer = new Buffer();
+		newbuffer->capacity = buffer->capacity * 2;
+		newbuffer->slots    = new std::atomic<Yuni::Job::IJob*>[newbuffer->capacity];
+		// the old buffer can not be released yet, since some thieves might still
+		// read from it. It will be released with the queue itself
+		newbuffer->previous = buffer;
+
+		for (sint64 i = top; i < bottom; ++i)
+			newbuffer->put(i, buffer->get(i));
+
+		pBuffer.store(newbuffer, std::memory_order_release);
+		return newbuffer;
+	}
+
+
+
+
+
+} // namespace QueueService
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,107 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../fwd.h"
+#include "../../core/noncopyable.h"
+#include <atomic>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace QueueService
+{
+
+	/*!
+	** \brief Lock-free work-stealing deque, owned by a single worker (Chase-Lev)
+	**
+	** Only the owner of the queue may call `push()` and `pop()` (LIFO end), while
+	** any other thread may call `steal()` (FIFO end) concurrently.
+	** The queue does not manage the references of the jobs: the caller is
+	** responsible for incrementing/decrementing the reference count of the jobs.
+	**
+	** \see "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al, 2013
+	*/
+	class YUNI_DECL LocalQueue final : private NonCopyable<LocalQueue>
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		LocalQueue();
+		//! Destructor
+		~LocalQueue();
+		//@}
+
+
+		//! \name Owner
+		//@{
+		//! Push a job at the bottom of the queue (owner only)
+		void push(Yuni::Job::IJob* job);
+		//! Pop a job from the bottom of the queue (owner only), null if empty
+		Yuni::Job::IJob* pop();
+		//@}
+
+		//! \name Thieves
+		//@{
+		//! Steal a job from the top of the queue (any thread), null if empty
+		Yuni::Job::IJob* steal();
+		//@}
+
+		//! Get if the queue seems empty (the result may already be outdated)
+		bool empty() const;
+
+
+	private:
+		//! Circular array of jobs
+		struct Buffer final
+		{
+			//! Capacity (power of 2)
+			sint64 capacity;
+			//! All slots
+			std::atomic<Yuni::Job::IJob*>* slots;
+			//! Previous (smaller) buffer, kept alive for concurrent thieves
+			Buffer* previous;
+
+			Yuni::Job::IJob* get(sint64 index) const;
+			void put(sint64 index, Yuni::Job::IJob* job);
+		};
+
+		//! Grow the circular array (owner only)
+		Buffer* grow(Buffer* buffer, sint64 top, sint64 bottom);
+
+	private:
+		//! Index of the next job to steal
+		std::atomic<sint64> pTop;
+		//! Padding, to avoid false sharing between thieves and the owner
+		char pPadding0[64 - sizeof(std::atomic<sint64>)];
+		//! Index of the next free slot
+		std::atomic<sint64> pBottom;
+		//! The current circular array
+		std::atomic<Buffer*> pBuffer;
+		//! Padding, to avoid false sharing with the next queue
+		char pPadding1[64 - sizeof(std::atomic<sint64>) - sizeof(std::atomic<Buffer*>)];
+
+	}; // class LocalQueue
+
+
+
+
+
+
+} // namespace QueueService
+} // namespace Private
+} // namespace Yuni
+
+#include "local-queue.hxx"
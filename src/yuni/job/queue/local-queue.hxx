@@ -0,0 +1,111 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "local-queue.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace QueueService
+{
+
+	inline Yuni::Job::IJob* LocalQueue::Buffer::get(sint64 index) const
+	{
+		return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+	}
+
+
+	inline void LocalQueue::Buffer::put(sint64 index, Yuni::Job::IJob* job)
+	{
+		slots[index & (capacity - 1)].store(job, std::memory_order_relaxed);
+	}
+
+
+	inline bool LocalQueue::empty() const
+	{
+		sint64 bottom = pBottom.load(std::memory_order_relaxed);
+		return (bottom <= pTop.load(std::memory_order_relaxed));
+	}
+
+
+	inline void LocalQueue::push(Yuni::Job::IJob* job)
+	{
+		sint64 bottom = pBottom.load(std::memory_order_relaxed);
+		sint64 top    = pTop.load(std::memory_order_acquire);
+		Buffer* buffer = pBuffer.load(std::memory_order_relaxed);
+
+		if (YUNI_UNLIKELY(bottom - top > buffer->capacity - 1))
+			buffer = grow(buffer, top, bottom);
+
+		buffer->put(bottom, job);
+		std::atomic_thread_fence(std::memory_order_release);
+		pBottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+
+	inline Yuni::Job::IJob* LocalQueue::pop()
+	{
+		sint64 bottom = pBottom.load(std::memory_order_relaxed) - 1;
+		Buffer* buffer = pBuffer.load(std::memory_order_relaxed);
+		pBottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		sint64 top = pTop.load(std::memory_order_relaxed);
+
+		if (top <= bottom)
+		{
+			Yuni::Job::IJob* job = buffer->get(bottom);
+			if (top == bottom)
+			{
+				// last item - racing against thieves
+				if (not pTop.compare_exchange_strong(top, top + 1,
+					std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+				pBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return job;
+		}
+		// empty queue
+		pBottom.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+
+	inline Yuni::Job::IJob* LocalQueue::steal()
+	{
+		do
+		{
+			sint64 top = pTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			sint64 bottom = pBottom.load(std::memory_order_acquire);
+
+			if (not (top < bottom))
+				return nullptr;
+
+			Yuni::Job::IJob* job = pBuffer.load(std::memory_order_acquire)->get(top);
+			if (pTop.compare_exchange_strong(top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed))
+				return job;
+
+			// another thief (or the owner) was faster - the queue may not be empty yet
+		}
+		while (true);
+	}
+
+
+
+
+
+} // namespace QueueService
+} // namespace Private
+} // namespace Yuni
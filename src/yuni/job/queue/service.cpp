@@ -12,6 +12,9 @@
 #include "../../core/system/cpu.h"
 #include "../../thread/array.h"
 #include "../../private/jobs/queue/thread.h"
+#include "../../datetime/timestamp.h"
+#include "../../thread/timer-service.h"
+#include <algorithm>
 #ifndef YUNI_OS_WINDOWS
 	#include <unistd.h>
 #endif
@@ -25,6 +28,10 @@ namespace Job
 	enum
 	{
 		maxNumberOfThreads = 512,
+		//! Default idle timeout for additional workers (ms)
+		defaultIdleTimeout = 10000,
+		//! How long all workers must be busy before adding a new one (ms)
+		saturationDelay = 50,
 	};
 
 
@@ -32,6 +39,106 @@ namespace Job
 
 
 
+	class QueueService::SaturationMonitor final
+		: public IIntrusiveSmartPtr<QueueService::SaturationMonitor, false>
+	{
+	public:
+		//! Ancestor
+		typedef IIntrusiveSmartPtr<QueueService::SaturationMonitor, false>  Ancestor;
+		//! The most suitable smart pointer for the class
+		typedef Ancestor::SmartPtrType<QueueService::SaturationMonitor>::PtrThreadSafe Ptr;
+		//! The threading policy
+		typedef Ancestor::ThreadingPolicy ThreadingPolicy;
+
+	public:
+		explicit SaturationMonitor(QueueService& queueservice)
+			: queueservice(&queueservice)
+			, timer(0)
+		{}
+
+	public:
+		//! The monitored queueservice, null when detached [protected by the mutex of the monitor]
+		QueueService* queueservice;
+		//! Timer of the monitor
+		Thread::TimerService::ID timer;
+
+	}; // class QueueService::SaturationMonitor
+
+
+
+	namespace // anonymous
+	{
+
+		//! Timers shared by all elastic queueservices, for monitoring their saturation
+		class SharedTimers final
+		{
+		public:
+			SharedTimers() : service(nullptr), users(0) {}
+
+			Mutex mutex;
+			//! The service (a single thread), only while used by at least one queueservice
+			Thread::TimerService* service;
+			//! Number of monitors
+			uint users;
+		};
+
+
+		static SharedTimers& Timers()
+		{
+			// never destroyed: a queueservice may still be stopped by the destructor
+			// of a static object
+			static SharedTimers* const timers = new SharedTimers();
+			return *timers;
+		}
+
+
+		static Thread::TimerService::ID ScheduleMonitor(const Bind<bool ()>& callback)
+		{
+			SharedTimers& timers = Timers();
+			MutexLocker locker(timers.mutex);
+			if (0 == timers.users++)
+			{
+				timers.service = new Thread::TimerService();
+				timers.service->start();
+			}
+			return timers.service->every(saturationDelay, callback);
+		}
+
+
+		static void CancelMonitor(Thread::TimerService::ID timer)
+		{
+			SharedTimers& timers = Timers();
+			Thread::TimerService* unused = nullptr;
+			{
+				MutexLocker locker(timers.mutex);
+				timers.service->cancel(timer);
+				if (0 == --timers.users)
+				{
+					unused = timers.service;
+					timers.service = nullptr;
+				}
+			}
+			// stopping its thread (without the shared lock, the callbacks never wait for it)
+			delete unused;
+		}
+
+	} // anonymous namespace
+
+
+
+
+	static inline bool RemoveWorker(std::vector<Yuni::Private::QueueService::QueueThread*>& list,
+		Yuni::Private::QueueService::QueueThread* worker)
+	{
+		std::vector<Yuni::Private::QueueService::QueueThread*>::iterator it
+			= std::find(list.begin(), list.end(), worker);
+		if (it == list.end())
+			return false;
+		list.erase(it);
+		return true;
+	}
+
+
 	static inline uint OptimalCPUCount()
 	{
 		uint count = System::CPU::Count();
@@ -51,6 +158,15 @@ namespace Job
 	QueueService::QueueService()
 		: pStatus(sStopped)
 		, pThreads(NULL)
+		, pWorkStealing(false)
+		, pIdleWorkerCount(0)
+		, pThreadCount(0)
+		, pCreatedThreadCount(0)
+		, pIdleTimeout(defaultIdleTimeout)
+		, pMonitor(nullptr)
+		, pSaturatedSince(0)
+		, pGrowCount(0)
+		, pShrinkCount(0)
 	{
 		uint count = OptimalCPUCount();
 		pMinimumThreadCount = count;
@@ -61,6 +177,15 @@ namespace Job
 	QueueService::QueueService(bool autostart)
 		: pStatus(sStopped)
 		, pThreads(NULL)
+		, pWorkStealing(false)
+		, pIdleWorkerCount(0)
+		, pThreadCount(0)
+		, pCreatedThreadCount(0)
+		, pIdleTimeout(defaultIdleTimeout)
+		, pMonitor(nullptr)
+		, pSaturatedSince(0)
+		, pGrowCount(0)
+		, pShrinkCount(0)
 	{
 		uint count = OptimalCPUCount();
 		pMinimumThreadCount = count;
@@ -75,6 +200,8 @@ namespace Job
 	{
 		// making sure that the queueservice is stopped before being destroyed
 		stop();
+		// the thread pool is kept after a graceful stop (see gracefulStop())
+		delete (ThreadArray*) pThreads;
 	}
 
 
@@ -166,6 +293,17 @@ namespace Job
 
 			delete (ThreadArray*) pThreads;
 			pThreads = new ThreadArray();
+			pIdleWorkers.clear();
+			idleWorkersChangedWL();
+			pPendingWorkers.clear();
+			pRetiredWorkers.clear();
+			pSaturatedSince = 0;
+
+			// local queues for each worker (work-stealing mode only), including the
+			// additional workers which may be started later.
+			// Jobs from the previous local queues, if any, are moved back to the shared queues
+			pWaitingRoom.attachWorkers(pWorkStealing ? pMaximumThreadCount : 0);
+			pWaitingRoom.workersInUse(pMinimumThreadCount);
 
 			// alias to the thread pool
 			ThreadArray& array = *((ThreadArray*) pThreads);
@@ -174,7 +312,23 @@ namespace Job
 			// adding the minimum number of threads
 			array.clear();
 			for (uint i = 0; i != pMinimumThreadCount; ++i)
-				array += new Yuni::Private::QueueService::QueueThread(*this);
+				array += new Yuni::Private::QueueService::QueueThread(*this, i, false);
+			pThreadCount = pMinimumThreadCount;
+			pCreatedThreadCount = pMinimumThreadCount;
+
+			// monitoring the saturation of the thread pool, to add new workers if needed
+			// (on the timers shared by all queueservices, instead of a thread for each of them)
+			releaseMonitorWL();
+			if (pMaximumThreadCount > pMinimumThreadCount)
+			{
+				pMonitor = new SaturationMonitor(*this);
+				pMonitor->addRef();
+				SaturationMonitor::Ptr monitor = pMonitor;
+				pMonitor->timer = ScheduleMonitor([monitor]() -> bool
+				{
+					return CheckSaturation(*monitor);
+				});
+			}
 
 			// Start all threads at once
 			array.start();
@@ -196,9 +350,23 @@ namespace Job
 			if (pStatus != sRunning)
 				return;
 
+			releaseMonitorWL();
+
 			threads  = (ThreadArray*) pThreads;
-			pThreads = NULL;
 			pStatus  = sStopping;
+			// interrupting the elastic workers waiting for new jobs
+			if (threads)
+			{
+				threads->gracefulStop();
+				notifyAllWorkersWL();
+			}
+			pThreads = NULL;
+			// the workers are about to be destroyed
+			pIdleWorkers.clear();
+			idleWorkersChangedWL();
+			pPendingWorkers.clear();
+			pRetiredWorkers.clear();
+			pThreadCount = 0;
 		}
 
 		// Destroying the thread pool
@@ -220,16 +388,28 @@ namespace Job
 	}
 
 
-	void QueueService::registerWorker(void* threadself)
+	void QueueService::registerWorker(Yuni::Private::QueueService::QueueThread* threadself)
 	{
 		assert(threadself != nullptr);
 		MutexLocker locker(*this);
 		if (pWorkerSet.count(threadself) == 0)
 			pWorkerSet.insert(threadself);
+
+		// the worker is no longer idle (it may have been waked up by someone else)
+		if (not RemoveWorker(pPendingWorkers, threadself))
+		{
+			if (RemoveWorker(pIdleWorkers, threadself))
+				idleWorkersChangedWL();
+		}
+
+		// This worker will take a single job at a time. Waking up another worker
+		// if there are more jobs to do (which will do the same if needed)
+		if (pPendingWorkers.empty() and pWaitingRoom.size() > 1)
+			wakeupIdleWorkersWL(1);
 	}
 
 
-	void QueueService::unregisterWorker(void* threadself)
+	void QueueService::unregisterWorker(Yuni::Private::QueueService::QueueThread* threadself)
 	{
 		assert(threadself != nullptr);
 		MutexLocker locker(*this);
@@ -238,6 +418,27 @@ namespace Job
 		if (pWorkerSet.end() != it)
 		{
 			pWorkerSet.erase(it);
+
+			if (pStatus == sRunning and pThreads)
+			{
+				// Idle *before* checking for new jobs: a concurrent add() either sees this
+				// worker (and wakes it up), or its job is seen here (see wakeupWorkers())
+				pIdleWorkers.push_back(threadself);
+				idleWorkersChangedWL();
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				// Some jobs may have been added after the last check of the worker, but
+				// before its removal from the list of workers in active duty (thus without
+				// waking it up). The pending wake up signal will prevent it from sleeping
+				if (not pWaitingRoom.empty())
+				{
+					pIdleWorkers.pop_back();
+					idleWorkersChangedWL();
+					threadself->notifyNewJobs();
+					return;
+				}
+			}
+
 			if (pWorkerSet.empty())
 			{
 				if (pStatus == sStopping)
@@ -264,6 +465,10 @@ namespace Job
 			pStatus = sStopping;
 			// ask to stop to all threads
 			((ThreadArray*) pThreads)->gracefulStop();
+			// interrupting the elastic workers waiting for new jobs
+			notifyAllWorkersWL();
+			// no new worker
+			releaseMonitorWL();
 			// notifying that the queueservice is stopped (or will stop soon)
 			pSignalShouldStop.notify();
 		}
@@ -373,27 +578,218 @@ namespace Job
 	}
 
 
-	inline void QueueService::wakeupWorkers()
+	inline void QueueService::wakeupIdleWorkersWL(uint count)
+	{
+		// the most recent idle workers first (their cache is more likely to be still hot)
+		while (count != 0 and not pIdleWorkers.empty())
+		{
+			Yuni::Private::QueueService::QueueThread* worker = pIdleWorkers.back();
+			pIdleWorkers.pop_back();
+			pPendingWorkers.push_back(worker);
+			worker->notifyNewJobs();
+			--count;
+		}
+		idleWorkersChangedWL();
+	}
+
+
+	inline void QueueService::idleWorkersChangedWL()
+	{
+		pIdleWorkerCount.store(static_cast<uint>(pIdleWorkers.size()), std::memory_order_seq_cst);
+	}
+
+
+	void QueueService::growIfSaturatedWL()
+	{
+		// Saturated: no worker is available or about to take a job, and there are
+		// at least as many jobs waiting as running workers
+		if (not pIdleWorkers.empty() or not pPendingWorkers.empty()
+			or pWaitingRoom.size() < pThreadCount or pStatus != sRunning or not pThreads)
+		{
+			pSaturatedSince = 0;
+			return;
+		}
+
+		if (pThreadCount >= pMaximumThreadCount)
+			return;
+
+		// the thread pool must stay saturated for a while before adding new workers,
+		// to not react to a simple burst of jobs
+		sint64 now = DateTime::NowMilliSeconds();
+		if (0 == pSaturatedSince)
+		{
+			pSaturatedSince = now;
+			return;
+		}
+		if (now - pSaturatedSince < saturationDelay)
+			return;
+
+		// Restarting a retired worker if possible (and if really stopped)
+		Yuni::Private::QueueService::QueueThread* worker = nullptr;
+		for (uint i = 0; i != (uint) pRetiredWorkers.size(); ++i)
+		{
+			if (not pRetiredWorkers[i]->started())
+			{
+				worker = pRetiredWorkers[i];
+				pRetiredWorkers.erase(pRetiredWorkers.begin() + i);
+				break;
+			}
+		}
+
+		bool newWorker = (nullptr == worker);
+		if (newWorker)
+		{
+			// too many retired workers not stopped yet
+			if (pCreatedThreadCount >= pMaximumThreadCount)
+				return;
+			worker = new Yuni::Private::QueueService::QueueThread(*this, pCreatedThreadCount, true);
+			++pCreatedThreadCount;
+			pWaitingRoom.workersInUse(pCreatedThreadCount);
+		}
+
+		++pThreadCount;
+		++pGrowCount;
+		// waiting for a new period of saturation before adding another one
+		pSaturatedSince = 0;
+		// the worker will soon take some jobs
+		pPendingWorkers.push_back(worker);
+
+		if (newWorker)
+			((ThreadArray*) pThreads)->add(worker, true);
+		else
+			worker->start();
+	}
+
+
+	void QueueService::releaseMonitorWL()
+	{
+		SaturationMonitor* monitor = pMonitor;
+		if (not monitor)
+			return;
+		pMonitor = nullptr;
+		{
+			// the callback may be running, but never waits for our lock (see CheckSaturation())
+			SaturationMonitor::ThreadingPolicy::MutexLocker locker(*monitor);
+			monitor->queueservice = nullptr;
+		}
+		CancelMonitor(monitor->timer);
+		if (monitor->release())
+			delete monitor;
+	}
+
+
+	bool QueueService::CheckSaturation(SaturationMonitor& monitor)
+	{
+		SaturationMonitor::ThreadingPolicy::MutexLocker locker(monitor);
+		QueueService* queueservice = monitor.queueservice;
+		if (not queueservice)
+			return false; // detached
+		// The queueservice may be detaching this monitor, with its lock. Trying again
+		// at the next period instead of waiting for it
+		if (queueservice->pMutex.trylock())
+		{
+			queueservice->growIfSaturatedWL();
+			queueservice->pMutex.unlock();
+		}
+		return true;
+	}
+
+
+	bool QueueService::retireWorker(Yuni::Private::QueueService::QueueThread* threadself)
+	{
+		assert(threadself != nullptr);
+		MutexLocker locker(*this);
+
+		if (pStatus != sRunning or pThreadCount <= pMinimumThreadCount)
+			return false;
+		// the worker may have been waked up in the meantime
+		if (not RemoveWorker(pIdleWorkers, threadself))
+			return false;
+		idleWorkersChangedWL();
+
+		pRetiredWorkers.push_back(threadself);
+		--pThreadCount;
+		++pShrinkCount;
+		return true;
+	}
+
+
+	namespace // anonymous
+	{
+
+		class NotifyWorkerPredicate final
+		{
+		public:
+			template<class ThreadPtrT>
+			bool operator () (const ThreadPtrT& thread) const
+			{
+				thread->notifyNewJobs();
+				return true;
+			}
+		};
+
+	} // anonymous namespace
+
+
+	inline void QueueService::notifyAllWorkersWL()
+	{
+		if (pThreads)
+			((ThreadArray*) pThreads)->foreachThread(NotifyWorkerPredicate());
+	}
+
+
+	void QueueService::wakeupWorkers(uint count)
 	{
+		// The jobs have just been added: no lock if there is no idle worker to wake up
+		// (all of them are busy and will check the waiting room again before sleeping,
+		// see unregisterWorker())
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (0 == pIdleWorkerCount.load(std::memory_order_relaxed))
+			return;
+
 		MutexLocker locker(*this);
-		if (pWorkerSet.size() < pMaximumThreadCount and pThreads)
-			((ThreadArray*) pThreads)->wakeUp();
+		// Some workers have already been waked up and will soon take some jobs.
+		// Waking up only the number of workers actually needed
+		uint pending = static_cast<uint>(pPendingWorkers.size());
+		if (count > pending)
+			wakeupIdleWorkersWL(count - pending);
+	}
+
+
+	uint QueueService::currentWorkerIndex() const
+	{
+		Yuni::Private::QueueService::QueueThread* worker = Yuni::Private::QueueService::QueueThread::Current();
+		return (worker and &(worker->queueservice()) == this) ? worker->index() : (uint) -1;
 	}
 
 
 	void QueueService::add(const IJob::Ptr& job)
 	{
-		assert(!(!job) and "invalid job");
-		pWaitingRoom.add(job);
-		wakeupWorkers();
+		add(job, Yuni::Job::Priority::normal);
 	}
 
 
 	void QueueService::add(const IJob::Ptr& job, Priority priority)
 	{
 		assert(!(!job) and "invalid job");
-		pWaitingRoom.add(job, priority);
-		wakeupWorkers();
+
+		// jobs added from one of our workers go to its local queue (if any)
+		pWaitingRoom.add(job, priority, currentWorkerIndex());
+		wakeupWorkers(1);
+	}
+
+
+	bool QueueService::workStealing() const
+	{
+		MutexLocker locker(*this);
+		return pWorkStealing;
+	}
+
+
+	void QueueService::workStealing(bool enabled)
+	{
+		MutexLocker locker(*this);
+		pWorkStealing = enabled;
 	}
 
 
@@ -406,7 +802,38 @@ namespace Job
 	uint QueueService::threadCount() const
 	{
 		MutexLocker locker(*this);
-		return pThreads ? ((const ThreadArray*) pThreads)->size() : 0;
+		return pThreadCount;
+	}
+
+
+	uint QueueService::idleTimeout() const
+	{
+		MutexLocker locker(*this);
+		return pIdleTimeout;
+	}
+
+
+	bool QueueService::idleTimeout(uint timeout)
+	{
+		if (0 == timeout)
+			return false;
+		MutexLocker locker(*this);
+		pIdleTimeout = timeout;
+		return true;
+	}
+
+
+	uint64 QueueService::growCount() const
+	{
+		MutexLocker locker(*this);
+		return pGrowCount;
+	}
+
+
+	uint64 QueueService::shrinkCount() const
+	{
+		MutexLocker locker(*this);
+		return pShrinkCount;
 	}
 
 
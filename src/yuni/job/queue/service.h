@@ -17,6 +17,7 @@
 #include "q-event.h"
 #include "../../core/dictionary.h"
 #include "../../core/smartptr/intrusive.h"
+#include <atomic>
 
 
 
@@ -196,6 +197,27 @@ namespace Job
 		*/
 		void add(const IJob::Ptr& job, Priority priority);
 
+		/*!
+		** \brief Add several jobs into the queue at once
+		**
+		** The jobs are added into the waiting room with a single lock acquisition,
+		** and only the number of idle workers actually needed are waked up.
+		** This method should be preferred to a loop over `add()` when a lot of
+		** jobs must be added at once.
+		**
+		** \code
+		** std::vector<Job::IJob::Ptr> jobs;
+		** ... fill the list ...
+		** queueservice.addBatch(jobs.begin(), jobs.end());
+		** \endcode
+		**
+		** \param first Forward iterator to the first job (IJob::Ptr or IJob*)
+		** \param last Forward iterator past the last job
+		** \param priority Their priority execution
+		*/
+		template<class IteratorT>
+		void addBatch(IteratorT first, IteratorT last, Priority priority = Priority::normal);
+
 		/*!
 		** \brief Retrieve information about the activity of the queue manager
 		**
@@ -240,6 +262,47 @@ namespace Job
 
 		//! Get the current number of working threads
 		uint threadCount() const;
+
+		/*!
+		** \brief Get the idle timeout of the additional workers (in milliseconds)
+		**
+		** When all workers are busy for a while and jobs are still waiting, the
+		** queue service starts new workers, up to the maximum number of threads.
+		** These additional workers are retired after being idle for this amount of time.
+		*/
+		uint idleTimeout() const;
+		//! Set the idle timeout of the additional workers (in milliseconds, must be > 0)
+		bool idleTimeout(uint timeout);
+
+		//! Get how many times a worker has been added to the thread pool, since the creation of the service
+		uint64 growCount() const;
+		//! Get how many times an idle worker has been retired, since the creation of the service
+		uint64 shrinkCount() const;
+		//@}
+
+
+		//! \name Scheduling
+		//@{
+		/*!
+		** \brief Get if the work-stealing mode is enabled
+		*/
+		bool workStealing() const;
+
+		/*!
+		** \brief Enable or disable the work-stealing mode
+		**
+		** In work-stealing mode, each worker owns lock-free local queues (one per
+		** priority). Jobs added from a job (from a worker of this queue service) are
+		** pushed into the local queues of this worker and idle workers steal jobs from
+		** the others. Jobs added from any other thread still go through the shared
+		** queues, but are taken by batch. Priorities are honored as in the default mode:
+		** a worker always looks for a job of a higher priority first (local, shared,
+		** then from the others) before running a job of a lower priority.
+		**
+		** This option is only taken into account at the next start of the service.
+		** Disabled by default.
+		*/
+		void workStealing(bool enabled);
 		//@}
 
 
@@ -256,15 +319,35 @@ namespace Job
 		//@}
 
 
+	private:
+		//! Monitoring of an elastic thread pool, shared with its timer
+		class SaturationMonitor;
+
 	private:
 		//! Register a new thread in active duty
-		void registerWorker(void* threadself);
+		void registerWorker(Yuni::Private::QueueService::QueueThread* threadself);
 		//! Unregister a thread no longer in active duty
-		void unregisterWorker(void* threadself);
+		void unregisterWorker(Yuni::Private::QueueService::QueueThread* threadself);
 		//! Wait for all threads to finish
 		bool waitForAllThreads(uint timeout);
-		//! Wake up thread - some work here !
-		void wakeupWorkers();
+		//! Wake up some idle threads - some work here ! (at most `count`)
+		void wakeupWorkers(uint count);
+		//! Wake up some idle threads (the internal mutex must be locked)
+		void wakeupIdleWorkersWL(uint count);
+		//! Update the number of idle workers after a change of the list (the internal mutex must be locked)
+		void idleWorkersChangedWL();
+		//! Get the index of the worker calling this method if it belongs to us, -1 otherwise
+		uint currentWorkerIndex() const;
+		//! Start a new worker if all workers are busy for a while (the internal mutex must be locked)
+		void growIfSaturatedWL();
+		//! Stop the monitoring of the thread pool (the internal mutex must be locked)
+		void releaseMonitorWL();
+		//! Periodic check of the saturation of the thread pool (from the shared timers)
+		static bool CheckSaturation(SaturationMonitor& monitor);
+		//! Retire an idle elastic worker, if possible
+		bool retireWorker(Yuni::Private::QueueService::QueueThread* threadself);
+		//! Wake up all workers (for stopping them)
+		void notifyAllWorkersWL();
 
 	private:
 		//! Flag to know if the service is started [must be protected by the internal mutex]
@@ -287,6 +370,8 @@ namespace Job
 		volatile uint pMaximumThreadCount;
 		//! Array of threads
 		volatile void* pThreads;
+		//! Flag to enable the work-stealing mode [must be protected by the internal mutex]
+		bool pWorkStealing;
 
 		//! Signal, for being notified when all threads have stopped to work
 		Yuni::Thread::Signal pSignalAllThreadHaveStopped;
@@ -299,6 +384,31 @@ namespace Job
 		// may happen - race conditions)
 		// This set is useless (and should not be used in this current form)
 		Yuni::Set<void*>::Unordered  pWorkerSet;
+		//! Workers sleeping, waiting for being waked up [must be protected by the internal mutex]
+		std::vector<Yuni::Private::QueueService::QueueThread*> pIdleWorkers;
+		//! Number of idle workers, for adding jobs without lock when there is none to wake up
+		std::atomic<uint> pIdleWorkerCount;
+		//! Workers waked up but not yet in active duty [must be protected by the internal mutex]
+		std::vector<Yuni::Private::QueueService::QueueThread*> pPendingWorkers;
+		//! Elastic workers retired, which may be restarted later [must be protected by the internal mutex]
+		std::vector<Yuni::Private::QueueService::QueueThread*> pRetiredWorkers;
+
+		// Elasticity
+
+		//! Number of running workers [must be protected by the internal mutex]
+		uint pThreadCount;
+		//! Total number of workers created in the current thread pool [must be protected by the internal mutex]
+		uint pCreatedThreadCount;
+		//! Idle timeout for the additional workers, in ms [must be protected by the internal mutex]
+		uint pIdleTimeout;
+		//! Monitoring of the saturation of the thread pool, if elastic [must be protected by the internal mutex]
+		SaturationMonitor* pMonitor;
+		//! Timestamp (ms) since all workers are busy with jobs still waiting, 0 if not [must be protected by the internal mutex]
+		sint64 pSaturatedSince;
+		//! Number of workers added [must be protected by the internal mutex]
+		uint64 pGrowCount;
+		//! Number of workers retired [must be protected by the internal mutex]
+		uint64 pShrinkCount;
 
 		// Nakama !
 		friend class Yuni::Private::QueueService::QueueThread;
@@ -53,6 +53,15 @@ namespace Job
 	}
 
 
+	template<class IteratorT>
+	void QueueService::addBatch(IteratorT first, IteratorT last, Priority priority)
+	{
+		uint count = pWaitingRoom.addBatch(first, last, priority, currentWorkerIndex());
+		if (count != 0)
+			wakeupWorkers(count);
+	}
+
+
 	inline bool QueueService::idle() const
 	{
 		MutexLocker locker(*this);
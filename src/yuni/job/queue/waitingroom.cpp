@@ -20,12 +20,35 @@ namespace QueueService
 {
 
 
+	enum
+	{
+		//! Maximum number of jobs moved at once from a shared queue to a local queue
+		maxBatchSize = 32,
+	};
+
+
+
+	WaitingRoom::WaitingRoom()
+		: pLocalQueues(nullptr)
+		, pWorkerCount(0)
+		, pWorkersInUse(0)
+	{
+		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
+			pSharedCount[i].store(0, std::memory_order_relaxed);
+	}
+
+
 	WaitingRoom::~WaitingRoom()
 	{
 		// locking all mutex to prevent some race conditions
 		// (with clear() for example)
 		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
 			pMutexes[i].lock();
+
+		// the references hold by the local queues are released with the shared queues
+		releaseLocalQueuesWL();
+		delete[] pLocalQueues;
+
 		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
 			pMutexes[i].unlock();
 	}
@@ -37,12 +60,30 @@ namespace QueueService
 		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
 			pMutexes[i].lock();
 
-		// reset the total number of job _before_ unlocking
-		pJobCount = 0; // may notify listeners that there is nothing to do
+		// The jobs from the local queues are stolen one by one, since their owners
+		// may still be running. The total number of jobs is decreased only by the
+		// number of jobs actually removed for the same reason
+		uint removed = 0;
 
 		// clear
 		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
+		{
+			removed += static_cast<uint>(pJobs[i].size());
 			pJobs[i].clear();
+			pSharedCount[i].store(0, std::memory_order_release);
+		}
+
+		for (uint i = 0; i != pWorkerCount * Yuni::Job::priorityCount; ++i)
+		{
+			while (Yuni::Job::IJob* job = pLocalQueues[i].steal())
+			{
+				job->release();
+				++removed;
+			}
+		}
+
+		// reset the total number of job _before_ unlocking
+		pJobCount -= removed; // may notify listeners that there is nothing to do
 
 		// unlock all
 		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
@@ -63,16 +104,45 @@ namespace QueueService
 		Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::AddedInTheWaitingRoom(*job);
 		// Adding it into the good priority queue
 		pJobs[pindex].push_back(job);
+		pSharedCount[pindex].store(static_cast<uint>(pJobs[pindex].size()), std::memory_order_release);
 
 		// Resetting our internal state
 		++pJobCount;
 	}
 
 
+	void WaitingRoom::add(const Yuni::Job::IJob::Ptr& job, Yuni::Job::Priority priority, uint worker)
+	{
+		if (YUNI_UNLIKELY(not (worker < pWorkerCount)))
+		{
+			add(job, priority);
+			return;
+		}
+
+		uint pindex = static_cast<uint>(priority);
+
+		// Resetting some internal variables of the job
+		Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::AddedInTheWaitingRoom(*job);
+
+		// the counter must be incremented _before_ publishing the job, since it
+		// might be stolen immediately
+		++pJobCount;
+
+		// The local queue now holds a reference to the job
+		Yuni::Job::IJob* rawjob = Yuni::Job::IJob::Ptr::WeakPointer(job);
+		rawjob->addRef();
+		pLocalQueues[worker * Yuni::Job::priorityCount + pindex].push(rawjob);
+	}
+
+
 	bool WaitingRoom::pop(Yuni::Job::IJob::Ptr& out, Yuni::Job::Priority priority)
 	{
 		uint pindex = static_cast<uint>(priority);
 
+		// avoid locking the queue when there is nothing to pick
+		if (0 == pSharedCount[pindex].load(std::memory_order_acquire))
+			return false;
+
 		// We should avoid ThreadingPolicy::MutexLocker since it may not be
 		// the good threading policy for these mutexes
 		Yuni::MutexLocker locker(pMutexes[pindex]);
@@ -83,6 +153,7 @@ namespace QueueService
 			out = pJobs[pindex].front();
 			// Removing it from the list of waiting jobs
 			pJobs[pindex].pop_front();
+			pSharedCount[pindex].store(static_cast<uint>(pJobs[pindex].size()), std::memory_order_release);
 
 			--pJobCount;
 			return true;
@@ -100,6 +171,122 @@ namespace QueueService
 	}
 
 
+	bool WaitingRoom::popShared(Yuni::Job::IJob::Ptr& out, uint pindex, LocalQueue* local)
+	{
+		if (0 == pSharedCount[pindex].load(std::memory_order_acquire))
+			return false;
+
+		Yuni::MutexLocker locker(pMutexes[pindex]);
+		std::deque<Yuni::Job::IJob::Ptr>& list = pJobs[pindex];
+
+		if (list.empty())
+			return false;
+
+		out = list.front();
+		list.pop_front();
+
+		// Taking a fair share of the remaining jobs with the same lock acquisition,
+		// to reduce the congestion on the shared queue. The other workers
+		// may steal them if they are idle
+		uint batch = static_cast<uint>(list.size()) / pWorkerCount;
+		if (batch > maxBatchSize)
+			batch = maxBatchSize;
+		if (batch != 0)
+		{
+			// pushed in reverse order, since the owner pops the most recent job first
+			for (uint i = batch; i-- > 0; )
+			{
+				Yuni::Job::IJob* rawjob = Yuni::Job::IJob::Ptr::WeakPointer(list[i]);
+				rawjob->addRef();
+				local->push(rawjob);
+			}
+			list.erase(list.begin(), list.begin() + batch);
+		}
+
+		pSharedCount[pindex].store(static_cast<uint>(list.size()), std::memory_order_release);
+		--pJobCount;
+		return true;
+	}
+
+
+	Yuni::Job::IJob* WaitingRoom::stealFromOthers(uint pindex, uint worker)
+	{
+		uint count = pWorkersInUse.load(std::memory_order_acquire);
+		for (uint i = 1; i < count; ++i)
+		{
+			uint victim = (worker + i) % count;
+			Yuni::Job::IJob* job = pLocalQueues[victim * Yuni::Job::priorityCount + pindex].steal();
+			if (job)
+				return job;
+		}
+		return nullptr;
+	}
+
+
+	bool WaitingRoom::pop(Yuni::Job::IJob::Ptr& out, uint worker)
+	{
+		if (YUNI_UNLIKELY(not (worker < pWorkerCount)))
+			return pop(out);
+
+		LocalQueue* locals = pLocalQueues + worker * Yuni::Job::priorityCount;
+
+		// from the highest priority to the lowest
+		for (uint pindex = Yuni::Job::priorityCount; pindex-- > 0; )
+		{
+			Yuni::Job::IJob* job = locals[pindex].pop();
+			if (not job)
+			{
+				if (popShared(out, pindex, &locals[pindex]))
+					return true;
+				job = stealFromOthers(pindex, worker);
+			}
+
+			if (job)
+			{
+				// `out` now holds the reference previously owned by the local queue
+				out = job;
+				job->release();
+				--pJobCount;
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+	void WaitingRoom::releaseLocalQueuesWL()
+	{
+		for (uint i = 0; i != pWorkerCount * Yuni::Job::priorityCount; ++i)
+		{
+			uint pindex = i % Yuni::Job::priorityCount;
+			while (Yuni::Job::IJob* job = pLocalQueues[i].steal())
+			{
+				pJobs[pindex].push_back(job);
+				job->release();
+			}
+		}
+
+		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
+			pSharedCount[i].store(static_cast<uint>(pJobs[i].size()), std::memory_order_release);
+	}
+
+
+	void WaitingRoom::attachWorkers(uint count)
+	{
+		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
+			pMutexes[i].lock();
+
+		releaseLocalQueuesWL();
+		delete[] pLocalQueues;
+
+		pLocalQueues = (count != 0) ? new LocalQueue[count * Yuni::Job::priorityCount] : nullptr;
+		pWorkerCount = count;
+		pWorkersInUse.store(count, std::memory_order_release);
+
+		for (uint i = 0; i != Yuni::Job::priorityCount; ++i)
+			pMutexes[i].unlock();
+	}
+
 
 
 
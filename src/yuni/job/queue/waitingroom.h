@@ -12,6 +12,7 @@
 #include "../job.h"
 #include "../../core/slist/slist.h"
 #include "../../core/atomic/bool.h"
+#include "local-queue.h"
 #include <deque>
 
 
@@ -31,6 +32,8 @@ namespace QueueService
 	public:
 		//! \name Constructor & Destructor
 		//@{
+		//! Default constructor
+		WaitingRoom();
 		//! Destructor
 		~WaitingRoom();
 		//@}
@@ -76,6 +79,67 @@ namespace QueueService
 		*/
 		bool pop(Yuni::Job::IJob::Ptr& out);
 
+		/*!
+		** \brief Add a job into the local queue of a worker (work-stealing mode)
+		**
+		** This method must only be called from the worker itself. The job is added
+		** into the shared queues if the worker does not own any local queue.
+		** \param job The job to add
+		** \param priority Its priority
+		** \param worker Index of the worker
+		*/
+		void add(const Yuni::Job::IJob::Ptr& job, Yuni::Job::Priority priority, uint worker);
+
+		/*!
+		** \brief Add several jobs at once into the waiting room
+		**
+		** The shared queue is locked only once for all jobs. If `worker` is a valid
+		** worker index (work-stealing mode), the jobs are added into its local queue
+		** instead (see add()).
+		**
+		** \param first Forward iterator to the first job
+		** \param last Forward iterator past the last job
+		** \param priority Their priority
+		** \param worker Index of the worker adding the jobs, if any
+		** \return The number of jobs added
+		*/
+		template<class IteratorT>
+		uint addBatch(IteratorT first, IteratorT last, Yuni::Job::Priority priority, uint worker);
+
+		/*!
+		** \brief Get the next job to execute for a given worker (work-stealing mode)
+		**
+		** For each priority (from the highest to the lowest), the job is taken
+		** from the local queue of the worker, then from the shared queue, then
+		** stolen from the local queues of the other workers.
+		** This method must only be called from the worker itself.
+		**
+		** \param[out] out Job to execute, if any
+		** \param worker Index of the worker
+		** \return True if a job is actually available, false otherwise
+		*/
+		bool pop(Yuni::Job::IJob::Ptr& out, uint worker);
+
+		/*!
+		** \brief Allocate the local queues for N workers (work-stealing mode)
+		**
+		** All jobs still waiting into the previous local queues are moved back
+		** into the shared queues. 0 disables the local queues.
+		** \warning No worker must be running during this call
+		*/
+		void attachWorkers(uint count);
+
+		//! Get the number of workers owning local queues
+		uint workerCount() const;
+
+		/*!
+		** \brief Set the number of workers actually created (work-stealing mode)
+		**
+		** Only the local queues of these workers will be considered when stealing jobs.
+		** This value must only grow (until the next call to `attachWorkers()`)
+		*/
+		void workersInUse(uint count);
+
 		//! Get the number of jobs waiting to be executed
 		uint size() const;
 
@@ -84,6 +148,14 @@ namespace QueueService
 		//@}
 
 
+	private:
+		//! Get the next job from the shared queue of a given priority (only one lock)
+		bool popShared(Yuni::Job::IJob::Ptr& out, uint pindex, LocalQueue* local);
+		//! Steal a job from the local queues of the other workers
+		Yuni::Job::IJob* stealFromOthers(uint pindex, uint worker);
+		//! Move all jobs from the local queues back to the shared queues (all locks must be held)
+		void releaseLocalQueuesWL();
+
 	private:
 		//! Number of job waiting to be executed
 		Atomic::Int<32>  pJobCount;
@@ -91,6 +163,15 @@ namespace QueueService
 		std::deque<Yuni::Job::IJob::Ptr>  pJobs[Yuni::Job::priorityCount];
 		//! Mutexes, by priority to reduce congestion
 		Mutex pMutexes[Yuni::Job::priorityCount];
+		//! Number of jobs in the shared queues, by priority (hint, readable without lock)
+		std::atomic<uint> pSharedCount[Yuni::Job::priorityCount];
+
+		//! Local queues (work-stealing mode), `priorityCount` per worker
+		LocalQueue* pLocalQueues;
+		//! Number of workers owning local queues
+		uint pWorkerCount;
+		//! Number of workers actually created
+		std::atomic<uint> pWorkersInUse;
 
 	}; // class WaitingRoom
 
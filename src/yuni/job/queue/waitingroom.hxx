@@ -10,6 +10,7 @@
 */
 #pragma once
 #include "waitingroom.h"
+#include <iterator>
 
 
 namespace Yuni
@@ -31,6 +32,66 @@ namespace QueueService
 	}
 
 
+	template<class IteratorT>
+	uint WaitingRoom::addBatch(IteratorT first, IteratorT last, Yuni::Job::Priority priority, uint worker)
+	{
+		uint count = static_cast<uint>(std::distance(first, last));
+		if (0 == count)
+			return 0;
+
+		uint pindex = static_cast<uint>(priority);
+
+		if (worker < pWorkerCount)
+		{
+			// the counter must be incremented _before_ publishing the jobs, since they
+			// might be stolen immediately
+			pJobCount += count;
+
+			LocalQueue& local = pLocalQueues[worker * Yuni::Job::priorityCount + pindex];
+			for (; first != last; ++first)
+			{
+				Yuni::Job::IJob* rawjob = Yuni::Job::IJob::Ptr::WeakPointer(*first);
+				assert(rawjob != nullptr and "invalid job");
+				Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::AddedInTheWaitingRoom(*rawjob);
+				// The local queue now holds a reference to the job
+				rawjob->addRef();
+				local.push(rawjob);
+			}
+		}
+		else
+		{
+			// We should avoid ThreadingPolicy::MutexLocker since it may not be
+			// the good threading policy for these mutexes
+			Yuni::MutexLocker locker(pMutexes[pindex]);
+
+			std::deque<Yuni::Job::IJob::Ptr>& list = pJobs[pindex];
+			for (; first != last; ++first)
+			{
+				Yuni::Job::IJob* rawjob = Yuni::Job::IJob::Ptr::WeakPointer(*first);
+				assert(rawjob != nullptr and "invalid job");
+				Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::AddedInTheWaitingRoom(*rawjob);
+				list.push_back(rawjob);
+			}
+			pSharedCount[pindex].store(static_cast<uint>(list.size()), std::memory_order_release);
+
+			pJobCount += count;
+		}
+		return count;
+	}
+
+
+	inline uint WaitingRoom::workerCount() const
+	{
+		return pWorkerCount;
+	}
+
+
+	inline void WaitingRoom::workersInUse(uint count)
+	{
+		pWorkersInUse.store((count < pWorkerCount) ? count : pWorkerCount, std::memory_order_release);
+	}
+
+
 
 } // namespace QueueService
 } // namespace Private
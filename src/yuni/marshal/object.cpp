@@ -30,7 +30,7 @@ namespace Marshal
 	//! Array of object
 	typedef std::vector<Object>  InternalArray;
 	//! Object mapping
-	typedef Dictionary<String, Object>::Hash  InternalTable;
+	typedef Dictionary<String, Object>::Flat  InternalTable;
 
 
 	namespace // anonymous
@@ -383,8 +383,46 @@ namespace Marshal
 
 
 
+	class Object::ChunkWriter final
+	{
+	public:
+		ChunkWriter(const Bind<bool (Clob&)>& flush, uint chunkSize) :
+			pFlush(flush),
+			pChunkSize(chunkSize),
+			pAborted(false)
+		{}
+
+		//! Flush the output if large enough (false if aborted)
+		template<class StreamT> bool next(StreamT& out)
+		{
+			if (out.size() >= pChunkSize and not pAborted)
+			{
+				if (pFlush(out))
+					out.clear();
+				else
+					pAborted = true;
+			}
+			return not pAborted;
+		}
+
+		//! Get if the export has been aborted
+		bool aborted() const
+		{
+			return pAborted;
+		}
+
+	private:
+		const Bind<bool (Clob&)>& pFlush;
+		const uint pChunkSize;
+		bool pAborted;
+
+	}; // class Object::ChunkWriter
+
+
+
+
 	template<bool PrettyT, class StreamT>
-	inline void Object::valueToJSON(StreamT& out, uint depth) const
+	inline void Object::valueToJSON(StreamT& out, uint depth, ChunkWriter* chunks) const
 	{
 		switch (pType)
 		{
@@ -419,7 +457,7 @@ namespace Marshal
 					else
 					{
 						// complex type, recursive call
-						child.valueToJSON<PrettyT>(out, depth + 1);
+						child.valueToJSON<PrettyT>(out, depth + 1, chunks);
 					}
 				}
 				++it;
@@ -428,6 +466,9 @@ namespace Marshal
 				InternalTable::const_iterator end = table.end();
 				for (; it != end; ++it)
 				{
+					if (chunks and not chunks->next(out))
+						return;
+
 					if (PrettyT)
 					{
 						out.append(",\n", 2);
@@ -448,7 +489,7 @@ namespace Marshal
 					else
 					{
 						// complex type, recursive call
-						child.valueToJSON<PrettyT>(out, depth + 1);
+						child.valueToJSON<PrettyT>(out, depth + 1, chunks);
 					}
 				}
 
@@ -470,6 +511,9 @@ namespace Marshal
 
 				for (uint index = 0; index != array.size(); ++index)
 				{
+					if (chunks and not chunks->next(out))
+						return;
+
 					AppendIndentSpaces(out, depth);
 					const Object& child = array[index];
 					if ((uint) child.pType < (uint) firstComplexDatatype)
@@ -480,7 +524,7 @@ namespace Marshal
 					else
 					{
 						// complex type, recursive call
-						child.valueToJSON<PrettyT>(out, depth + 1);
+						child.valueToJSON<PrettyT>(out, depth + 1, chunks);
 					}
 					out << ",\n";
 				}
@@ -502,9 +546,20 @@ namespace Marshal
 	void Object::toJSON(Clob& out, bool pretty) const
 	{
 		if (pretty)
-			valueToJSON<true> (out, 1);
+			valueToJSON<true> (out, 1, nullptr);
+		else
+			valueToJSON<false>(out, 1, nullptr);
+	}
+
+
+	bool Object::toJSON(Clob& out, const Bind<bool (Clob&)>& flush, uint chunkSize, bool pretty) const
+	{
+		ChunkWriter chunks(flush, chunkSize);
+		if (pretty)
+			valueToJSON<true> (out, 1, &chunks);
 		else
-			valueToJSON<false>(out, 1);
+			valueToJSON<false>(out, 1, &chunks);
+		return not chunks.aborted();
 	}
 
 
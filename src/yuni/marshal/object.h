@@ -11,6 +11,7 @@
 #pragma once
 #include "../yuni.h"
 #include "../core/string.h"
+#include "../core/bind.h"
 
 
 
@@ -155,6 +156,20 @@ namespace Marshal
 		** \param pretty True to export in a pretty format (with spaces and indentation)
 		*/
 		void toJSON(Clob& out, bool pretty = true) const;
+
+		/*!
+		** \brief Dump the content into a JSON structure, by chunks
+		**
+		** The callback is called each time the output reaches `chunkSize` bytes (between
+		** two values), then the output is cleared. The end of the content remains in `out`.
+		**
+		** \param out Stream output
+		** \param flush Callback for each chunk, which returns false to abort the export
+		** \param chunkSize Minimum size of a chunk
+		** \param pretty True to export in a pretty format (with spaces and indentation)
+		** \return False if aborted
+		*/
+		bool toJSON(Clob& out, const Bind<bool (Clob&)>& flush, uint chunkSize, bool pretty = true) const;
 		//@}
 
 
@@ -172,14 +187,17 @@ namespace Marshal
 		template<class T> Object& operator = (const T& value);
 		//! append
 		template<class T> Object& operator += (const T& value);
-		//! read/write the value of a given key
+		//! read/write the value of a given key (valid until the next insertion)
 		Object& operator [] (const String& key);
 		//@}
 
 
 	private:
+		//! Export by chunks
+		class ChunkWriter;
+
 		template<bool PrettyT, class StreamT>
-		void valueToJSON(StreamT& out, uint depth) const;
+		void valueToJSON(StreamT& out, uint depth, ChunkWriter* chunks) const;
 
 	private:
 		//! Internal data type
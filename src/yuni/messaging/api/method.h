@@ -97,7 +97,14 @@ namespace API
 
 		//! \name Options
 		//@{
-		//! Set an option
+		/*!
+		** \brief Set an option
+		**
+		** Options used by the REST transports:
+		**  - `http.method`: the HTTP method (GET, POST, PUT or DELETE, GET by default)
+		**  - `http.path`: the path of the method (`/<schema>/<name>` by default).
+		**    A segment `{name}` captures the value of the parameter `name` (ex: `/items/{id}`)
+		*/
 		Method& option(const AnyString& key, const AnyString& value);
 		const String& option(const AnyString& key) const;
 		//@}
@@ -252,6 +252,21 @@ namespace Messaging
 	}
 
 
+	namespace // anonymous
+	{
+
+		class WorkerStopper final
+		{
+		public:
+			bool operator () (Yuni::Private::Messaging::Worker::Ptr& worker) const
+			{
+				worker->stopAsSoonAsPossible();
+				return true;
+			}
+		};
+
+	} // anonymous
+
 	Net::Error Service::stop()
 	{
 		// Checking if the service is not already running
@@ -286,6 +301,9 @@ namespace Messaging
 			// stopping then destroying all workers
 			if (!(!workers))
 			{
+				// the transports must stop first (otherwise the workers would be killed)
+				WorkerStopper workerStopper;
+				workers->foreachThread(workerStopper);
 				workers->stop();
 				workers = nullptr; // should be destroyed here
 			}
@@ -305,21 +323,6 @@ namespace Messaging
 	}
 
 
-	namespace // anonymous
-	{
-
-		class WorkerStopper final
-		{
-		public:
-			bool operator () (Yuni::Private::Messaging::Worker::Ptr& worker) const
-			{
-				worker->stopAsSoonAsPossible();
-				return true;
-			}
-		};
-
-	} // anonymous
-
 	void Service::gracefulStop()
 	{
 		ThreadingPolicy::MutexLocker locker(*this);
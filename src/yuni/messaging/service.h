@@ -19,6 +19,7 @@
 #include "protocol.h"
 #include "../job/queue/service.h"
 #include "../core/atomic/bool.h"
+#include "statistics.h"
 
 
 
@@ -145,6 +146,11 @@ namespace Messaging
 		transports;
 
 
+		//! Statistics of the methods served by the REST transports (disabled by default)
+		// (declared before the heavy tasks, their threads release their statistics when exiting)
+		Statistics statistics;
+
+
 		//! Heavy task manager (disabled by default)
 		class HeavyTasks final
 		{
@@ -0,0 +1,420 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "statistics.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+
+	/*!
+	** \brief Counters of a thread
+	**
+	** The counters are only written by the thread owning the shard, thus a relaxed
+	** load followed by a relaxed store is enough (no atomic read-modify-write). The
+	** mutex is only taken to add new counters, and when taking a snapshot.
+	*/
+	class Statistics::Shard final
+	{
+	public:
+		//! Histogram written by a single thread
+		struct AtomicHistogram final
+		{
+			std::atomic<uint64> buckets[Histogram::bucketCount];
+			std::atomic<uint64> count;
+			std::atomic<uint64> sum;
+			std::atomic<uint64> min;
+			std::atomic<uint64> max;
+		};
+
+		//! Counters of a method
+		struct Counters final
+		{
+			std::atomic<uint64> requests;
+			std::atomic<uint64> statusClasses[5];
+			AtomicHistogram latency;
+			AtomicHistogram stages[stageCount];
+		};
+
+	public:
+		Shard() :
+			notFound(0)
+		{}
+
+	public:
+		//! Mutex for the list of counters
+		Mutex mutex;
+		//! Counters of each method (by index, allocated on the first request)
+		std::vector<std::unique_ptr<Counters> > methods;
+		//! Number of requests which did not match any method
+		std::atomic<uint64> notFound;
+
+	}; // class Statistics::Shard
+
+
+
+
+	namespace // anonymous
+	{
+
+		//! Names of the stages, see Statistics::Stage
+		static const char* const stageNames[Statistics::stageCount] =
+		{
+			"route", "decode", "invoke", "serialize", "write"
+		};
+
+
+		inline void Increment(std::atomic<uint64>& counter, uint64 value)
+		{
+			// single writer
+			counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+
+
+		void RecordValue(Statistics::Shard::AtomicHistogram& histogram, uint64 value)
+		{
+			Increment(histogram.buckets[Statistics::Histogram::BucketIndex(value)], 1);
+			uint64 count = histogram.count.load(std::memory_order_relaxed);
+			if (count == 0 or value < histogram.min.load(std::memory_order_relaxed))
+				histogram.min.store(value, std::memory_order_relaxed);
+			if (value > histogram.max.load(std::memory_order_relaxed))
+				histogram.max.store(value, std::memory_order_relaxed);
+			Increment(histogram.sum, value);
+			histogram.count.store(count + 1, std::memory_order_relaxed);
+		}
+
+
+		//! Nanoseconds to microseconds
+		inline double Microseconds(uint64 nanoseconds)
+		{
+			return static_cast<double>(nanoseconds) / 1000.;
+		}
+
+
+		//! Durations in microseconds
+		void ExportHistogram(Marshal::Object& out, const Statistics::Histogram& histogram)
+		{
+			out["count"] = (sint64) histogram.count();
+			out["min"] = Microseconds(histogram.min());
+			out["mean"] = histogram.mean() / 1000.;
+			out["p50"] = Microseconds(histogram.percentile(50.));
+			out["p90"] = Microseconds(histogram.percentile(90.));
+			out["p99"] = Microseconds(histogram.percentile(99.));
+			out["p999"] = Microseconds(histogram.percentile(99.9));
+			out["max"] = Microseconds(histogram.max());
+		}
+
+	} // anonymous namespace
+
+
+
+
+	Statistics::Histogram::Histogram()
+	{
+		clear();
+	}
+
+
+	void Statistics::Histogram::clear()
+	{
+		for (uint i = 0; i != bucketCount; ++i)
+			pBuckets[i] = 0;
+		pCount = 0;
+		pSum = 0;
+		pMin = 0;
+		pMax = 0;
+	}
+
+
+	void Statistics::Histogram::record(uint64 value)
+	{
+		++pBuckets[BucketIndex(value)];
+		if (pCount == 0 or value < pMin)
+			pMin = value;
+		if (value > pMax)
+			pMax = value;
+		pSum += value;
+		++pCount;
+	}
+
+
+	void Statistics::Histogram::merge(const Histogram& rhs)
+	{
+		if (rhs.pCount == 0)
+			return;
+		for (uint i = 0; i != bucketCount; ++i)
+			pBuckets[i] += rhs.pBuckets[i];
+		if (pCount == 0 or rhs.pMin < pMin)
+			pMin = rhs.pMin;
+		if (rhs.pMax > pMax)
+			pMax = rhs.pMax;
+		pSum += rhs.pSum;
+		pCount += rhs.pCount;
+	}
+
+
+	uint64 Statistics::Histogram::percentile(double percentile) const
+	{
+		if (pCount == 0)
+			return 0;
+		uint64 rank = (uint64) std::ceil(percentile / 100. * (double) pCount);
+		if (rank == 0)
+			rank = 1;
+		uint64 total = 0;
+		for (uint i = 0; i != bucketCount; ++i)
+		{
+			total += pBuckets[i];
+			if (total >= rank)
+			{
+				uint64 value = BucketUpperBound(i);
+				return (value < pMin) ? pMin : ((value > pMax) ? pMax : value);
+			}
+		}
+		return pMax;
+	}
+
+
+
+
+	Statistics::Method::Method() :
+		requests(0)
+	{
+		for (uint i = 0; i != 5; ++i)
+			statusClasses[i] = 0;
+	}
+
+
+
+
+	Statistics::Snapshot::Snapshot() :
+		elapsed(0.),
+		requests(0),
+		notFound(0)
+	{}
+
+
+	void Statistics::Snapshot::exportTo(Marshal::Object& out) const
+	{
+		out["elapsed"] = elapsed;
+		out["requests"] = (sint64) requests;
+		out["notFound"] = (sint64) notFound;
+
+		Marshal::Object& list = out["methods"];
+		String key;
+		for (uint i = 0; i != (uint) methods.size(); ++i)
+		{
+			const Method& method = methods[i];
+			key.clear();
+			if (not method.schema.empty())
+				key << method.schema << '/';
+			key << method.name;
+
+			Marshal::Object& item = list[key];
+			item["schema"] = method.schema;
+			item["name"] = method.name;
+			item["httpMethod"] = method.httpMethod;
+			item["requests"] = (sint64) method.requests;
+			item["requestsPerSecond"] = (elapsed > 0.) ? (double) method.requests / elapsed : 0.;
+
+			Marshal::Object& status = item["status"];
+			status["1xx"] = (sint64) method.statusClasses[0];
+			status["2xx"] = (sint64) method.statusClasses[1];
+			status["3xx"] = (sint64) method.statusClasses[2];
+			status["4xx"] = (sint64) method.statusClasses[3];
+			status["5xx"] = (sint64) method.statusClasses[4];
+
+			ExportHistogram(item["latency"], method.latency);
+			Marshal::Object& stages = item["stages"];
+			for (uint s = 0; s != stageCount; ++s)
+			{
+				if (method.stages[s].count() != 0)
+					ExportHistogram(stages[stageNames[s]], method.stages[s]);
+			}
+		}
+	}
+
+
+
+
+	Statistics::Statistics() :
+		pSince(Now())
+	{}
+
+
+	Statistics::~Statistics()
+	{
+		// nothing to do
+	}
+
+
+	sint64 Statistics::Now()
+	{
+		return (sint64) std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+
+	uint Statistics::methodIndex(const AnyString& schema, const AnyString& name, const AnyString& httpMethod)
+	{
+		String key;
+		if (not schema.empty())
+			key << schema << '/';
+		key << name;
+
+		MutexLocker locker(pMutex);
+		std::pair<Dictionary<String, uint>::Hash::iterator, bool> inserted
+			= pIndexes.insert(std::make_pair(key, (uint) pMethods.size()));
+		if (inserted.second)
+		{
+			pMethods.push_back(MethodIdentity());
+			pMethods.back().schema = schema;
+			pMethods.back().name = name;
+		}
+		// the HTTP method may have changed with the new protocol
+		pMethods[inserted.first->second].httpMethod = httpMethod;
+		return inserted.first->second;
+	}
+
+
+	Statistics::Shard* Statistics::acquireShard()
+	{
+		MutexLocker locker(pMutex);
+		if (not pFreeShards.empty())
+		{
+			Shard* shard = pFreeShards.back();
+			pFreeShards.pop_back();
+			return shard;
+		}
+		pShards.push_back(std::unique_ptr<Shard>(new Shard()));
+		return pShards.back().get();
+	}
+
+
+	void Statistics::releaseShard(Shard* shard)
+	{
+		if (shard)
+		{
+			// the counters are kept, for the next thread
+			MutexLocker locker(pMutex);
+			pFreeShards.push_back(shard);
+		}
+	}
+
+
+	void Statistics::Record(Shard& shard, uint method, const Sample& sample, uint httpStatus)
+	{
+		if (not sample.active())
+			return;
+
+		if (YUNI_UNLIKELY(method >= (uint) shard.methods.size() or not shard.methods[method]))
+		{
+			MutexLocker locker(shard.mutex);
+			if (method >= (uint) shard.methods.size())
+				shard.methods.resize(method + 1);
+			shard.methods[method].reset(new Shard::Counters());
+		}
+		Shard::Counters& counters = *(shard.methods[method]);
+
+		Increment(counters.requests, 1);
+		uint statusClass = httpStatus / 100;
+		Increment(counters.statusClasses[(statusClass >= 1 and statusClass <= 5) ? statusClass - 1 : 4], 1);
+
+		RecordValue(counters.latency, (uint64) (sample.pLast - sample.pStart));
+		for (uint i = 0; i != stageCount; ++i)
+		{
+			if (0 != (sample.pStages & (1u << i)))
+				RecordValue(counters.stages[i], sample.pDurations[i]);
+		}
+	}
+
+
+	void Statistics::RecordNotFound(Shard& shard)
+	{
+		Increment(shard.notFound, 1);
+	}
+
+
+	void Statistics::snapshot(Snapshot& out) const
+	{
+		auto merge = [](Histogram& histogram, const Shard::AtomicHistogram& from)
+		{
+			// the number of values is the sum of the buckets, the thread may record meanwhile
+			uint64 count = 0;
+			for (uint i = 0; i != Histogram::bucketCount; ++i)
+			{
+				uint64 n = from.buckets[i].load(std::memory_order_relaxed);
+				histogram.pBuckets[i] += n;
+				count += n;
+			}
+			if (count == 0)
+				return;
+			uint64 min = from.min.load(std::memory_order_relaxed);
+			uint64 max = from.max.load(std::memory_order_relaxed);
+			if (histogram.pCount == 0 or min < histogram.pMin)
+				histogram.pMin = min;
+			if (max > histogram.pMax)
+				histogram.pMax = max;
+			histogram.pSum += from.sum.load(std::memory_order_relaxed);
+			histogram.pCount += count;
+		};
+
+		MutexLocker locker(pMutex);
+		out.elapsed = (double) (Now() - pSince) / 1e9;
+		out.requests = 0;
+		out.notFound = 0;
+		out.methods.clear();
+		out.methods.resize(pMethods.size());
+		for (uint i = 0; i != (uint) pMethods.size(); ++i)
+		{
+			out.methods[i].schema = pMethods[i].schema;
+			out.methods[i].name = pMethods[i].name;
+			out.methods[i].httpMethod = pMethods[i].httpMethod;
+		}
+
+		for (uint s = 0; s != (uint) pShards.size(); ++s)
+		{
+			Shard& shard = *(pShards[s]);
+			MutexLocker shardLocker(shard.mutex);
+			out.notFound += shard.notFound.load(std::memory_order_relaxed);
+
+			uint count = (uint) shard.methods.size();
+			if (count > (uint) out.methods.size())
+				count = (uint) out.methods.size();
+			for (uint i = 0; i != count; ++i)
+			{
+				const Shard::Counters* counters = shard.methods[i].get();
+				if (not counters)
+					continue;
+				Method& method = out.methods[i];
+				method.requests += counters->requests.load(std::memory_order_relaxed);
+				for (uint c = 0; c != 5; ++c)
+					method.statusClasses[c] += counters->statusClasses[c].load(std::memory_order_relaxed);
+				merge(method.latency, counters->latency);
+				for (uint st = 0; st != stageCount; ++st)
+					merge(method.stages[st], counters->stages[st]);
+			}
+		}
+
+		for (uint i = 0; i != (uint) out.methods.size(); ++i)
+			out.requests += out.methods[i].requests;
+	}
+
+
+
+
+
+} // namespace Messaging
+} // namespace Yuni
@@ -0,0 +1,313 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#ifndef __YUNI_MESSAGING_STATISTICS_H__
+# define __YUNI_MESSAGING_STATISTICS_H__
+
+# include "../yuni.h"
+# include "../core/string.h"
+# include "../core/noncopyable.h"
+# include "../core/dictionary.h"
+# include "../core/atomic/bool.h"
+# include "../thread/mutex.h"
+# include "../marshal/object.h"
+# include <vector>
+# include <memory>
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+
+	/*!
+	** \brief Statistics of the methods served by the REST transports
+	**
+	** For each method: the number of requests, by class of HTTP status code, and
+	** the latency histograms of the whole request and of each stage.
+	**
+	** \code
+	** Messaging::Service service;
+	** service.statistics.enabled(true);
+	** ...
+	** Messaging::Statistics::Snapshot snapshot;
+	** service.statistics.snapshot(snapshot);
+	** \endcode
+	**
+	** The same data are available from the built-in method `GET /_stats` (JSON,
+	** durations in microseconds), unless overridden by the protocol.
+	**
+	** Each thread serving requests records into its own shard (owned by this
+	** object and reused by another thread once the thread is gone), without any
+	** lock. The shards are merged when taking a snapshot.
+	*/
+	class YUNI_DECL Statistics final : private NonCopyable<Statistics>
+	{
+	public:
+		//! Stages of a request
+		enum class Stage
+		{
+			//! Finding the method (routing)
+			route,
+			//! Reading the parameters from the url (query and path)
+			decode,
+			//! The method itself
+			invoke,
+			//! Serializing the response (JSON) and its headers
+			serialize,
+			//! Sending the response (`REST::Server` only, the event server sends the responses by batches)
+			write,
+		};
+		enum
+		{
+			//! Number of stages
+			stageCount = 5,
+		};
+
+
+		/*!
+		** \brief Latency histogram (nanoseconds)
+		**
+		** The buckets are log-linear like a HDR histogram: 8 sub-buckets per power of 2,
+		** thus a relative error of at most 12.5%. The values are recorded up to 2^40ns (~18min).
+		*/
+		class YUNI_DECL Histogram final
+		{
+		public:
+			enum
+			{
+				//! Number of sub-buckets per power of 2
+				subBucketCount = 8,
+				//! Number of buckets
+				bucketCount = (40 - 2) * subBucketCount,
+			};
+
+			//! Get the index of the bucket of a value
+			static uint BucketIndex(uint64 value);
+			//! Get the highest value of a bucket
+			static uint64 BucketUpperBound(uint index);
+
+		public:
+			//! Default constructor
+			Histogram();
+
+			//! Clear all values
+			void clear();
+			//! Add a value
+			void record(uint64 value);
+			//! Add all the values of another histogram
+			void merge(const Histogram& rhs);
+
+			//! Get the number of values
+			uint64 count() const;
+			//! Get the lowest value (0 if empty)
+			uint64 min() const;
+			//! Get the highest value (0 if empty)
+			uint64 max() const;
+			//! Get the mean
+			double mean() const;
+			/*!
+			** \brief Get the value at a given percentile
+			**
+			** \param percentile A percentile (0..100)
+			** \return The highest value of the corresponding bucket (0 if empty)
+			*/
+			uint64 percentile(double percentile) const;
+
+			//! Get the number of values of a bucket
+			uint64 bucket(uint index) const;
+
+		private:
+			//! Number of values per bucket
+			uint64 pBuckets[bucketCount];
+			//! Number of values
+			uint64 pCount;
+			//! Sum of all values
+			uint64 pSum;
+			//! Lowest value
+			uint64 pMin;
+			//! Highest value
+			uint64 pMax;
+			// Friend
+			friend class Statistics;
+
+		}; // class Histogram
+
+
+		//! Statistics of a method
+		class YUNI_DECL Method final
+		{
+		public:
+			//! Default constructor
+			Method();
+
+		public:
+			//! Schema of the method
+			String schema;
+			//! Name of the method
+			String name;
+			//! HTTP method
+			String httpMethod;
+			//! Number of requests
+			uint64 requests;
+			//! Number of requests by class of status code (1xx, 2xx, 3xx, 4xx, 5xx)
+			uint64 statusClasses[5];
+			//! Latency of the whole requests
+			Histogram latency;
+			//! Latency of each stage (see Stage)
+			Histogram stages[stageCount];
+
+		}; // class Method
+
+
+		//! Statistics of all methods at a given time
+		class YUNI_DECL Snapshot final
+		{
+		public:
+			//! Default constructor
+			Snapshot();
+
+			//! Export to a marshal object (durations in microseconds)
+			void exportTo(Marshal::Object& out) const;
+
+		public:
+			//! Time elapsed since the creation of the statistics (seconds)
+			double elapsed;
+			//! Number of requests of all methods
+			uint64 requests;
+			//! Number of requests which did not match any method
+			uint64 notFound;
+			//! All methods (even without any request)
+			std::vector<Method> methods;
+
+		}; // class Snapshot
+
+
+		/*!
+		** \brief Timing of a request (transports)
+		**
+		** Nothing is measured when the statistics are disabled.
+		*/
+		class YUNI_DECL Sample final
+		{
+		public:
+			//! Default constructor
+			Sample();
+
+			//! Start the timing of a request
+			void start(const Statistics& statistics);
+			//! End of a stage (accumulated, since the end of the previous stage)
+			void stage(Stage stage);
+			//! Get if the request is being measured
+			bool active() const;
+
+		private:
+			//! Time of the beginning of the request
+			sint64 pStart;
+			//! Time of the end of the last stage
+			sint64 pLast;
+			//! Duration of each stage
+			uint64 pDurations[stageCount];
+			//! Stages measured (bitmask)
+			uint pStages;
+			// Friend
+			friend class Statistics;
+
+		}; // class Sample
+
+		//! Counters of a thread
+		class Shard;
+
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Default constructor
+		Statistics();
+		//! Destructor
+		~Statistics();
+		//@}
+
+		//! \name Settings
+		//@{
+		//! Get if the statistics are enabled
+		bool enabled() const;
+		//! Enable / disable the statistics (disabled by default)
+		void enabled(bool on);
+		//@}
+
+		//! \name Data
+		//@{
+		//! Take a snapshot of the statistics of all methods
+		void snapshot(Snapshot& out) const;
+		//@}
+
+		//! \name Recording (transports)
+		//@{
+		/*!
+		** \brief Get the index of a method (registered if not already done)
+		**
+		** A method is identified by its schema and its name, thus its statistics
+		** remain the same when installing a new protocol.
+		*/
+		uint methodIndex(const AnyString& schema, const AnyString& name, const AnyString& httpMethod);
+
+		//! Get a shard for the calling thread
+		Shard* acquireShard();
+		//! Release a shard (the calling thread will no longer use it)
+		void releaseShard(Shard* shard);
+
+		//! Record a request (only from the thread owning the shard)
+		static void Record(Shard& shard, uint method, const Sample& sample, uint httpStatus);
+		//! Record a request which did not match any method
+		static void RecordNotFound(Shard& shard);
+
+		//! Get the current time of a monotonic clock (nanoseconds)
+		static sint64 Now();
+		//@}
+
+
+	private:
+		//! Identity of a method
+		struct MethodIdentity final
+		{
+			String schema;
+			String name;
+			String httpMethod;
+		};
+
+	private:
+		//! Flag to enable the statistics
+		Atomic::Bool pEnabled;
+		//! Creation time
+		const sint64 pSince;
+		//! Mutex for the methods and the shards
+		mutable Mutex pMutex;
+		//! All methods
+		std::vector<MethodIdentity> pMethods;
+		//! Index of each method ('schema/name')
+		Dictionary<String, uint>::Hash pIndexes;
+		//! All shards
+		std::vector<std::unique_ptr<Shard> > pShards;
+		//! Shards not used by any thread
+		std::vector<Shard*> pFreeShards;
+
+	}; // class Statistics
+
+
+
+
+
+} // namespace Messaging
+} // namespace Yuni
+
+# include "statistics.hxx"
+
+#endif // __YUNI_MESSAGING_STATISTICS_H__
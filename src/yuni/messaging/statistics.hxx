@@ -0,0 +1,143 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "statistics.h"
+#ifdef YUNI_OS_MSVC
+#	include <intrin.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+
+	inline uint Statistics::Histogram::BucketIndex(uint64 value)
+	{
+		if (value < subBucketCount)
+			return (uint) value;
+		if (YUNI_UNLIKELY(value >= ((uint64) 1 << 40)))
+			return bucketCount - 1;
+		// position of the highest bit (>= 3), then the 3 next bits
+		# ifdef YUNI_OS_MSVC
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		uint exponent = static_cast<uint>(index);
+		# else
+		uint exponent = 63u - static_cast<uint>(__builtin_clzll(value));
+		# endif
+		return (exponent - 2) * subBucketCount + (uint) ((value >> (exponent - 3)) & (subBucketCount - 1));
+	}
+
+
+	inline uint64 Statistics::Histogram::BucketUpperBound(uint index)
+	{
+		if (index < subBucketCount)
+			return index;
+		uint exponent = index / subBucketCount + 2;
+		uint64 low = (uint64) (subBucketCount + index % subBucketCount) << (exponent - 3);
+		return low + ((uint64) 1 << (exponent - 3)) - 1;
+	}
+
+
+	inline uint64 Statistics::Histogram::count() const
+	{
+		return pCount;
+	}
+
+
+	inline uint64 Statistics::Histogram::min() const
+	{
+		return pMin;
+	}
+
+
+	inline uint64 Statistics::Histogram::max() const
+	{
+		return pMax;
+	}
+
+
+	inline double Statistics::Histogram::mean() const
+	{
+		return (pCount != 0) ? (double) pSum / (double) pCount : 0.;
+	}
+
+
+	inline uint64 Statistics::Histogram::bucket(uint index) const
+	{
+		assert(index < bucketCount);
+		return pBuckets[index];
+	}
+
+
+
+
+	inline Statistics::Sample::Sample() :
+		pStart(0),
+		pLast(0),
+		pStages(0)
+	{}
+
+
+	inline bool Statistics::Sample::active() const
+	{
+		return pStart != 0;
+	}
+
+
+	inline void Statistics::Sample::start(const Statistics& statistics)
+	{
+		if (statistics.enabled())
+		{
+			pStart = Now();
+			pLast = pStart;
+			pStages = 0;
+			for (uint i = 0; i != stageCount; ++i)
+				pDurations[i] = 0;
+		}
+		else
+			pStart = 0;
+	}
+
+
+	inline void Statistics::Sample::stage(Stage stage)
+	{
+		if (pStart != 0)
+		{
+			sint64 now = Now();
+			pDurations[(uint) stage] += (uint64) (now - pLast);
+			pStages |= 1u << (uint) stage;
+			pLast = now;
+		}
+	}
+
+
+
+
+	inline bool Statistics::enabled() const
+	{
+		return (0 != pEnabled);
+	}
+
+
+	inline void Statistics::enabled(bool on)
+	{
+		pEnabled = (on ? 1 : 0);
+	}
+
+
+
+
+
+} // namespace Messaging
+} // namespace Yuni
@@ -0,0 +1,550 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "decision-tree.inc.hpp"
+#include "../../../io/filename-manipulation.h"
+#include <memory>
+#include <cstring>
+#include <cassert>
+
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+namespace Transport
+{
+namespace REST
+{
+
+	namespace // anonymous
+	{
+
+		//! A node of a radix tree, while building it
+		class BuildNode final
+		{
+		public:
+			BuildNode() :
+				handler((uint) -1)
+			{}
+
+			//! Insert a static part of a route (returns the node at the end of it)
+			BuildNode* insert(AnyString text);
+
+		public:
+			//! Label
+			String label;
+			//! Children (static)
+			std::vector<std::unique_ptr<BuildNode> > children;
+			//! Child capturing a segment
+			std::unique_ptr<BuildNode> capture;
+			//! Index of the method handler (-1 if none)
+			uint handler;
+
+		}; // class BuildNode
+
+
+		BuildNode* BuildNode::insert(AnyString text)
+		{
+			BuildNode* node = this;
+			while (not text.empty())
+			{
+				BuildNode* next = nullptr;
+				for (uint i = 0; i != (uint) node->children.size(); ++i)
+				{
+					if (node->children[i]->label[0] == text[0])
+					{
+						next = node->children[i].get();
+						break;
+					}
+				}
+				if (not next)
+				{
+					node->children.emplace_back(new BuildNode());
+					node->children.back()->label = text;
+					return node->children.back().get();
+				}
+
+				// common prefix
+				uint common = 1;
+				while (common < next->label.size() and common < text.size() and next->label[common] == text[common])
+					++common;
+
+				if (common < next->label.size())
+				{
+					// splitting the node
+					std::unique_ptr<BuildNode> tail(new BuildNode());
+					tail->label.assign(next->label.c_str() + common, next->label.size() - common);
+					tail->children.swap(next->children);
+					tail->capture.swap(next->capture);
+					tail->handler = next->handler;
+					next->label.truncate(common);
+					next->handler = (uint) -1;
+					next->children.emplace_back(std::move(tail));
+				}
+				node = next;
+				text.adapt(text.c_str() + common, text.size() - common);
+			}
+			return node;
+		}
+
+
+		/*!
+		** \brief Insert a route into a radix tree
+		**
+		** \param[out] captures Names of the path parameters
+		** \return False if the route is invalid
+		*/
+		bool InsertRoute(BuildNode& root, const String& route, uint handler, std::vector<String>& captures)
+		{
+			captures.clear();
+			BuildNode* node = &root;
+			uint offset = 0;
+			while (offset < route.size())
+			{
+				uint brace = route.find('{', offset);
+				if (brace > route.size())
+					brace = route.size();
+				if (brace != offset)
+					node = node->insert(AnyString(route.c_str() + offset, brace - offset));
+				if (brace == route.size())
+					break;
+
+				// a capture is a whole segment
+				uint end = route.find('}', brace);
+				if (end >= route.size() or end == brace + 1 or brace == 0 or route[brace - 1] != '/'
+					or (end + 1 < route.size() and route[end + 1] != '/'))
+					return false;
+				if (captures.size() == DecisionTree::maxCaptures)
+					return false;
+				captures.push_back(AnyString(route.c_str() + brace + 1, end - brace - 1));
+				if (not node->capture)
+					node->capture.reset(new BuildNode());
+				node = node->capture.get();
+				offset = end + 1;
+			}
+			node->handler = handler;
+			return true;
+		}
+
+
+		//! Built-in method `GET /_stats`: statistics of the service
+		void StatisticsMethod(Messaging::Context& context, Marshal::Object& response)
+		{
+			const Statistics& statistics = context.service.statistics;
+			if (not statistics.enabled())
+			{
+				context.httpStatus = 404;
+				return;
+			}
+			Statistics::Snapshot snapshot;
+			statistics.snapshot(snapshot);
+			snapshot.exportTo(response);
+		}
+
+
+	} // anonymous namespace
+
+
+
+
+	DecisionTree::DecisionTree(const Protocol& protocol, Statistics& statistics) :
+		handlerCount(0)
+	{
+		// all routes, by HTTP method (index of the method handler)
+		Dictionary<String, uint>::Hash routes[rqmdInvalid];
+		String url;
+		String tmp;
+		String httpMethod;
+
+		// walking through all schemas
+		const Schema::Hash& allSchemas = protocol.allSchemas();
+		Schema::Hash::const_iterator end = allSchemas.end();
+		for (Schema::Hash::const_iterator i = allSchemas.begin(); i != end; ++i)
+		{
+			// relative path access
+			const String& schemaName = i->first;
+			// alias to the current schema
+			const Schema& schema = i->second;
+
+			API::Method::Hash::const_iterator jend = schema.methods.all().end();
+			for (API::Method::Hash::const_iterator j = schema.methods.all().begin(); j != jend; ++j)
+			{
+				const API::Method& method = j->second;
+
+				// The method will be ignored is no callback has been provided
+				if (not method.invoke())
+					continue;
+
+				httpMethod = method.option("http.method");
+				// using const char* to avoid assert from Yuni::String
+				RequestMethod rqmd = StringToRequestMethod(httpMethod.c_str());
+				if (rqmd == rqmdInvalid)
+					rqmd = rqmdGET;
+
+				// the full url
+				tmp = method.option("http.path");
+				if (tmp.empty())
+					tmp.clear() << '/' << schemaName << '/' << method.name();
+				IO::Normalize(url, tmp);
+
+				// alias to the corresponding method handler
+				std::pair<Dictionary<String, uint>::Hash::iterator, bool> inserted
+					= routes[rqmd].insert(std::make_pair(url, (uint) pHandlers.size()));
+				if (inserted.second)
+				{
+					pHandlers.push_back(MethodHandler());
+					pHandlers.back().index = handlerCount++;
+				}
+				MethodHandler& mhandler = pHandlers[inserted.first->second];
+
+				mhandler.schema = schemaName;
+				mhandler.name = method.name();
+				mhandler.httpMethod = httpMethod;
+				mhandler.invoke = method.invoke();
+				mhandler.statistics = statistics.methodIndex(schemaName, method.name(),
+					(httpMethod.empty() ? AnyString("GET") : AnyString(httpMethod)));
+
+				// copying parameters
+				mhandler.parameters.clear();
+				const API::Method::Parameter::Hash& parameters = method.params();
+				if (not parameters.empty())
+				{
+					API::Method::Parameter::Hash::const_iterator pend = parameters.end();
+					API::Method::Parameter::Hash::const_iterator pi = parameters.begin();
+					for (; pi != pend; ++pi)
+					{
+						const API::Method::Parameter& param = pi->second;
+						if (param.hasDefault)
+						{
+							mhandler.parameters[param.name] = param.defvalue;
+						}
+						else
+						{
+							API::Method::Parameter::Hash::const_iterator defit = schema.defaults.params().find(param.name);
+							if (defit != schema.defaults.params().end())
+								mhandler.parameters[param.name] = defit->second.defvalue;
+							else
+								mhandler.parameters[param.name].clear();
+						}
+					}
+				}
+			}
+		}
+
+		// built-in methods, unless already defined by the protocol
+		if (routes[rqmdGET].insert(std::make_pair(String("/_stats"), (uint) pHandlers.size())).second)
+		{
+			pHandlers.push_back(MethodHandler());
+			MethodHandler& mhandler = pHandlers.back();
+			mhandler.index = handlerCount++;
+			mhandler.name = "_stats";
+			mhandler.httpMethod = "GET";
+			mhandler.invoke = &StatisticsMethod;
+			mhandler.statistics = statistics.methodIndex(mhandler.schema, mhandler.name, mhandler.httpMethod);
+		}
+
+		// compiling the radix trees
+		for (uint rqmd = 0; rqmd != (uint) rqmdInvalid; ++rqmd)
+		{
+			BuildNode root;
+			Dictionary<String, uint>::Hash::const_iterator rend = routes[rqmd].end();
+			for (Dictionary<String, uint>::Hash::const_iterator r = routes[rqmd].begin(); r != rend; ++r)
+			{
+				MethodHandler& mhandler = pHandlers[r->second];
+				if (not InsertRoute(root, r->first, r->second, mhandler.captures))
+				{
+					mhandler.invoke = nullptr; // invalid route, ignored
+					continue;
+				}
+				// the path parameters are parameters of the method as well
+				for (uint c = 0; c != (uint) mhandler.captures.size(); ++c)
+					mhandler.parameters[mhandler.captures[c]];
+			}
+
+			// flattening the tree (breadth-first, the children of a node are contiguous)
+			Router& router = pRouters[rqmd];
+			std::vector<const BuildNode*> queue;
+			queue.push_back(&root);
+			router.nodes.resize(1);
+			for (uint n = 0; n != (uint) queue.size(); ++n)
+			{
+				const BuildNode& bnode = *queue[n];
+				Node& node = router.nodes[n];
+				node.labelOffset = router.labels.size();
+				node.labelSize = bnode.label.size();
+				router.labels += bnode.label;
+				node.handler = bnode.handler;
+
+				node.firstChild = (uint) queue.size();
+				node.childCount = (uint) bnode.children.size();
+				for (uint c = 0; c != node.childCount; ++c)
+					queue.push_back(bnode.children[c].get());
+				node.capture = (uint) -1;
+				if (bnode.capture)
+				{
+					node.capture = (uint) queue.size();
+					queue.push_back(bnode.capture.get());
+				}
+				router.nodes.resize(queue.size());
+			}
+		}
+	}
+
+
+	bool DecisionTree::find(Match& match, RequestMethod rqmd, const AnyString& path) const
+	{
+		assert(rqmd < rqmdInvalid);
+		match.handler = nullptr;
+		match.count = 0;
+		return this->match(match, pRouters[rqmd], 0, path.c_str(), path.size());
+	}
+
+
+	bool DecisionTree::match(Match& match, const Router& router, uint index, const char* path, uint size) const
+	{
+		// the label of the node has already been matched
+		const Node& node = router.nodes[index];
+		if (size == 0)
+		{
+			if (node.handler == (uint) -1 or not pHandlers[node.handler].invoke)
+				return false;
+			match.handler = &(pHandlers[node.handler]);
+			return true;
+		}
+
+		// static segments first
+		const char* const labels = router.labels.c_str();
+		for (uint i = node.firstChild; i != node.firstChild + node.childCount; ++i)
+		{
+			const Node& child = router.nodes[i];
+			if (labels[child.labelOffset] == *path)
+			{
+				if (child.labelSize <= size and 0 == ::memcmp(labels + child.labelOffset, path, child.labelSize))
+				{
+					if (this->match(match, router, i, path + child.labelSize, size - child.labelSize))
+						return true;
+				}
+				break; // a single child per first character
+			}
+		}
+
+		// capturing the segment
+		if (node.capture != (uint) -1 and match.count != maxCaptures)
+		{
+			uint length = 0;
+			while (length != size and path[length] != '/')
+				++length;
+			if (length != 0)
+			{
+				match.values[match.count++].adapt(path, length);
+				if (this->match(match, router, node.capture, path + length, size - length))
+					return true;
+				--match.count;
+			}
+		}
+		return false;
+	}
+
+
+
+
+	void WorkerContext::prepare(const DecisionTree::Ptr& decisionTree, const DecisionTree::MethodHandler& mhandler)
+	{
+		// in case the previous request has been interrupted (exception)
+		release();
+
+		if (pDecisionTree != decisionTree)
+		{
+			// new protocol
+			pDecisionTree = decisionTree;
+			pParameters.clear();
+			pParameters.resize(decisionTree->handlerCount);
+		}
+
+		// resetting the parameters to their default values (the strings keep their capacity)
+		KeyValueStore& params = pParameters[mhandler.index];
+		if (params.size() == mhandler.parameters.size())
+		{
+			KeyValueStore::const_iterator end = mhandler.parameters.end();
+			for (KeyValueStore::const_iterator i = mhandler.parameters.begin(); i != end; ++i)
+			{
+				KeyValueStore::iterator it = params.find(i->first);
+				if (YUNI_UNLIKELY(it == params.end()))
+				{
+					params = mhandler.parameters;
+					break;
+				}
+				it->second = i->second;
+			}
+		}
+		else
+			params = mhandler.parameters; // first use (or modified by the method)
+
+		context.params.swap(params);
+		pCurrent = &params;
+
+		context.clear();
+		context.userdata = nullptr;
+	}
+
+
+	WorkerContext::~WorkerContext()
+	{
+		if (pShard)
+			context.service.statistics.releaseShard(pShard);
+	}
+
+
+	bool WorkerContext::invoke(const DecisionTree::Ptr& decisionTree, const DecisionTree::Match& match,
+		const AnyString& query, uint remotePort, Marshal::Object& response, Statistics::Sample& sample)
+	{
+		const DecisionTree::MethodHandler& mhandler = *match.handler;
+		// default parameters
+		prepare(decisionTree, mhandler);
+
+		// reading parameters from the url query
+		// ignoring unknown parameters
+		if (not mhandler.parameters.empty() and not query.empty())
+		{
+			if (not DecodeURLQuery(context.params, query, key))
+			{
+				sample.stage(Statistics::Stage::decode);
+				return false;
+			}
+		}
+
+		// path parameters (the strings keep their capacity)
+		for (uint i = 0; i != match.count; ++i)
+		{
+			KeyValueStore::iterator it = context.params.find(mhandler.captures[i]);
+			if (it != context.params.end())
+				it->second = match.values[i];
+		}
+		sample.stage(Statistics::Stage::decode);
+
+		// resetting context
+		context.method = mhandler.name;
+		context.schema = mhandler.schema;
+		context.httpStatus = 200;
+		context.remotePort = remotePort;
+
+		// Invoke user callback
+		mhandler.invoke(context, response);
+		sample.stage(Statistics::Stage::invoke);
+		return true;
+	}
+
+
+	void WorkerContext::record(const DecisionTree::MethodHandler& mhandler, const Statistics::Sample& sample, uint httpStatus)
+	{
+		if (sample.active())
+		{
+			if (YUNI_UNLIKELY(not pShard))
+				pShard = context.service.statistics.acquireShard();
+			Statistics::Record(*pShard, mhandler.statistics, sample, httpStatus);
+		}
+	}
+
+
+	void WorkerContext::recordNotFound(const Statistics::Sample& sample)
+	{
+		if (sample.active())
+		{
+			if (YUNI_UNLIKELY(not pShard))
+				pShard = context.service.statistics.acquireShard();
+			Statistics::RecordNotFound(*pShard);
+		}
+	}
+
+
+	WorkerContext& LocalWorkerContext(Service& service)
+	{
+		// destroyed with the thread
+		static thread_local std::unique_ptr<WorkerContext> local;
+		if (YUNI_UNLIKELY(not local or &(local->context.service) != &service))
+			local.reset(new WorkerContext(service));
+		return *local;
+	}
+
+
+
+
+	bool DecodeURLQuery(KeyValueStore& params, const AnyString& query, String& key)
+	{
+		// note: the fragment is never provided here, so we don't have
+		// to check it
+
+		// Some tests are already done before calling this method
+		assert(not query.empty());
+
+		uint offset = 0;
+		uint start = 0;
+		AnyString value;
+		do
+		{
+			offset = query.find_first_of("=&", offset);
+			if (offset >= query.size())
+			{
+				// ignoring fields with empty value (using default)
+				break;
+			}
+			if (query[offset] == '=')
+			{
+				key.assign(query, offset - start, start);
+				if (key.empty()) // malformed url. aborting
+					return false;
+
+				++offset;
+
+				// FIXME !!!! &amp; are not properly handled !!!!!!!!!!!!
+				uint ampersand = offset;
+				ampersand = query.find('&', ampersand);
+				if (ampersand >= query.size())
+				{
+					value.adapt(query, query.size() - offset, offset);
+					ampersand = query.size();
+				}
+				else
+					value.adapt(query, ampersand - offset, offset);
+
+				if (not value.empty())
+				{
+					KeyValueStore::iterator i = params.find(key);
+					if (i != params.end())
+					{
+						// the item has been found !
+						i->second = value;
+					}
+				}
+
+				offset = ampersand;
+			}
+			else
+			{
+				// ignoring fields with empty value (using default)
+			}
+
+			// updating offsets
+			start = ++offset;
+		}
+		while (true);
+		return true;
+	}
+
+
+
+
+
+} // namespace REST
+} // namespace Transport
+} // namespace Messaging
+} // namespace Yuni
@@ -0,0 +1,384 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../transport.h"
+#include "../../service.h"
+#include "../../threadcontext.h"
+#include "../../../marshal/object.h"
+#include "../../../thread/mutex.h"
+#include <atomic>
+#include <vector>
+
+
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+namespace Transport
+{
+namespace REST
+{
+
+	enum RequestMethod
+	{
+		rqmdGET = 0,
+		rqmdPOST,
+		rqmdPUT,
+		rqmdDELETE,
+		rqmdInvalid,
+		rqmdMax
+	};
+
+	template<class StringT>
+	static RequestMethod StringToRequestMethod(const StringT& text);
+
+
+
+	/*!
+	** \brief All the methods of a protocol, by HTTP method and by url
+	**
+	** The urls are compiled into a radix tree for each HTTP method, thus a lookup
+	** only walks the path once (no hash of the whole url). A segment of a route
+	** like `{id}` (ex: `/schema/items/{id}`) captures the corresponding segment of the
+	** path, given to the method as the parameter `id`. The static segments have the
+	** priority over the captures.
+	**
+	** \internal Shared by the REST transports (immutable once built)
+	*/
+	class DecisionTree final
+	{
+	public:
+		//! The most suitable smart ptr for the class
+		typedef SmartPtr<DecisionTree> Ptr;
+
+		enum
+		{
+			//! Maximum number of path parameters of a route
+			maxCaptures = 16,
+		};
+
+		class MethodHandler final
+		{
+		public:
+			MethodHandler() :
+				index((uint) -1),
+				statistics((uint) -1)
+			{}
+
+		public:
+			//! Index of the method handler within the decision tree
+			uint index;
+			//! Index of the method for the statistics of the service
+			uint statistics;
+			//! Name of the method invoked
+			String name;
+			//! Full schema name
+			String schema;
+			//! Method request (GET, POST, DELETE, PUT)
+			String httpMethod;
+			//! All parameters, with they default value
+			KeyValueStore parameters;
+			//! Names of the path parameters, in order
+			std::vector<String> captures;
+			//!
+			API::Method::Callback invoke;
+
+		}; // class DecisionTree
+
+
+		//! Result of a lookup (the values point to the path)
+		class Match final
+		{
+		public:
+			Match() :
+				handler(nullptr),
+				count(0)
+			{}
+
+		public:
+			//! The method handler
+			const MethodHandler* handler;
+			//! Number of path parameters
+			uint count;
+			//! Values of the path parameters
+			AnyString values[maxCaptures];
+		};
+
+
+	public:
+		/*!
+		** \brief Build the decision tree of a protocol
+		**
+		** The built-in method `GET /_stats` is added, unless the protocol already
+		** provides this route.
+		** \param statistics Statistics of the service, where the methods are registered
+		*/
+		DecisionTree(const Protocol& protocol, Statistics& statistics);
+
+		/*!
+		** \brief Find the method handler of a path (decoded, without query)
+		**
+		** \param[out] match The method handler and the values of the path parameters
+		** \return True if found
+		*/
+		bool find(Match& match, RequestMethod rqmd, const AnyString& path) const;
+
+	public:
+		//! Number of method handlers
+		uint handlerCount;
+
+	private:
+		//! A node of a radix tree
+		struct Node final
+		{
+			//! Offset of the label in `labels`
+			uint labelOffset;
+			//! Size of the label
+			uint labelSize;
+			//! Index of the first child (the children are contiguous)
+			uint firstChild;
+			//! Number of children
+			uint childCount;
+			//! Index of the child capturing a segment (-1 if none)
+			uint capture;
+			//! Index of the method handler (-1 if none)
+			uint handler;
+		};
+
+		//! Radix tree of the urls of a HTTP method
+		struct Router final
+		{
+			//! All nodes (the root first)
+			std::vector<Node> nodes;
+			//! Labels of all nodes
+			String labels;
+		};
+
+		bool match(Match& match, const Router& router, uint index, const char* path, uint size) const;
+
+	private:
+		//! All method handlers, by index
+		std::vector<MethodHandler> pHandlers;
+		//! A radix tree for each HTTP method
+		Router pRouters[rqmdInvalid];
+
+	}; // class DecisionTree
+
+
+
+	/*!
+	** \brief The decision tree of a transport, swapped when installing a new protocol
+	**
+	** Getting the decision tree only costs an atomic load as long as it has not
+	** changed, the lock is only taken once by each reader after a new protocol.
+	*/
+	class SharedDecisionTree final : private NonCopyable<SharedDecisionTree>
+	{
+	public:
+		SharedDecisionTree() :
+			pVersion(0)
+		{}
+
+		//! Install a new decision tree
+		void reset(DecisionTree* decisionTree);
+
+		/*!
+		** \brief Get the current decision tree
+		**
+		** \param cache Decision tree cached by the caller
+		** \param version Version of the cached decision tree ((uint) -1 initially)
+		*/
+		const DecisionTree::Ptr& get(DecisionTree::Ptr& cache, uint& version) const;
+
+	private:
+		//! Mutex for the decision tree
+		mutable Mutex pMutex;
+		//! The decision tree
+		DecisionTree::Ptr pDecisionTree;
+		//! Version of the decision tree
+		std::atomic<uint> pVersion;
+
+	}; // class SharedDecisionTree
+
+
+
+
+	/*!
+	** \brief Data of a thread serving requests, reused from one request to another
+	**
+	** The messaging context is only created once per thread, and the parameters of
+	** each method are kept and reset to their default values for each request, thus
+	** serving a request does not allocate any memory in steady state.
+	*/
+	class WorkerContext final : private NonCopyable<WorkerContext>
+	{
+	public:
+		explicit WorkerContext(Service& service) :
+			context(service),
+			pCurrent(nullptr),
+			pShared(nullptr),
+			pVersion((uint) -1),
+			pShard(nullptr)
+		{}
+		//! Destructor
+		~WorkerContext();
+
+		//! Get the current decision tree of a transport
+		const DecisionTree::Ptr& decisionTree(const SharedDecisionTree& shared);
+
+		//! Prepare the context for a method
+		void prepare(const DecisionTree::Ptr& decisionTree, const DecisionTree::MethodHandler& mhandler);
+		//! Get back the parameters of the current method
+		void release();
+
+		/*!
+		** \brief Invoke a method
+		**
+		** The context is prepared, the parameters read from the url query and from
+		** the path, then the callback invoked. `release()` must be called once the
+		** response is sent.
+		** \param sample Timing of the request (stages `decode` and `invoke`)
+		** \return False if the query is malformed (the method has not been invoked)
+		*/
+		bool invoke(const DecisionTree::Ptr& decisionTree, const DecisionTree::Match& match,
+			const AnyString& query, uint remotePort, Marshal::Object& response, Statistics::Sample& sample);
+
+		//! Record the statistics of a request (if measured)
+		void record(const DecisionTree::MethodHandler& mhandler, const Statistics::Sample& sample, uint httpStatus);
+		//! Record a request which did not match any method (if measured)
+		void recordNotFound(const Statistics::Sample& sample);
+
+	public:
+		//! The messaging context
+		Messaging::Context context;
+		//! Temporary string for decoding the url query
+		String key;
+
+	private:
+		//! The decision tree the parameters belong to
+		DecisionTree::Ptr pDecisionTree;
+		//! The parameters of each method (by index)
+		std::vector<KeyValueStore> pParameters;
+		//! The parameters of the current method, currently within the context
+		KeyValueStore* pCurrent;
+		//! The decision tree of the transport currently served
+		const SharedDecisionTree* pShared;
+		//! The current decision tree of the transport
+		DecisionTree::Ptr pCache;
+		//! Version of the current decision tree
+		uint pVersion;
+		//! Statistics of the thread (acquired on the first request measured)
+		Statistics::Shard* pShard;
+
+	}; // class WorkerContext
+
+
+	//! Get the data of the current thread (destroyed with the thread)
+	WorkerContext& LocalWorkerContext(Service& service);
+
+	/*!
+	** \brief Read the parameters from an url query (unknown parameters are ignored)
+	**
+	** \param key Temporary string
+	** \return False if the query is malformed
+	*/
+	bool DecodeURLQuery(KeyValueStore& params, const AnyString& query, String& key);
+
+
+
+
+
+	template<class StringT>
+	static inline RequestMethod StringToRequestMethod(const StringT& text)
+	{
+		// note: we assume that `text` is zero-terminated
+		switch (text[0])
+		{
+			case 'G':
+				{
+					// GET
+					if (text[1] == 'E' and text[2] == 'T' and text[3] == '\0')
+						return rqmdGET;
+					break;
+				}
+			case 'P':
+				{
+					// POST
+					if (text[1] == 'O' and text[2] == 'S' and text[3] == 'T' and text[4] == '\0')
+						return rqmdPOST;
+					// PUT
+					if (text[1] == 'U' and text[2] == 'T' and text[3] == '\0')
+						return rqmdPUT;
+					break;
+				}
+			case 'D':
+				{
+					// DELETE
+					if (text[1] == 'E' and text[2] == 'L' and text[3] == 'E' and text[4] == 'T'
+						and text[5] == 'E' and text[6] == '\0')
+							return rqmdDELETE;
+					break;
+				}
+		}
+		return rqmdInvalid;
+	}
+
+
+	inline void SharedDecisionTree::reset(DecisionTree* decisionTree)
+	{
+		MutexLocker locker(pMutex);
+		pDecisionTree = decisionTree;
+		pVersion.fetch_add(1, std::memory_order_release);
+	}
+
+
+	inline const DecisionTree::Ptr& SharedDecisionTree::get(DecisionTree::Ptr& cache, uint& version) const
+	{
+		if (YUNI_UNLIKELY(version != pVersion.load(std::memory_order_acquire)))
+		{
+			MutexLocker locker(pMutex);
+			cache = pDecisionTree;
+			version = pVersion.load(std::memory_order_relaxed);
+		}
+		return cache;
+	}
+
+
+	inline const DecisionTree::Ptr& WorkerContext::decisionTree(const SharedDecisionTree& shared)
+	{
+		if (YUNI_UNLIKELY(pShared != &shared))
+		{
+			pShared = &shared;
+			pVersion = (uint) -1;
+		}
+		return shared.get(pCache, pVersion);
+	}
+
+
+	inline void WorkerContext::release()
+	{
+		if (pCurrent)
+		{
+			context.params.swap(*pCurrent);
+			pCurrent = nullptr;
+		}
+	}
+
+
+
+
+
+} // namespace REST
+} // namespace Transport
+} // namespace Messaging
+} // namespace Yuni
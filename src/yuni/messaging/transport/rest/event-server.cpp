@@ -0,0 +1,1495 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "event-server.h"
+#include "decision-tree.inc.hpp"
+#include "../../../thread/signal.h"
+#include "../../../thread/utility.h"
+#include "../../../core/system/cpu.h"
+#include "../../../job/queue/service.h"
+#include "../../../net/http-status-code.h"
+#include <atomic>
+#include <vector>
+#include <cassert>
+#include <cstring>
+#ifdef YUNI_OS_LINUX
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+# include <sys/socket.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <netdb.h>
+# include <unistd.h>
+# include <errno.h>
+# include <time.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+namespace Transport
+{
+namespace REST
+{
+
+	class EventServer::ServerData final
+	{
+	public:
+		ServerData() :
+			service(nullptr),
+			thread(nullptr),
+			listener(-1),
+			stopping(false),
+			reactorCount(1),
+			heavyTasks(false),
+			dispatchToHeavyTasks(false),
+			idleTimeout(60),
+			maxRequestSize(64 * 1024)
+		{}
+
+		//! Start the reactors
+		Net::Error start(const Net::HostAddress& address, uint port);
+		//! Stop the reactors and close the listening socket
+		void stop();
+
+	public:
+		//! Service
+		Yuni::Messaging::Service* service;
+		//! Attached thread
+		Thread::IThread* thread;
+		//! Signal for stopping the server
+		Thread::Signal signal;
+		//! Listening socket
+		int listener;
+		//! All reactors
+		std::vector<Thread::IThread::Ptr> reactors;
+		//! Flag to stop the reactors
+		std::atomic<bool> stopping;
+		//! The decision tree
+		SharedDecisionTree decisionTree;
+
+		//! Number of reactors
+		uint reactorCount;
+		//! True to invoke the methods from the heavy tasks queue
+		bool heavyTasks;
+		//! True to invoke the methods from the heavy tasks queue (if enabled by the service, see start())
+		bool dispatchToHeavyTasks;
+		//! Delay before closing an idle connection (in seconds, 0 for no limit)
+		uint idleTimeout;
+		//! Maximum size of a request
+		uint maxRequestSize;
+
+	}; // class ServerData
+
+
+
+
+
+	#ifdef YUNI_OS_LINUX
+	namespace // anonymous
+	{
+
+		enum
+		{
+			//! Size of the buffer for reading the incoming data
+			readChunkSize = 64 * 1024,
+			//! Size of the pending responses from which the requests are no longer served
+			maxPendingOutput = 1024 * 1024,
+			//! Maximum number of connections accepted at once by a reactor
+			maxAcceptCount = 64,
+		};
+
+
+		//! Get the current time (in seconds, monotonic clock)
+		inline sint64 Now()
+		{
+			struct timespec ts;
+			::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+			return (sint64) ts.tv_sec;
+		}
+
+
+
+
+		//! A parsed HTTP request (pointing to the received data)
+		struct Request final
+		{
+			//! Method (GET, POST...)
+			AnyString method;
+			//! Path of the url (percent-encoded)
+			AnyString path;
+			//! Query of the url (if any)
+			AnyString query;
+			//! Size of the whole request (headers and body)
+			uint size;
+			//! True for a HTTP/1.0 client
+			bool http10;
+			//! True if the connection should be kept alive after the response
+			bool keepAlive;
+		};
+
+
+		enum class Parse
+		{
+			//! A complete request is available
+			ready,
+			//! More data are required
+			incomplete,
+			//! Malformed request
+			invalid,
+			//! Request too large
+			tooLarge,
+			//! Transfer encoding for the body of the request (not supported)
+			unsupported,
+			//! HTTP version not supported
+			badVersion,
+		};
+
+
+		//! Remove the optional whitespaces around a value
+		inline void TrimOWS(AnyString& value)
+		{
+			const char* p = value.c_str();
+			uint size = value.size();
+			while (size != 0 and (*p == ' ' or *p == '\t'))
+			{
+				++p;
+				--size;
+			}
+			while (size != 0 and (p[size - 1] == ' ' or p[size - 1] == '\t'))
+				--size;
+			value.adapt(p, size);
+		}
+
+
+		/*!
+		** \brief Parse the next HTTP request (headers, then skipping the body if any)
+		**
+		** \param[out] rq The request, pointing to `data`
+		** \param data The received data
+		** \param maxSize Maximum size of a request
+		*/
+		Parse ParseRequest(Request& rq, const AnyString& data, uint maxSize)
+		{
+			uint end = data.find("\r\n\r\n");
+			if (end >= data.size())
+				return (data.size() > maxSize) ? Parse::tooLarge : Parse::incomplete;
+			const uint headerSize = end + 4;
+			if (headerSize > maxSize)
+				return Parse::tooLarge;
+
+			// request line: <method> <target> HTTP/1.x
+			const char* const p = data.c_str();
+			uint eol = data.find("\r\n");
+			AnyString line(p, eol);
+			uint sp1 = line.find(' ');
+			if (sp1 == 0 or sp1 >= line.size())
+				return Parse::invalid;
+			uint sp2 = line.find(' ', sp1 + 1);
+			if (sp2 >= line.size() or sp2 == sp1 + 1)
+				return Parse::invalid;
+
+			rq.method.adapt(p, sp1);
+			AnyString target(p + sp1 + 1, sp2 - sp1 - 1);
+			AnyString version(p + sp2 + 1, eol - sp2 - 1);
+			if (version == "HTTP/1.1")
+				rq.http10 = false;
+			else if (version == "HTTP/1.0")
+				rq.http10 = true;
+			else
+				return version.startsWith("HTTP/") ? Parse::badVersion : Parse::invalid;
+			rq.keepAlive = not rq.http10;
+
+			uint q = target.find('?');
+			if (q < target.size())
+			{
+				rq.path.adapt(target.c_str(), q);
+				rq.query.adapt(target.c_str() + q + 1, target.size() - q - 1);
+			}
+			else
+			{
+				rq.path = target;
+				rq.query.clear();
+			}
+
+			// headers
+			uint contentLength = 0;
+			uint offset = eol + 2;
+			while (offset < end + 2)
+			{
+				uint lineEnd = data.find("\r\n", offset);
+				AnyString header(p + offset, lineEnd - offset);
+				offset = lineEnd + 2;
+
+				uint colon = header.find(':');
+				if (colon == 0 or colon >= header.size())
+					return Parse::invalid;
+				AnyString name(header.c_str(), colon);
+				AnyString value(header.c_str() + colon + 1, header.size() - colon - 1);
+				TrimOWS(value);
+
+				switch (name.size())
+				{
+					case 10:
+						{
+							if (name.equalsInsensitive("connection"))
+							{
+								if (value.ifind("close") < value.size())
+									rq.keepAlive = false;
+								else if (value.ifind("keep-alive") < value.size())
+									rq.keepAlive = true;
+							}
+							break;
+						}
+					case 14:
+						{
+							if (name.equalsInsensitive("content-length"))
+							{
+								if (value.empty())
+									return Parse::invalid;
+								contentLength = 0;
+								for (uint i = 0; i != value.size(); ++i)
+								{
+									if (not String::IsDigit(value[i]))
+										return Parse::invalid;
+									contentLength = contentLength * 10 + (uint)(value[i] - '0');
+									if (contentLength > maxSize)
+										return Parse::tooLarge;
+								}
+							}
+							break;
+						}
+					case 17:
+						{
+							if (name.equalsInsensitive("transfer-encoding"))
+								return Parse::unsupported;
+							break;
+						}
+				}
+			}
+
+			if (contentLength > maxSize - headerSize)
+				return Parse::tooLarge;
+			rq.size = headerSize + contentLength;
+			return (rq.size <= data.size()) ? Parse::ready : Parse::incomplete;
+		}
+
+
+		//! Value of an hexadecimal digit (-1 if invalid)
+		inline int HexDigit(char c)
+		{
+			if (c >= '0' and c <= '9')
+				return c - '0';
+			if (c >= 'a' and c <= 'f')
+				return c - 'a' + 10;
+			if (c >= 'A' and c <= 'F')
+				return c - 'A' + 10;
+			return -1;
+		}
+
+
+		//! Decode the path of an url (percent-encoding)
+		bool DecodeURLPath(String& out, const AnyString& path)
+		{
+			out.clear();
+			for (uint i = 0; i != path.size(); ++i)
+			{
+				char c = path[i];
+				if (c == '%')
+				{
+					int high = (i + 2 < path.size()) ? HexDigit(path[i + 1]) : -1;
+					int low  = (high >= 0) ? HexDigit(path[i + 2]) : -1;
+					if (low < 0)
+						return false;
+					c = (char) (high * 16 + low);
+					i += 2;
+				}
+				out += c;
+			}
+			return true;
+		}
+
+
+		RequestMethod MethodFromString(const AnyString& method)
+		{
+			if (method == "GET")
+				return rqmdGET;
+			if (method == "POST")
+				return rqmdPOST;
+			if (method == "PUT")
+				return rqmdPUT;
+			if (method == "DELETE")
+				return rqmdDELETE;
+			return rqmdInvalid;
+		}
+
+
+		//! Append the header 'Connection' if the default behavior is not the expected one
+		inline void WriteConnectionHeader(Clob& out, bool keepAlive, bool http10)
+		{
+			if (http10)
+			{
+				if (keepAlive)
+					out.append("Connection: keep-alive\r\n", 24);
+			}
+			else
+			{
+				if (not keepAlive)
+					out.append("Connection: close\r\n", 19);
+			}
+		}
+
+
+		//! Append a response without body
+		void WriteError(Clob& out, uint statusCode, bool keepAlive, bool http10)
+		{
+			AnyString text = Net::HttpStatusCodeToCString(statusCode);
+			out << "HTTP/1.1 " << statusCode << ' ' << text;
+			out << "\r\nContent-Type: text/plain\r\nCache-Control: no-cache\r\nContent-Length: " << text.size() << "\r\n";
+			WriteConnectionHeader(out, keepAlive, http10);
+			out.append("\r\n", 2);
+			out += text;
+		}
+
+
+		/*!
+		** \brief Invoke a method and append its response
+		**
+		** The JSON is directly serialized into `out`, after the headers. The length is
+		** written afterwards, into some spaces reserved for it (optional whitespaces
+		** after the value of the header). The statistics of the request are recorded
+		** (the response is sent later, along with the others).
+		*/
+		void WriteResponse(Clob& out, WorkerContext& worker, const DecisionTree::Ptr& decisionTree,
+			const DecisionTree::Match& match, const AnyString& query, uint remotePort, bool keepAlive, bool http10,
+			Statistics::Sample& sample)
+		{
+			Marshal::Object response;
+			if (not worker.invoke(decisionTree, match, query, remotePort, response, sample))
+			{
+				worker.release();
+				WriteError(out, 400, keepAlive, http10);
+				sample.stage(Statistics::Stage::serialize);
+				worker.record(*match.handler, sample, 400);
+				return;
+			}
+
+			Messaging::Context& context = worker.context;
+			uint statusCode = context.httpStatus;
+			if  (statusCode >= 200 and statusCode <= context.httpStatusCode.max2xx)
+			{
+				# ifndef NDEBUG
+				const bool pretty = true;
+				# else
+				const bool pretty = false; // reduce size output
+				# endif
+
+				out += context.httpStatusCode.header2xx[statusCode - 200];
+				out.append("Content-Type: application/json\r\n", 32);
+				WriteConnectionHeader(out, keepAlive, http10);
+				out.append("Content-Length: ", 16);
+				uint lengthOffset = out.size();
+				out.append("          \r\n\r\n", 14);
+				uint bodyOffset = out.size();
+
+				response.toJSON(out, pretty);
+
+				ShortString16 length;
+				length << (out.size() - bodyOffset);
+				::memcpy(out.data() + lengthOffset, length.c_str(), length.size());
+
+				// reducing memory usage for some Memory-hungry apps
+				context.autoshrink();
+			}
+			else if (statusCode >= 400 and statusCode <= context.httpStatusCode.max4xx)
+			{
+				// reducing memory usage for some Memory-hungry apps
+				context.autoshrink();
+				WriteError(out, statusCode, keepAlive, http10);
+			}
+			else
+			{
+				// not handled by default
+				WriteError(out, 500, keepAlive, http10);
+				statusCode = 500;
+			}
+			sample.stage(Statistics::Stage::serialize);
+			worker.release();
+			worker.record(*match.handler, sample, statusCode);
+		}
+
+
+
+
+		class Connection;
+
+		/*!
+		** \brief Requests completed by the heavy tasks, for a reactor
+		**
+		** The mailbox is kept alive by the connections, since the jobs may complete
+		** after the reactor has been stopped.
+		*/
+		class Mailbox final
+			: public IIntrusiveSmartPtr<Mailbox, false>
+			, private NonCopyable<Mailbox>
+		{
+		public:
+			//! Ancestor
+			typedef IIntrusiveSmartPtr<Mailbox, false>  Ancestor;
+			//! The most suitable smart pointer for the class
+			typedef Ancestor::SmartPtrType<Mailbox>::PtrThreadSafe Ptr;
+
+		public:
+			Mailbox() :
+				fd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+				pClosed(false),
+				pHead(nullptr)
+			{}
+
+			~Mailbox()
+			{
+				if (fd >= 0)
+					::close(fd);
+			}
+
+			//! Post a completed request (ignored once closed)
+			void post(Connection* connection);
+			//! Take all the completed requests (with a reference for each)
+			Connection* takeAll();
+			//! Close the mailbox, and take the remaining requests
+			Connection* close();
+			//! Wake up the reactor
+			void notify();
+
+		public:
+			//! Event file descriptor, to wake up the reactor
+			const int fd;
+
+		private:
+			Mutex pMutex;
+			bool pClosed;
+			Connection* pHead;
+
+		}; // class Mailbox
+
+
+
+		//! A client connection, owned by a reactor (and by a job while a request is invoked)
+		class Connection final
+			: public IIntrusiveSmartPtr<Connection, false>
+			, private NonCopyable<Connection>
+		{
+		public:
+			//! Ancestor
+			typedef IIntrusiveSmartPtr<Connection, false>  Ancestor;
+			//! The most suitable smart pointer for the class
+			typedef Ancestor::SmartPtrType<Connection>::PtrThreadSafe Ptr;
+
+		public:
+			Connection(Service& service, const Mailbox::Ptr& mailbox, int fd, uint remotePort) :
+				fd(fd),
+				remotePort(remotePort),
+				events(0),
+				written(0),
+				lastActivity(0),
+				busy(false),
+				eof(false),
+				closeAfterFlush(false),
+				closed(false),
+				prev(nullptr),
+				next(nullptr),
+				service(service),
+				mailbox(mailbox),
+				rqmd(rqmdInvalid),
+				keepAlive(true),
+				http10(false),
+				nextCompleted(nullptr)
+			{}
+
+			//! Invoke the method of the current request (heavy tasks)
+			void invoke()
+			{
+				WorkerContext& worker = LocalWorkerContext(service);
+				Statistics::Sample sample;
+				sample.start(service.statistics);
+				// the path parameters can not point to the buffer of the reactor
+				DecisionTree::Match match;
+				if (decisionTree->find(match, rqmd, path))
+				{
+					sample.stage(Statistics::Stage::route);
+					WriteResponse(response, worker, decisionTree, match, query, remotePort, keepAlive, http10, sample);
+				}
+				else
+				{
+					// the url has not been found
+					worker.recordNotFound(sample);
+					WriteError(response, 404, keepAlive, http10);
+				}
+			}
+
+		public:
+			//! \name Reactor
+			//@{
+			//! Socket
+			int fd;
+			//! Remote port
+			uint remotePort;
+			//! Events currently monitored
+			uint events;
+			//! Received data not consumed yet (partial or pending requests)
+			Clob input;
+			//! Responses not sent yet
+			Clob output;
+			//! Number of bytes of `output` already sent
+			uint written;
+			//! Time of the last activity
+			sint64 lastActivity;
+			//! True while a request is invoked by the heavy tasks
+			bool busy;
+			//! True when the client has closed its side of the connection
+			bool eof;
+			//! True to close the connection once the responses are sent
+			bool closeAfterFlush;
+			//! True when the connection has been closed
+			bool closed;
+			//! Connections of the reactor, the least recently active first
+			Connection* prev;
+			Connection* next;
+			//@}
+
+			//! \name Heavy tasks
+			//@{
+			//! Service
+			Service& service;
+			//! Mailbox of the reactor
+			const Mailbox::Ptr mailbox;
+			//! Decision tree for the current request
+			DecisionTree::Ptr decisionTree;
+			//! HTTP method of the current request
+			RequestMethod rqmd;
+			//! Path of the current request (decoded)
+			String path;
+			//! Query of the current request
+			String query;
+			//! True if the connection should be kept alive after the response
+			bool keepAlive;
+			//! True for a HTTP/1.0 client
+			bool http10;
+			//! The response of the current request
+			Clob response;
+			//! Next completed request in the mailbox
+			Connection* nextCompleted;
+			//@}
+
+		}; // class Connection
+
+
+
+
+		inline void Mailbox::post(Connection* connection)
+		{
+			{
+				MutexLocker locker(pMutex);
+				if (pClosed)
+					return;
+				connection->addRef();
+				connection->nextCompleted = pHead;
+				pHead = connection;
+			}
+			notify();
+		}
+
+
+		inline Connection* Mailbox::takeAll()
+		{
+			MutexLocker locker(pMutex);
+			Connection* head = pHead;
+			pHead = nullptr;
+			return head;
+		}
+
+
+		inline Connection* Mailbox::close()
+		{
+			MutexLocker locker(pMutex);
+			pClosed = true;
+			Connection* head = pHead;
+			pHead = nullptr;
+			return head;
+		}
+
+
+		inline void Mailbox::notify()
+		{
+			uint64 value = 1;
+			ssize_t r = ::write(fd, &value, sizeof(value));
+			(void) r; // the counter can not overflow in practice
+		}
+
+
+
+
+		/*!
+		** \brief Thread serving some connections (epoll)
+		**
+		** All the reactors share the same listening socket (each one accepts its own
+		** connections). The requests are served from a buffer of the reactor and the
+		** responses written into another one, the connections only keep the remaining
+		** bytes (partial requests or responses not completely sent).
+		*/
+		class Reactor final : public Yuni::Thread::IThread
+		{
+		public:
+			//! The most suitable smart pointer
+			typedef Yuni::Thread::IThread::Ptr::Promote<Reactor>::Ptr  Ptr;
+
+		public:
+			explicit Reactor(EventServer::ServerData& server);
+			virtual ~Reactor();
+
+			//! Prepare the reactor (before starting the thread)
+			bool prepare();
+			//! Wake up the reactor
+			void notify() { pMailbox->notify(); }
+
+		protected:
+			virtual bool onExecute() override;
+
+		private:
+			//! Accept the new connections
+			void accept();
+			//! Data received or ready to send more data
+			void process(Connection* conn, uint events);
+			//! Requests completed by the heavy tasks
+			void completed();
+			//! Read the available data (false if the connection must be closed)
+			bool receive(Connection& conn);
+			//! Serve the complete requests and send the responses
+			void pump(Connection& conn, Clob* received);
+			//! Serve the complete requests available (returns the number of bytes consumed)
+			uint serve(Connection& conn, const Clob& source, Clob& out);
+			//! Serve a single request
+			void dispatch(Connection& conn, const Request& rq, Clob& out);
+			//! Send some data (false if the connection must be closed)
+			bool send(Connection& conn, const Clob& data, uint& written);
+			//! Update the monitored events of a connection
+			void update(Connection& conn);
+			//! Mark a connection as active
+			void touch(Connection& conn);
+			//! Close a connection
+			void close(Connection& conn);
+			//! Release the connections closed during the last events
+			void releaseClosedConnections();
+			//! Close the idle connections
+			void closeIdleConnections();
+			//! Stop and resume accepting connections (too many opened files)
+			void listen(bool enabled);
+
+		private:
+			//! The server
+			EventServer::ServerData& pServer;
+			//! Epoll file descriptor
+			int pEpoll;
+			//! The completed requests
+			Mailbox::Ptr pMailbox;
+			//! True if the listening socket is monitored
+			bool pListening;
+			//! Current time (seconds)
+			sint64 pNow;
+			//! Connections, the least recently active first
+			Connection* pHead;
+			Connection* pTail;
+			//! Connections closed, still referenced until the end of the current events
+			std::vector<Connection*> pClosed;
+			//! Buffer for the received data
+			Clob pInput;
+			//! Buffer for the responses
+			Clob pOutput;
+			//! Decoded path of the current request
+			String pPath;
+
+		}; // class Reactor
+
+
+
+
+		Reactor::Reactor(EventServer::ServerData& server) :
+			pServer(server),
+			pEpoll(-1),
+			pMailbox(new Mailbox()),
+			pListening(false),
+			pNow(0),
+			pHead(nullptr),
+			pTail(nullptr)
+		{}
+
+
+		Reactor::~Reactor()
+		{
+			// for code robustness
+			stop();
+			if (pEpoll >= 0)
+				::close(pEpoll);
+		}
+
+
+		bool Reactor::prepare()
+		{
+			pEpoll = ::epoll_create1(EPOLL_CLOEXEC);
+			if (pEpoll < 0 or pMailbox->fd < 0)
+				return false;
+
+			struct epoll_event ev;
+			ev.events = EPOLLIN;
+			ev.data.ptr = this;
+			if (0 != ::epoll_ctl(pEpoll, EPOLL_CTL_ADD, pMailbox->fd, &ev))
+				return false;
+			listen(true);
+			return pListening;
+		}
+
+
+		void Reactor::listen(bool enabled)
+		{
+			if (enabled == pListening)
+				return;
+			if (enabled)
+			{
+				struct epoll_event ev;
+				ev.events = EPOLLIN;
+				# ifdef EPOLLEXCLUSIVE
+				// a new connection only wakes up a single reactor
+				ev.events |= EPOLLEXCLUSIVE;
+				# endif
+				ev.data.ptr = nullptr;
+				pListening = (0 == ::epoll_ctl(pEpoll, EPOLL_CTL_ADD, pServer.listener, &ev));
+			}
+			else
+			{
+				::epoll_ctl(pEpoll, EPOLL_CTL_DEL, pServer.listener, nullptr);
+				pListening = false;
+			}
+		}
+
+
+		bool Reactor::onExecute()
+		{
+			struct epoll_event events[128];
+			pNow = Now();
+			sint64 lastSweep = pNow;
+
+			while (not pServer.stopping.load(std::memory_order_acquire))
+			{
+				// retrying to accept connections frequently when paused
+				int count = ::epoll_wait(pEpoll, events, 128, (pListening ? 1000 : 100));
+				if (YUNI_UNLIKELY(count < 0))
+				{
+					if (errno == EINTR)
+						continue;
+					break;
+				}
+				pNow = Now();
+
+				for (int i = 0; i != count; ++i)
+				{
+					void* ptr = events[i].data.ptr;
+					if (ptr == nullptr)
+						accept();
+					else if (ptr == this)
+						completed();
+					else
+						process(reinterpret_cast<Connection*>(ptr), events[i].events);
+				}
+
+				if (pNow != lastSweep)
+				{
+					lastSweep = pNow;
+					if (not pListening)
+						listen(true);
+					closeIdleConnections();
+				}
+
+				// the other events of the batch may still reference the closed connections
+				releaseClosedConnections();
+			}
+
+			// the jobs completed from now on will not be posted
+			Connection* conn = pMailbox->close();
+			while (conn)
+			{
+				Connection* next = conn->nextCompleted;
+				if (conn->release())
+					delete conn;
+				conn = next;
+			}
+			while (pHead)
+				close(*pHead);
+			releaseClosedConnections();
+			listen(false);
+			return false; // stop the thread
+		}
+
+
+		void Reactor::accept()
+		{
+			for (uint i = 0; i != maxAcceptCount; ++i)
+			{
+				struct sockaddr_storage addr;
+				socklen_t addrlen = sizeof(addr);
+				int fd = ::accept4(pServer.listener, (struct sockaddr*) &addr, &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+				if (fd < 0)
+				{
+					switch (errno)
+					{
+						case EINTR:
+						case ECONNABORTED:
+							continue;
+						case EMFILE:
+						case ENFILE:
+						case ENOBUFS:
+						case ENOMEM:
+							// the pending connections would wake up the reactor continuously
+							listen(false);
+							return;
+					}
+					return; // EAGAIN (another reactor took the connection)
+				}
+
+				int nodelay = 1;
+				::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+				uint remotePort = 0;
+				if (addr.ss_family == AF_INET)
+					remotePort = ntohs(((struct sockaddr_in*) &addr)->sin_port);
+				else if (addr.ss_family == AF_INET6)
+					remotePort = ntohs(((struct sockaddr_in6*) &addr)->sin6_port);
+
+				Connection* conn = new Connection(*pServer.service, pMailbox, fd, remotePort);
+				conn->addRef(); // owned by the reactor
+				conn->prev = pTail;
+				if (pTail)
+					pTail->next = conn;
+				else
+					pHead = conn;
+				pTail = conn;
+				conn->lastActivity = pNow;
+
+				struct epoll_event ev;
+				ev.events = EPOLLIN;
+				ev.data.ptr = conn;
+				if (0 != ::epoll_ctl(pEpoll, EPOLL_CTL_ADD, fd, &ev))
+				{
+					close(*conn);
+					continue;
+				}
+				conn->events = EPOLLIN;
+			}
+		}
+
+
+		void Reactor::process(Connection* conn, uint events)
+		{
+			// closed by a previous event of the same batch
+			if (YUNI_UNLIKELY(conn->closed))
+				return;
+
+			if (YUNI_UNLIKELY(0 != (events & (EPOLLERR | EPOLLHUP))))
+			{
+				close(*conn);
+				return;
+			}
+
+			if (0 != (events & EPOLLIN))
+			{
+				if (not receive(*conn))
+				{
+					close(*conn);
+					return;
+				}
+				touch(*conn);
+				pump(*conn, &pInput);
+			}
+			else
+				pump(*conn, nullptr);
+		}
+
+
+		bool Reactor::receive(Connection& conn)
+		{
+			pInput.clear();
+			do
+			{
+				pInput.reserve(pInput.size() + readChunkSize + 1);
+				uint size = pInput.size();
+				uint available = pInput.capacity() - size - 1;
+
+				ssize_t r = ::recv(conn.fd, pInput.data() + size, available, 0);
+				if (r > 0)
+				{
+					pInput.resize(size + (uint) r);
+					if ((uint) r < available)
+						return true; // nothing more for now
+				}
+				else if (r == 0)
+				{
+					conn.eof = true;
+					return true;
+				}
+				else
+				{
+					if (errno == EINTR)
+						continue;
+					return (errno == EAGAIN or errno == EWOULDBLOCK);
+				}
+			}
+			while (pInput.size() < pServer.maxRequestSize + readChunkSize);
+			return true;
+		}
+
+
+		void Reactor::pump(Connection& conn, Clob* received)
+		{
+			bool alive;
+			for (;;)
+			{
+				// serving the requests directly from the buffer of the reactor when possible
+				Clob* source = &conn.input;
+				if (received)
+				{
+					if (conn.input.empty())
+						source = received;
+					else
+						conn.input += *received;
+					received = nullptr;
+				}
+
+				// the responses are written into the buffer of the reactor when possible
+				Clob& out = (conn.output.empty()) ? pOutput : conn.output;
+				uint consumed = serve(conn, *source, out);
+				// too many pending responses, the remaining requests will be served later
+				bool saturated = (out.size() >= maxPendingOutput);
+
+				// keeping the remaining data
+				if (source == &conn.input)
+				{
+					conn.input.consume(consumed);
+					if (conn.input.empty())
+						conn.input.shrink();
+				}
+				else if (consumed < source->size())
+					conn.input.append(source->c_str() + consumed, source->size() - consumed);
+
+				// sending the responses
+				if (&out == &pOutput)
+				{
+					uint written = 0;
+					alive = send(conn, pOutput, written);
+					if (alive and written < pOutput.size())
+					{
+						conn.output.append(pOutput.c_str() + written, pOutput.size() - written);
+						conn.written = 0;
+					}
+					pOutput.clear();
+					if (pOutput.capacity() > maxPendingOutput * 4)
+						pOutput.shrink();
+				}
+				else
+				{
+					alive = send(conn, conn.output, conn.written);
+				}
+
+				if (alive and conn.output.size() == conn.written)
+				{
+					conn.output.clear();
+					conn.output.shrink();
+					conn.written = 0;
+					// all sent: the requests left by serve() can be served now (no new data
+					// may ever come to wake up the connection)
+					if (saturated and not conn.input.empty() and not conn.busy and not conn.closeAfterFlush)
+						continue;
+					// nothing more to do with this connection
+					if (not conn.busy and (conn.closeAfterFlush or conn.eof))
+						alive = false;
+				}
+				break;
+			}
+
+			if (alive)
+				update(conn);
+			else
+				close(conn);
+		}
+
+
+		uint Reactor::serve(Connection& conn, const Clob& source, Clob& out)
+		{
+			uint offset = 0;
+			while (offset < source.size() and not conn.busy and not conn.closeAfterFlush
+				and out.size() < maxPendingOutput)
+			{
+				Request rq;
+				AnyString data(source.c_str() + offset, source.size() - offset);
+				switch (ParseRequest(rq, data, pServer.maxRequestSize))
+				{
+					case Parse::ready:
+						break;
+					case Parse::incomplete:
+						return offset;
+					case Parse::invalid:
+						WriteError(out, 400, false, false);
+						conn.closeAfterFlush = true;
+						return source.size();
+					case Parse::tooLarge:
+						WriteError(out, 413, false, false);
+						conn.closeAfterFlush = true;
+						return source.size();
+					case Parse::unsupported:
+						WriteError(out, 501, false, false);
+						conn.closeAfterFlush = true;
+						return source.size();
+					case Parse::badVersion:
+						WriteError(out, 505, false, false);
+						conn.closeAfterFlush = true;
+						return source.size();
+				}
+
+				offset += rq.size;
+				if (not rq.keepAlive)
+					conn.closeAfterFlush = true;
+				dispatch(conn, rq, out);
+			}
+			return offset;
+		}
+
+
+		void Reactor::dispatch(Connection& conn, const Request& rq, Clob& out)
+		{
+			WorkerContext& worker = LocalWorkerContext(*pServer.service);
+			const DecisionTree::Ptr& decisionTree = worker.decisionTree(pServer.decisionTree);
+			// timing of the request, if the statistics are enabled
+			Statistics::Sample sample;
+			sample.start(pServer.service->statistics);
+
+			DecisionTree::Match match;
+			AnyString path = rq.path;
+			RequestMethod rqmd = MethodFromString(rq.method);
+			bool found = false;
+			if (rqmd != rqmdInvalid and !(!decisionTree))
+			{
+				if (path.find('%') < path.size())
+				{
+					if (DecodeURLPath(pPath, path))
+						path = pPath;
+					else
+						path.clear();
+				}
+				found = (not path.empty()) and decisionTree->find(match, rqmd, path);
+			}
+			if (not found)
+			{
+				// the url has not been found
+				worker.recordNotFound(sample);
+				WriteError(out, 404, rq.keepAlive, rq.http10);
+				return;
+			}
+
+			if (not pServer.dispatchToHeavyTasks)
+			{
+				sample.stage(Statistics::Stage::route);
+				WriteResponse(out, worker, decisionTree, match, rq.query, conn.remotePort, rq.keepAlive, rq.http10, sample);
+				return;
+			}
+
+			// the next requests will be served once the response is available
+			conn.busy = true;
+			conn.decisionTree = decisionTree;
+			conn.rqmd = rqmd;
+			conn.path = path;
+			conn.query = rq.query;
+			conn.keepAlive = rq.keepAlive;
+			conn.http10 = rq.http10;
+			conn.response.clear();
+
+			Connection::Ptr self = &conn;
+			async(pServer.service->heavyTasks.queue, [self]()
+			{
+				self->invoke();
+				self->mailbox->post(Connection::Ptr::WeakPointer(self));
+			});
+		}
+
+
+		void Reactor::completed()
+		{
+			uint64 value;
+			ssize_t r = ::read(pMailbox->fd, &value, sizeof(value));
+			(void) r; // reset the counter
+
+			Connection* conn = pMailbox->takeAll();
+			while (conn)
+			{
+				Connection* next = conn->nextCompleted;
+				conn->busy = false;
+				conn->decisionTree = nullptr;
+				if (not conn->closed)
+				{
+					if (conn->output.empty())
+					{
+						conn->output.swap(conn->response);
+						conn->written = 0;
+					}
+					else
+						conn->output += conn->response;
+					conn->response.clear();
+					touch(*conn);
+					pump(*conn, nullptr);
+				}
+				if (conn->release())
+					delete conn;
+				conn = next;
+			}
+		}
+
+
+		bool Reactor::send(Connection& conn, const Clob& data, uint& written)
+		{
+			while (written < data.size())
+			{
+				ssize_t w = ::send(conn.fd, data.c_str() + written, data.size() - written, MSG_NOSIGNAL);
+				if (w > 0)
+					written += (uint) w;
+				else if (w < 0 and errno == EINTR)
+					continue;
+				else
+					return (w < 0 and (errno == EAGAIN or errno == EWOULDBLOCK));
+			}
+			return true;
+		}
+
+
+		void Reactor::update(Connection& conn)
+		{
+			uint events = 0;
+			bool pending = (conn.written < conn.output.size());
+			// no more requests are read while waiting for the previous responses
+			if (not conn.busy and not conn.eof and not conn.closeAfterFlush
+				and conn.output.size() < maxPendingOutput and conn.input.size() <= pServer.maxRequestSize)
+				events |= EPOLLIN;
+			if (pending)
+				events |= EPOLLOUT;
+
+			if (events != conn.events)
+			{
+				struct epoll_event ev;
+				ev.events = events;
+				ev.data.ptr = &conn;
+				::epoll_ctl(pEpoll, EPOLL_CTL_MOD, conn.fd, &ev);
+				conn.events = events;
+			}
+		}
+
+
+		void Reactor::touch(Connection& conn)
+		{
+			conn.lastActivity = pNow;
+			if (&conn != pTail)
+			{
+				// moving the connection at the end of the list
+				if (conn.prev)
+					conn.prev->next = conn.next;
+				else
+					pHead = conn.next;
+				conn.next->prev = conn.prev;
+				conn.prev = pTail;
+				conn.next = nullptr;
+				pTail->next = &conn;
+				pTail = &conn;
+			}
+		}
+
+
+		void Reactor::close(Connection& conn)
+		{
+			assert(not conn.closed);
+			if (conn.prev)
+				conn.prev->next = conn.next;
+			else
+				pHead = conn.next;
+			if (conn.next)
+				conn.next->prev = conn.prev;
+			else
+				pTail = conn.prev;
+			conn.prev = nullptr;
+			conn.next = nullptr;
+
+			::close(conn.fd); // removed from epoll as well
+			conn.fd = -1;
+			conn.closed = true;
+			// the reference of the reactor is kept until the end of the current events
+			// (see releaseClosedConnections())
+			pClosed.push_back(&conn);
+		}
+
+
+		void Reactor::releaseClosedConnections()
+		{
+			// the job may still reference the connection
+			for (uint i = 0; i != (uint) pClosed.size(); ++i)
+			{
+				if (pClosed[i]->release())
+					delete pClosed[i];
+			}
+			pClosed.clear();
+		}
+
+
+		void Reactor::closeIdleConnections()
+		{
+			uint timeout = pServer.idleTimeout;
+			if (timeout == 0)
+				return;
+			sint64 limit = pNow - (sint64) timeout;
+			while (pHead and pHead->lastActivity <= limit)
+			{
+				if (pHead->busy)
+					touch(*pHead); // the request is still being invoked
+				else
+					close(*pHead);
+			}
+		}
+
+
+
+	} // anonymous namespace
+
+
+
+
+	Net::Error EventServer::ServerData::start(const Net::HostAddress& address, uint port)
+	{
+		// all addresses by default (like REST::Server)
+		bool any = (address.empty() or address == "*");
+
+		struct addrinfo hints;
+		::memset(&hints, 0, sizeof(hints));
+		hints.ai_family = (any) ? AF_INET : AF_UNSPEC;
+		hints.ai_socktype = SOCK_STREAM;
+		hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+		ShortString16 service;
+		service << port;
+
+		struct addrinfo* result = nullptr;
+		if (0 != ::getaddrinfo((any ? nullptr : address.c_str()), service.c_str(), &hints, &result))
+			return Net::errInvalidHostAddress;
+
+		for (struct addrinfo* ai = result; ai != nullptr; ai = ai->ai_next)
+		{
+			int fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+			if (fd < 0)
+				continue;
+			int reuse = 1;
+			::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+			if (0 == ::bind(fd, ai->ai_addr, ai->ai_addrlen) and 0 == ::listen(fd, SOMAXCONN))
+			{
+				listener = fd;
+				break;
+			}
+			::close(fd);
+		}
+		::freeaddrinfo(result);
+		if (listener < 0)
+			return Net::errStartFailed;
+
+		stopping = false;
+		for (uint i = 0; i != reactorCount; ++i)
+		{
+			Reactor::Ptr reactor = new Reactor(*this);
+			reactors.push_back(reactor);
+			if (not reactor->prepare() or Thread::errNone != reactor->start())
+			{
+				stop();
+				return Net::errStartFailed;
+			}
+		}
+		return Net::errNone;
+	}
+
+
+	void EventServer::ServerData::stop()
+	{
+		stopping = true;
+		for (uint i = 0; i != (uint) reactors.size(); ++i)
+			static_cast<Reactor&>(*reactors[i]).notify();
+		for (uint i = 0; i != (uint) reactors.size(); ++i)
+			reactors[i]->stop();
+		reactors.clear();
+
+		if (listener >= 0)
+		{
+			::close(listener);
+			listener = -1;
+		}
+	}
+
+
+	#else
+
+
+	Net::Error EventServer::ServerData::start(const Net::HostAddress&, uint)
+	{
+		// epoll is not available
+		return Net::errStartFailed;
+	}
+
+
+	void EventServer::ServerData::stop()
+	{
+	}
+
+
+	#endif // YUNI_OS_LINUX
+
+
+
+
+	EventServer::EventServer() :
+		ITransport(tmServer)
+	{
+		pData = new ServerData();
+		reactorCount(0);
+	}
+
+
+	EventServer::~EventServer()
+	{
+		ServerData* ptr = pData;
+		pData = nullptr;
+		ptr->stop();
+		delete ptr;
+	}
+
+
+	Net::Error EventServer::start()
+	{
+		assert(pData and "internal error");
+		assert(pService != NULL and "invalid reference to Messaging::Service");
+		pData->service = pService;
+
+		// stopping the reactors if not already done
+		pData->stop();
+
+		// reset all internal states
+		pData->thread = nullptr;
+		pData->signal.reset();
+		// the heavy tasks queue is not started when disabled
+		pData->dispatchToHeavyTasks = pData->heavyTasks and pService->heavyTasks.enabled();
+
+		return pData->start(address, port.value());
+	}
+
+
+	Net::Error EventServer::run()
+	{
+		assert(pData and "internal error");
+		pData->thread = pAttachedThread;
+
+		// infinite wait, until we receive a message to stop
+		pData->signal.wait();
+
+		pData->stop();
+		pData->thread = nullptr;
+		return Net::errNone;
+	}
+
+
+	void EventServer::stop()
+	{
+		assert(pData and "internal error");
+		// notifying that we should stop as soon as possible
+		pData->signal.notify();
+	}
+
+
+	void EventServer::protocol(const Protocol& protocol)
+	{
+		assert(pData and "internal error");
+		// Switching to the new protocol
+		pData->decisionTree.reset(new DecisionTree(protocol, pService->statistics));
+	}
+
+
+	void EventServer::reactorCount(uint count)
+	{
+		assert(pData and "internal error");
+		pData->reactorCount = (count != 0) ? count : System::CPU::Count();
+		if (pData->reactorCount == 0)
+			pData->reactorCount = 1;
+	}
+
+
+	uint EventServer::reactorCount() const
+	{
+		assert(pData and "internal error");
+		return pData->reactorCount;
+	}
+
+
+	void EventServer::dispatchToHeavyTasks(bool enabled)
+	{
+		assert(pData and "internal error");
+		pData->heavyTasks = enabled;
+	}
+
+
+	bool EventServer::dispatchToHeavyTasks() const
+	{
+		assert(pData and "internal error");
+		return pData->heavyTasks;
+	}
+
+
+	void EventServer::idleTimeout(uint seconds)
+	{
+		assert(pData and "internal error");
+		pData->idleTimeout = seconds;
+	}
+
+
+	uint EventServer::idleTimeout() const
+	{
+		assert(pData and "internal error");
+		return pData->idleTimeout;
+	}
+
+
+	void EventServer::maxRequestSize(uint bytes)
+	{
+		assert(pData and "internal error");
+		pData->maxRequestSize = (bytes < 1024) ? 1024 : bytes;
+	}
+
+
+	uint EventServer::maxRequestSize() const
+	{
+		assert(pData and "internal error");
+		return pData->maxRequestSize;
+	}
+
+
+
+
+
+} // namespace REST
+} // namespace Transport
+} // namespace Messaging
+} // namespace Yuni
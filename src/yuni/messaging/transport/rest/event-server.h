@@ -0,0 +1,110 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#ifndef __YUNI_MESSAGING_TRANSPORT_REST_EVENT_SERVER_H__
+# define __YUNI_MESSAGING_TRANSPORT_REST_EVENT_SERVER_H__
+
+# include "../transport.h"
+
+
+namespace Yuni
+{
+namespace Messaging
+{
+namespace Transport
+{
+namespace REST
+{
+
+	/*!
+	** \brief Event-driven REST server (HTTP/1.1)
+	**
+	** An alternative to `REST::Server`, for a large number of connections: a few
+	** threads (reactors) serve all the connections with non-blocking sockets, instead
+	** of one thread per connection. The connections are kept alive (HTTP/1.1) and the
+	** pipelined requests are answered in order.
+	**
+	** \code
+	** Messaging::Service service;
+	** auto* transport = new Messaging::Transport::REST::EventServer();
+	** transport->reactorCount(2);
+	** service.transports.add("*", 6042, transport);
+	** \endcode
+	**
+	** The methods are invoked by the reactors themselves by default, the slow methods
+	** should rather be dispatched to `Service::heavyTasks` (see `dispatchToHeavyTasks()`),
+	** otherwise all the connections of the same reactor are waiting meanwhile.
+	**
+	** \note Only available on Linux (epoll), `start()` fails otherwise
+	*/
+	class EventServer final : public ITransport
+	{
+	public:
+		//! Opaque structure for Internal data related to the server
+		class ServerData;
+
+	public:
+		//! Default constructor
+		EventServer();
+		//! Destructor
+		virtual ~EventServer();
+
+		virtual Net::Error start() override;
+
+		virtual Net::Error run() override;
+
+		virtual void stop() override;
+
+		virtual void protocol(const Protocol& protocol) override;
+
+		//! \name Settings (used from the next start)
+		//@{
+		//! Set the number of threads serving the connections (0 for the number of CPU cores)
+		void reactorCount(uint count);
+		//! Get the number of threads serving the connections
+		uint reactorCount() const;
+
+		/*!
+		** \brief Set if the methods are invoked by `Service::heavyTasks` instead of the reactors (default: false)
+		**
+		** The heavy tasks must be enabled as well (`Service::heavyTasks.enabled()`), otherwise
+		** the methods are still invoked by the reactors.
+		*/
+		void dispatchToHeavyTasks(bool enabled);
+		//! Get if the methods are invoked by `Service::heavyTasks`
+		bool dispatchToHeavyTasks() const;
+
+		//! Set the delay (in seconds) before closing an idle connection (0 for no limit, default: 60)
+		void idleTimeout(uint seconds);
+		//! Get the delay before closing an idle connection
+		uint idleTimeout() const;
+
+		//! Set the maximum size of the headers and of the body of a request (default: 64KiB)
+		void maxRequestSize(uint bytes);
+		//! Get the maximum size of a request
+		uint maxRequestSize() const;
+		//@}
+
+	private:
+		//! Internal data
+		ServerData* pData;
+
+	}; // class EventServer
+
+
+
+
+
+} // namespace REST
+} // namespace Transport
+} // namespace Messaging
+} // namespace Yuni
+
+#endif // __YUNI_MESSAGING_TRANSPORT_REST_EVENT_SERVER_H__
@@ -1,6 +1,8 @@
+#include "decision-tree.inc.hpp"
 #include "../../../core/system/cpu.h"
 #include "../../../thread/id.h"
 #include <iostream>
+#include <cstring>
 
 
 
@@ -14,20 +16,6 @@ namespace Transport
 namespace REST
 {
 
-	enum RequestMethod
-	{
-		rqmdGET = 0,
-		rqmdPOST,
-		rqmdPUT,
-		rqmdDELETE,
-		rqmdInvalid,
-		rqmdMax
-	};
-
-	template<class StringT>
-	static RequestMethod StringToRequestMethod(const StringT& text);
-
-
 	template<class StringT>
 	static int inline mg_write(struct mg_connection* conn, const StringT& string)
 	{
@@ -36,42 +24,6 @@ namespace REST
 
 
 
-	class DecisionTree final
-	{
-	public:
-		//! The most suitable smart ptr for the class
-		typedef SmartPtr<DecisionTree> Ptr;
-
-		class MethodHandler final
-		{
-		public:
-			//! Name of the method invoked
-			String name;
-			//! Full schema name
-			String schema;
-			//! Method request (GET, POST, DELETE, PUT)
-			String httpMethod;
-			//! All parameters, with they default value
-			KeyValueStore parameters;
-			//!
-			API::Method::Callback invoke;
-
-		}; // class DecisionTree
-
-		//! Dictionary for all managed urls
-		typedef Dictionary<AnyString, MethodHandler>::Hash  UrlDictionary;
-
-
-	public:
-		//! Dictionary for all managed urls
-		UrlDictionary requestMethods[rqmdMax];
-		//! Container only used for storing string urls
-		std::set<String> mapset[rqmdMax];
-
-	}; // class DecisionTree
-
-
-
 	class Server::ServerData final
 	{
 	public:
@@ -92,7 +44,7 @@ namespace REST
 
 	public:
 		//! The decision tree
-		DecisionTree::Ptr decisionTree;
+		SharedDecisionTree decisionTree;
 
 		//! Signal for stopping the web server
 		Thread::Signal signal;
@@ -111,6 +63,11 @@ namespace REST
 		//! Service
 		Yuni::Messaging::Service* service;
 
+		//! Number of threads serving the requests
+		uint workerCount;
+		//! Size from which the responses are streamed (0 to disable)
+		uint streamingThreshold;
+
 	}; // class ServerData
 
 
@@ -123,7 +80,9 @@ namespace REST
 		options(nullptr),
 		optionCount(),
 		ctx(nullptr),
-		service(nullptr)
+		service(nullptr),
+		workerCount(1),
+		streamingThreshold(1024 * 1024)
 	{
 	}
 
@@ -167,40 +126,111 @@ namespace REST
 	}
 
 
-	template<class StringT>
-	static inline RequestMethod StringToRequestMethod(const StringT& text)
+	/*!
+	** \brief A JSON response, sent directly from the buffer of the serialization
+	**
+	** The headers and the body are sent with a single gather write. When the response
+	** is streamed, each chunk is sent (chunked transfer encoding) as soon as produced.
+	*/
+	class JSONResponse final
 	{
-		// note: we assume that `text` is zero-terminated
-		switch (text[0])
+	public:
+		JSONResponse(struct mg_connection* conn, Messaging::Context& context, uint statusCode) :
+			pConn(conn),
+			pContext(context),
+			pStatusCode(statusCode),
+			pStreaming(false)
+		{}
+
+		//! Send a chunk of the body (streaming)
+		bool chunk(const Clob& data)
 		{
-			case 'G':
-				{
-					// GET
-					if (text[1] == 'E' and text[2] == 'T' and text[3] == '\0')
-						return rqmdGET;
-					break;
-				}
-			case 'P':
-				{
-					// POST
-					if (text[1] == 'O' and text[2] == 'S' and text[3] == 'T' and text[4] == '\0')
-						return rqmdPOST;
-					// PUT
-					if (text[1] == 'U' and text[2] == 'T' and text[3] == '\0')
-						return rqmdPUT;
-					break;
-				}
-			case 'D':
+			struct mg_buffer buffers[4];
+			int count = 0;
+			if (not pStreaming)
+			{
+				pStreaming = true;
+				Clob& header = pContext.buffer;
+				header = pContext.httpStatusCode.header2xx[pStatusCode - 200];
+				header += "Content-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n";
+				buffers[count++] = { header.data(), header.size() };
+			}
+			prepareChunkSize(data.size());
+			buffers[count++] = { pChunkSize.data(), pChunkSize.size() };
+			buffers[count++] = { data.data(), data.size() };
+			buffers[count++] = { "\r\n", 2 };
+			return send(buffers, count);
+		}
+
+		//! Send the end of the body (or the whole response if not streamed)
+		bool finish(const Clob& data)
+		{
+			struct mg_buffer buffers[4];
+			int count = 0;
+			if (not pStreaming)
+			{
+				Clob& header = pContext.buffer;
+				header = pContext.httpStatusCode.header2xx[pStatusCode - 200];
+				header += "Content-Type: application/json\r\nContent-Length: ";
+				header += data.size();
+				header += "\r\n\r\n";
+				buffers[count++] = { header.data(), header.size() };
+				buffers[count++] = { data.data(), data.size() };
+			}
+			else
+			{
+				if (not data.empty())
 				{
-					// DELETE
-					if (text[1] == 'E' and text[2] == 'L' and text[3] == 'E' and text[4] == 'T'
-						and text[5] == 'E' and text[6] == '\0')
-							return rqmdDELETE;
-					break;
+					prepareChunkSize(data.size());
+					buffers[count++] = { pChunkSize.data(), pChunkSize.size() };
+					buffers[count++] = { data.data(), data.size() };
+					buffers[count++] = { "\r\n", 2 };
 				}
+				// last chunk
+				buffers[count++] = { "0\r\n\r\n", 5 };
+			}
+			return send(buffers, count);
 		}
-		return rqmdInvalid;
-	}
+
+	private:
+		//! Size of a chunk, in hexadecimal
+		void prepareChunkSize(uint size)
+		{
+			static const char* const digits = "0123456789abcdef";
+			char hex[8];
+			uint length = 0;
+			do
+			{
+				hex[length++] = digits[size & 0xF];
+				size >>= 4;
+			}
+			while (size != 0);
+
+			pChunkSize.clear();
+			while (length != 0)
+				pChunkSize += hex[--length];
+			pChunkSize.append("\r\n", 2);
+		}
+
+		bool send(const struct mg_buffer* buffers, int count)
+		{
+			size_t expected = 0;
+			for (int i = 0; i != count; ++i)
+				expected += buffers[i].len;
+			return mg_writev(pConn, buffers, count) == (int) expected;
+		}
+
+	private:
+		struct mg_connection* pConn;
+		Messaging::Context& pContext;
+		uint pStatusCode;
+		//! True if the response is streamed (the headers have been sent)
+		bool pStreaming;
+		//! Size of the current chunk
+		ShortString16 pChunkSize;
+
+	}; // class JSONResponse
+
 
 
 
@@ -233,72 +263,6 @@ namespace REST
 
 
 
-	static bool DecodeURLQuery(KeyValueStore& params, const AnyString& query)
-	{
-		// note: mongoose does not provide the fragment here, so we don't have
-		// to check it
-
-		// Some tests are already done before calling this method
-		assert(not query.empty());
-
-		String key; // temporary string for parameters handling
-		uint offset = 0;
-		uint start = 0;
-		AnyString value;
-		do
-		{
-			offset = query.find_first_of("=&", offset);
-			if (offset >= query.size())
-			{
-				// ignoring fields with empty value (using default)
-				break;
-			}
-			if (query[offset] == '=')
-			{
-				key.assign(query, offset - start, start);
-				if (key.empty()) // malformed url. aborting
-					return false;
-
-				++offset;
-
-				// FIXME !!!! &amp; are not properly handled !!!!!!!!!!!!
-				uint ampersand = offset;
-				ampersand = query.find('&', ampersand);
-				if (ampersand >= query.size())
-				{
-					value.adapt(query, query.size() - offset, offset);
-					ampersand = query.size();
-				}
-				else
-					value.adapt(query, ampersand - offset, offset);
-
-				if (not value.empty())
-				{
-					KeyValueStore::iterator i = params.find(key);
-					if (i != params.end())
-					{
-						// the item has been found !
-						params[key] = value;
-					}
-				}
-
-				offset = ampersand;
-			}
-			else
-			{
-				// ignoring fields with empty value (using default)
-			}
-
-			// updating offsets
-			start = ++offset;
-		}
-		while (true);
-		return true;
-	}
-
-
-
-
 	static void* TransportRESTCallback(enum mg_event event, struct mg_connection* conn)
 	{
 		// Serving a new request
@@ -310,84 +274,95 @@ namespace REST
 			const mg_request_info& reqinfo = *mg_get_request_info(conn);
 			assert(reqinfo.user_data != NULL and "invalid user data");
 
+			// server data
+			Server::ServerData* serverdata = (Server::ServerData*) reqinfo.user_data;
+
+			// Original service instance
+			Service& service = *(serverdata->service);
+			assert(serverdata->service != NULL and "invalid reference to Messaging::Service");
+			// Message context, reused by the thread from one request to another
+			WorkerContext& worker = LocalWorkerContext(service);
+			Messaging::Context& context = worker.context;
+
+			// timing of the request, if the statistics are enabled
+			Statistics::Sample sample;
+			sample.start(service.statistics);
+
 			// retrieving the request method first
 			// and directly aborting if invalid
 			RequestMethod rqmd = StringToRequestMethod(reqinfo.request_method);
 			if (rqmd == rqmdInvalid)
+			{
+				worker.recordNotFound(sample);
 				return ReturnSimpleHTTPCode404(conn);
-
-			// server data
-			Server::ServerData* serverdata = (Server::ServerData*) reqinfo.user_data;
+			}
 
 			// Decision Tree
 			// For thread safety reasons, we must keep a smart pointer of the decision tree
-			// until the request is served.
-			DecisionTree::Ptr dectreeptr = serverdata->decisionTree;
+			// until the request is served (cached by the thread)
+			const DecisionTree::Ptr& dectreeptr = worker.decisionTree(serverdata->decisionTree);
 			assert(!(!dectreeptr));
-			const DecisionTree::UrlDictionary& urls = dectreeptr->requestMethods[rqmd];
 
 			// invoking the user's callback according the decision tree
-			DecisionTree::UrlDictionary::const_iterator mi = urls.find(reqinfo.uri);
-			if (mi == urls.end())
+			DecisionTree::Match match;
+			if (not dectreeptr->find(match, rqmd, AnyString(reqinfo.uri)))
 			{
 				// the url has not been found
+				worker.recordNotFound(sample);
 				return ReturnSimpleHTTPCode404(conn);
 			}
-			// alias to the method handler
-			const DecisionTree::MethodHandler& mhandler = mi->second;
-
+			sample.stage(Statistics::Stage::route);
 
-			// Original service instance
-			Service& service = *(serverdata->service);
-			assert(serverdata->service != NULL and "invalid reference to Messaging::Service");
-			// Message context
-			Messaging::Context context(service);
-
-			// reading / checking for parameters
-			if (not mhandler.parameters.empty())
-			{
-				// copying all default parameters
-				context.params = mhandler.parameters;
-
-				// reading parameters from the url query
-				// ignoring unknown parameters
-				if (reqinfo.query_string and reqinfo.query_string[0] != '\0')
-				{
-					if (not DecodeURLQuery(context.params, reqinfo.query_string))
-						return ReturnSimpleHTTPCode<400>(conn, context);
-				}
-			}
-
-			// resetting context
-			context.method = mhandler.name;
-			context.schema = mhandler.schema;
-			context.httpStatus = 200;
-			context.remotePort = (uint)reqinfo.remote_port;
 			// response
 			Marshal::Object response;
 
 			// Invoke user callback
-			mhandler.invoke(context, response);
+			if (not worker.invoke(dectreeptr, match, (reqinfo.query_string ? AnyString(reqinfo.query_string) : AnyString()),
+				(uint) reqinfo.remote_port, response, sample))
+			{
+				worker.release();
+				ReturnSimpleHTTPCode<400>(conn, context);
+				sample.stage(Statistics::Stage::write);
+				worker.record(*match.handler, sample, 400);
+				return (void*)"ok";
+			}
 
 
 			// sending the response
 			uint statusCode = context.httpStatus;
 			if  (statusCode >= 200 and statusCode <= context.httpStatusCode.max2xx)
 			{
-				Clob& body = context.clob;
 				# ifndef NDEBUG
-				response.toJSON(body, true);
+				const bool pretty = true;
 				# else
-				response.toJSON(body, false); // reduce size output
+				const bool pretty = false; // reduce size output
 				# endif
 
-				Clob& out  = context.buffer;
-				out = context.httpStatusCode.header2xx[statusCode - 200];
-				out += "Content-Type: application/json\r\nContent-Length: ";
-				out += body.size();
-				out += "\r\n\r\n";
-				out += body;
-				mg_write(conn, out.c_str(), out.size());
+				// the body is sent directly from the buffer of the serialization
+				Clob& body = context.clob;
+				JSONResponse writer(conn, context, statusCode);
+				uint threshold = serverdata->streamingThreshold;
+				// the chunked transfer encoding is not available with HTTP/1.0
+				if (threshold != 0 and (not reqinfo.http_version or ::strcmp(reqinfo.http_version, "1.0") != 0))
+				{
+					bool succeeded = response.toJSON(body, [&writer, &sample](Clob& data) -> bool
+					{
+						sample.stage(Statistics::Stage::serialize);
+						bool sent = writer.chunk(data);
+						sample.stage(Statistics::Stage::write);
+						return sent;
+					}, threshold, pretty);
+					sample.stage(Statistics::Stage::serialize);
+					if (succeeded)
+						writer.finish(body);
+				}
+				else
+				{
+					response.toJSON(body, pretty);
+					sample.stage(Statistics::Stage::serialize);
+					writer.finish(body);
+				}
+				sample.stage(Statistics::Stage::write);
 
 				// reducing memory usage for some Memory-hungry apps
 				context.autoshrink();
@@ -398,13 +373,18 @@ namespace REST
 				context.autoshrink();
 				// response
 				mg_write(conn, context.httpStatusCode.response4xx[statusCode - 400]);
+				sample.stage(Statistics::Stage::write);
 			}
 			else
 			{
 				// not handled by default
 				mg_write(conn, context.httpStatusCode.response5xx[500 - 500]);
+				sample.stage(Statistics::Stage::write);
+				statusCode = 500;
 			}
 
+			worker.release();
+			worker.record(*match.handler, sample, statusCode);
 			return (void*)"ok";
 		}
 
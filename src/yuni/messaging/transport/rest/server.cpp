@@ -16,7 +16,6 @@
 #endif
 #include "../../../private/net/messaging/transport/rest/mongoose.h"
 #include "request.inc.hpp"
-#include "../../../io/filename-manipulation.h"
 
 
 namespace Yuni
@@ -33,6 +32,7 @@ namespace REST
 		ITransport(tmServer)
 	{
 		pData = new ServerData();
+		workerCount(0);
 	}
 
 
@@ -59,7 +59,7 @@ namespace REST
 		pData->signal.reset();
 
 		// re-create mongoose options
-		pData->prepareOptionsForMongoose(port, 4);
+		pData->prepareOptionsForMongoose(port, pData->workerCount);
 
 		// starting mongoose
 		pData->ctx = mg_start(& TransportRESTCallback, pData, pData->options);
@@ -123,88 +123,40 @@ namespace REST
 	}
 
 
-	void Server::protocol(const Protocol& protocol)
+	void Server::workerCount(uint count)
 	{
-		DecisionTree* decisionTree = new DecisionTree();
-		String url;
-		String tmp;
-		String httpMethod;
-
-		// walking through all schemas
-		const Schema::Hash& allSchemas = protocol.allSchemas();
-		Schema::Hash::const_iterator end = allSchemas.end();
-		for (Schema::Hash::const_iterator i = allSchemas.begin(); i != end; ++i)
-		{
-			// relative path access
-			const String& schemaName = i->first;
-			// alias to the current schema
-			const Schema& schema = i->second;
+		assert(pData and "internal error");
+		pData->workerCount = (count != 0) ? count : System::CPU::Count();
+		if (pData->workerCount == 0)
+			pData->workerCount = 1;
+	}
+
+
+	uint Server::workerCount() const
+	{
+		assert(pData and "internal error");
+		return pData->workerCount;
+	}
 
-			API::Method::Hash::const_iterator jend = schema.methods.all().end();
-			for (API::Method::Hash::const_iterator j = schema.methods.all().begin(); j != jend; ++j)
-			{
-				const API::Method& method = j->second;
-
-				// The method will be ignored is no callback has been provided
-				if (not method.invoke())
-					continue;
-
-				httpMethod = method.option("http.method");
-				// using const char* to avoid assert from Yuni::String
-				RequestMethod rqmd = StringToRequestMethod(httpMethod.c_str());
-				if (rqmd == rqmdInvalid)
-					rqmd = rqmdGET;
-
-				// the full url
-				tmp.clear() << '/' << schemaName << '/' << method.name();
-				IO::Normalize(url, tmp);
-
-				// keeping the url somewhere
-				// IMPORTANT: read notes about how urls are stored
-				std::set<String>& mapset = decisionTree->mapset[rqmd];
-				mapset.insert(url);
-				// retrieving the real pointer to the string
-				std::set<String>::const_iterator mapi = mapset.find(url);
-				AnyString urlstr = *mapi;
-
-				// alias to the corresponding method handler
-				DecisionTree::MethodHandler& mhandler = decisionTree->requestMethods[rqmd][urlstr];
-
-				mhandler.schema = schemaName;
-				mhandler.name = method.name();
-				mhandler.httpMethod = httpMethod;
-				mhandler.invoke = method.invoke();
-
-				// copying parameters
-				const API::Method::Parameter::Hash& parameters = method.params();
-				if (not parameters.empty())
-				{
-					API::Method::Parameter::Hash::const_iterator pend = parameters.end();
-					API::Method::Parameter::Hash::const_iterator pi = parameters.begin();
-					for (; pi != pend; ++pi)
-					{
-						const API::Method::Parameter& param = pi->second;
-						if (param.hasDefault)
-						{
-							mhandler.parameters[param.name] = param.defvalue;
-						}
-						else
-						{
-							API::Method::Parameter::Hash::const_iterator defit = schema.defaults.params().find(param.name);
-							if (defit != schema.defaults.params().end())
-								mhandler.parameters[param.name] = defit->second.defvalue;
-							else
-								mhandler.parameters[param.name].clear();
-						}
-					}
-				}
-				else
-					mhandler.parameters.clear();
-			}
-		}
 
+	void Server::streamingThreshold(uint bytes)
+	{
+		assert(pData and "internal error");
+		pData->streamingThreshold = bytes;
+	}
+
+
+	uint Server::streamingThreshold() const
+	{
+		assert(pData and "internal error");
+		return pData->streamingThreshold;
+	}
+
+
+	void Server::protocol(const Protocol& protocol)
+	{
 		// Switching to the new protocol
-		pData->decisionTree = decisionTree;
+		pData->decisionTree.reset(new DecisionTree(protocol, pService->statistics));
 	}
 
 
@@ -43,6 +43,22 @@ namespace REST
 
 		virtual void protocol(const Protocol& protocol) override;
 
+		//! Set the number of threads serving the requests (0 for the number of CPU cores, used from the next start)
+		void workerCount(uint count);
+		//! Get the number of threads serving the requests
+		uint workerCount() const;
+
+		/*!
+		** \brief Set the size from which the responses are streamed while being generated
+		**
+		** Larger responses are sent by chunks (chunked transfer encoding) while the JSON
+		** is being produced, thus the memory used by a request remains bounded (0 to disable,
+		** default: 1MiB). Ignored for HTTP/1.0 clients.
+		*/
+		void streamingThreshold(uint bytes);
+		//! Get the size from which the responses are streamed while being generated
+		uint streamingThreshold() const;
+
 	private:
 		void wait();
 
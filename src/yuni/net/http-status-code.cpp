@@ -32,8 +32,11 @@ namespace Net
 			case 402: return "PaymentRequired";
 			case 403: return "Forbidden";
 			case 404: return "Not found";
+			case 413: return "Payload too large";
 			// 5xx
 			case 500: return "Internal Error";
+			case 501: return "Not implemented";
+			case 505: return "HTTP version not supported";
 		}
 		return nullptr;
 	}
@@ -1023,12 +1023,14 @@ namespace // anonymous
 
 	bool Grammar::loadFromFile(const AnyString& filename)
 	{
-		Clob content;
-		if (IO::errNone != IO::File::LoadFromFile(content, filename))
+		// the grammar is parsed directly from the mapped file (no copy)
+		IO::File::MappedView content;
+		if (IO::errNone != content.open(filename))
 			return false;
+		content.advise(IO::File::Advice::sequential);
 
 		// try to load the grammar file
-		return loadFromData(content, filename);
+		return loadFromData(content.content(), filename);
 	}
 
 
@@ -0,0 +1,94 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+// This file is compiled with AVX2 enabled when the compiler supports it (see core.cmake).
+// Its kernels must only be called after checking the CPU (see SearchKernelsFor())
+#include "search.h"
+#ifdef __AVX2__
+#	include "search-kernels.hxx"
+#	include "search-sse2.hxx"
+#	include <immintrin.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	# ifdef __AVX2__
+	namespace // anonymous
+	{
+
+		struct AVX2 final
+		{
+			typedef __m256i Reg;
+			enum { width = 32 };
+
+			static inline Reg Zero() { return _mm256_setzero_si256(); }
+			static inline Reg Load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+			static inline Reg Set1(char c) { return _mm256_set1_epi8(c); }
+			static inline Reg Eq(Reg a, Reg b) { return _mm256_cmpeq_epi8(a, b); }
+			static inline Reg Or(Reg a, Reg b) { return _mm256_or_si256(a, b); }
+			static inline Reg And(Reg a, Reg b) { return _mm256_and_si256(a, b); }
+			static inline Reg Sub(Reg a, Reg b) { return _mm256_sub_epi8(a, b); }
+			static inline uint Mask(Reg a) { return static_cast<uint>(_mm256_movemask_epi8(a)); }
+
+			static inline uint SumBytes(Reg a)
+			{
+				Reg sums = _mm256_sad_epu8(a, _mm256_setzero_si256());
+				__m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+				return static_cast<uint>(_mm_cvtsi128_si32(half) + _mm_cvtsi128_si32(_mm_srli_si128(half, 8)));
+			}
+
+			static inline Reg Lower(Reg a)
+			{
+				// 'A'..'Z' are moved to -128..-103 for a signed comparison
+				Reg upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), _mm256_add_epi8(a, _mm256_set1_epi8(128 - 'A')));
+				return _mm256_or_si256(a, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+			}
+		};
+
+		//! 256-bit vectors, then 128-bit ones for the remaining bytes
+		typedef Search<AVX2, Search<SSE2, Scalar> > SearchAVX2;
+
+		const SearchKernels avx2Kernels =
+		{
+			"avx2",
+			&SearchAVX2::FindChar,
+			&SearchAVX2::IFindChar,
+			&SearchAVX2::FindFirstOf,
+			&SearchAVX2::Find,
+			&IFindWith<SearchAVX2>,
+			&SearchAVX2::CountChar,
+		};
+
+	} // anonymous namespace
+	# endif
+
+
+	const SearchKernels* SearchKernelsAVX2()
+	{
+		# ifdef __AVX2__
+		return &avx2Kernels;
+		# else
+		return nullptr;
+		# endif
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
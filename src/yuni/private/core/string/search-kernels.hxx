@@ -0,0 +1,420 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "search.h"
+#include <string.h>
+#ifdef YUNI_OS_MSVC
+#	include <intrin.h>
+#endif
+
+/*
+** Generic implementation of the search primitives, for a given vector type.
+**
+** This file is included by each translation unit providing kernels for a given
+** instruction set (each one compiled with its own flags). Everything is local to
+** the translation unit (anonymous namespace), to not mix the code generated for
+** distinct instruction sets at link time.
+**
+** A vector type `V` must provide:
+**  - `Reg`, the type of a register, and `width`, its size in bytes
+**  - `Load(p)` (unaligned), `Set1(c)`, `Eq(a, b)`, `Or(a, b)`, `And(a, b)`
+**  - `Lower(a)`, folding ASCII letters to lowercase
+**  - `Mask(a)`, one bit per byte (the most significant one)
+**  - `Zero()`, `Sub(a, b)` and `SumBytes(a)` (sum of all unsigned bytes)
+**
+** The haystack is never read beyond its end: the remaining bytes which do not
+** fill a whole register are handled by the next implementation (or an overlapping load).
+*/
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+namespace // anonymous
+{
+
+	//! Index of the lowest bit set (`mask` must not be null)
+	inline uint LowestBit(uint mask)
+	{
+		# ifdef YUNI_OS_MSVC
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<uint>(index);
+		# else
+		return static_cast<uint>(__builtin_ctz(mask));
+		# endif
+	}
+
+
+	//! ASCII lowercase (see CString::ToLower())
+	inline char LowerASCII(char c)
+	{
+		return (static_cast<uint>(static_cast<uchar>(c)) - 'A' < 26u) ? static_cast<char>(c | 32) : c;
+	}
+
+
+	//! Compare two buffers, ASCII case-insensitive (`b` must be lowercase)
+	inline bool EqualsLowerASCII(const char* a, const char* b, uint len)
+	{
+		for (uint i = 0; i != len; ++i)
+		{
+			if (LowerASCII(a[i]) != b[i])
+				return false;
+		}
+		return true;
+	}
+
+
+	//! Find any byte from a set, with a lookup table (for large sets)
+	inline const char* FindFirstOfTable(const char* s, uint len, const char* set, uint setlen)
+	{
+		uint table[256 / 32] = {0, 0, 0, 0, 0, 0, 0, 0};
+		for (uint j = 0; j != setlen; ++j)
+		{
+			uint c = static_cast<uchar>(set[j]);
+			table[c >> 5] |= (1u << (c & 31));
+		}
+		for (uint i = 0; i != len; ++i)
+		{
+			uint c = static_cast<uchar>(s[i]);
+			if (table[c >> 5] & (1u << (c & 31)))
+				return s + i;
+		}
+		return nullptr;
+	}
+
+
+
+
+	/*!
+	** \brief Portable implementation (also used for the bytes remaining after the vector kernels)
+	*/
+	struct Scalar final
+	{
+		static const char* FindChar(const char* s, uint len, char c)
+		{
+			// the C library usually provides an optimized implementation
+			return (len) ? static_cast<const char*>(::memchr(s, c, len)) : nullptr;
+		}
+
+
+		static const char* IFindChar(const char* s, uint len, char c)
+		{
+			for (uint i = 0; i != len; ++i)
+			{
+				if (LowerASCII(s[i]) == c)
+					return s + i;
+			}
+			return nullptr;
+		}
+
+
+		static const char* FindFirstOf(const char* s, uint len, const char* set, uint setlen)
+		{
+			if (setlen == 1)
+				return FindChar(s, len, *set);
+			if (len > 64)
+				return FindFirstOfTable(s, len, set, setlen);
+			for (uint i = 0; i != len; ++i)
+			{
+				if (nullptr != ::memchr(set, s[i], setlen))
+					return s + i;
+			}
+			return nullptr;
+		}
+
+
+		static const char* Find(const char* s, uint len, const char* needle, uint nlen)
+		{
+			if (nlen > len)
+				return nullptr;
+			const char* const last = s + (len - nlen);
+			while (s <= last)
+			{
+				s = static_cast<const char*>(::memchr(s, *needle, static_cast<size_t>(last - s) + 1));
+				if (not s)
+					return nullptr;
+				if (0 == ::memcmp(s + 1, needle + 1, nlen - 1))
+					return s;
+				++s;
+			}
+			return nullptr;
+		}
+
+
+		static const char* IFindLower(const char* s, uint len, const char* lower, uint nlen)
+		{
+			if (nlen > len)
+				return nullptr;
+			const uint starts = len - nlen + 1;
+			for (uint i = 0; i != starts; ++i)
+			{
+				if (LowerASCII(s[i]) == lower[0] and EqualsLowerASCII(s + i + 1, lower + 1, nlen - 1))
+					return s + i;
+			}
+			return nullptr;
+		}
+
+
+		static uint CountChar(const char* s, uint len, char c)
+		{
+			uint count = 0;
+			for (uint i = 0; i != len; ++i)
+			{
+				if (s[i] == c)
+					++count;
+			}
+			return count;
+		}
+
+	}; // struct Scalar
+
+
+
+
+	/*!
+	** \brief Implementation for a given vector type
+	**
+	** \tparam V The vector type
+	** \tparam Next The implementation for the bytes which do not fill a whole vector
+	*/
+	template<class V, class Next>
+	struct Search final
+	{
+		typedef typename V::Reg Reg;
+		enum { width = V::width };
+
+
+		static const char* FindChar(const char* s, uint len, char c)
+		{
+			if (len < static_cast<uint>(width))
+				return Next::FindChar(s, len, c);
+
+			const Reg needle = V::Set1(c);
+			uint i = 0;
+			// 4 vectors per iteration, checked at once
+			for (; i + 4 * width <= len; i += 4 * width)
+			{
+				Reg m0 = V::Eq(V::Load(s + i), needle);
+				Reg m1 = V::Eq(V::Load(s + i + width), needle);
+				Reg m2 = V::Eq(V::Load(s + i + 2 * width), needle);
+				Reg m3 = V::Eq(V::Load(s + i + 3 * width), needle);
+				if (V::Mask(V::Or(V::Or(m0, m1), V::Or(m2, m3))))
+				{
+					uint mask;
+					if ((mask = V::Mask(m0)) != 0)
+						return s + i + LowestBit(mask);
+					if ((mask = V::Mask(m1)) != 0)
+						return s + i + width + LowestBit(mask);
+					if ((mask = V::Mask(m2)) != 0)
+						return s + i + 2 * width + LowestBit(mask);
+					return s + i + 3 * width + LowestBit(V::Mask(m3));
+				}
+			}
+			for (; i + width <= len; i += width)
+			{
+				uint mask = V::Mask(V::Eq(V::Load(s + i), needle));
+				if (mask)
+					return s + i + LowestBit(mask);
+			}
+			if (i != len)
+			{
+				// the last bytes, with an overlapping load (the previous ones have been checked)
+				i = len - width;
+				uint mask = V::Mask(V::Eq(V::Load(s + i), needle));
+				if (mask)
+					return s + i + LowestBit(mask);
+			}
+			return nullptr;
+		}
+
+
+		static const char* IFindChar(const char* s, uint len, char c)
+		{
+			if (len < static_cast<uint>(width))
+				return Next::IFindChar(s, len, c);
+
+			const Reg needle = V::Set1(c);
+			uint i = 0;
+			for (; i + width <= len; i += width)
+			{
+				uint mask = V::Mask(V::Eq(V::Lower(V::Load(s + i)), needle));
+				if (mask)
+					return s + i + LowestBit(mask);
+			}
+			if (i != len)
+			{
+				i = len - width;
+				uint mask = V::Mask(V::Eq(V::Lower(V::Load(s + i)), needle));
+				if (mask)
+					return s + i + LowestBit(mask);
+			}
+			return nullptr;
+		}
+
+
+		static const char* FindFirstOf(const char* s, uint len, const char* set, uint setlen)
+		{
+			// large sets are better handled by a lookup table
+			if (setlen > 16)
+				return FindFirstOfTable(s, len, set, setlen);
+			if (setlen == 1)
+				return FindChar(s, len, *set);
+			if (len < static_cast<uint>(width))
+				return Next::FindFirstOf(s, len, set, setlen);
+
+			Reg needles[16];
+			for (uint j = 0; j != setlen; ++j)
+				needles[j] = V::Set1(set[j]);
+
+			uint i = 0;
+			for (; ; i += width)
+			{
+				if (i + width > len)
+				{
+					if (i == len)
+						return nullptr;
+					// the last bytes, with an overlapping load
+					i = len - width;
+				}
+				const Reg block = V::Load(s + i);
+				Reg matches = V::Eq(block, needles[0]);
+				for (uint j = 1; j != setlen; ++j)
+					matches = V::Or(matches, V::Eq(block, needles[j]));
+				uint mask = V::Mask(matches);
+				if (mask)
+					return s + i + LowestBit(mask);
+				if (i + width == len)
+					return nullptr;
+			}
+		}
+
+
+		static const char* Find(const char* s, uint len, const char* needle, uint nlen)
+		{
+			if (nlen > len)
+				return nullptr;
+			if (nlen == 1)
+				return FindChar(s, len, *needle);
+
+			// Filtering the candidates on their first and last bytes, then
+			// comparing the remaining ones (SIMD-friendly substring search)
+			const uint starts = len - nlen + 1;
+			uint i = 0;
+			if (starts >= static_cast<uint>(width))
+			{
+				const Reg vfirst = V::Set1(needle[0]);
+				const Reg vlast  = V::Set1(needle[nlen - 1]);
+				for (; i + width <= starts; i += width)
+				{
+					uint mask = V::Mask(V::And(
+						V::Eq(V::Load(s + i), vfirst),
+						V::Eq(V::Load(s + i + nlen - 1), vlast)));
+					while (mask)
+					{
+						uint candidate = i + LowestBit(mask);
+						if (0 == ::memcmp(s + candidate + 1, needle + 1, nlen - 2))
+							return s + candidate;
+						mask &= mask - 1;
+					}
+				}
+			}
+			return Next::Find(s + i, len - i, needle, nlen);
+		}
+
+
+		static const char* IFindLower(const char* s, uint len, const char* lower, uint nlen)
+		{
+			if (nlen > len)
+				return nullptr;
+			if (nlen == 1)
+				return IFindChar(s, len, *lower);
+
+			const uint starts = len - nlen + 1;
+			uint i = 0;
+			if (starts >= static_cast<uint>(width))
+			{
+				const Reg vfirst = V::Set1(lower[0]);
+				const Reg vlast  = V::Set1(lower[nlen - 1]);
+				for (; i + width <= starts; i += width)
+				{
+					uint mask = V::Mask(V::And(
+						V::Eq(V::Lower(V::Load(s + i)), vfirst),
+						V::Eq(V::Lower(V::Load(s + i + nlen - 1)), vlast)));
+					while (mask)
+					{
+						uint candidate = i + LowestBit(mask);
+						if (EqualsLowerASCII(s + candidate + 1, lower + 1, nlen - 2))
+							return s + candidate;
+						mask &= mask - 1;
+					}
+				}
+			}
+			return Next::IFindLower(s + i, len - i, lower, nlen);
+		}
+
+
+		static uint CountChar(const char* s, uint len, char c)
+		{
+			uint count = 0;
+			uint i = 0;
+			if (len >= static_cast<uint>(width))
+			{
+				const Reg needle = V::Set1(c);
+				while (i + width <= len)
+				{
+					// one counter per byte (a match is -1), at most 255 rounds before overflowing
+					Reg counters = V::Zero();
+					uint rounds = 0;
+					for (; i + width <= len and rounds != 255; i += width, ++rounds)
+						counters = V::Sub(counters, V::Eq(V::Load(s + i), needle));
+					count += V::SumBytes(counters);
+				}
+			}
+			return count + Next::CountChar(s + i, len - i, c);
+		}
+
+	}; // struct Search
+
+
+
+
+	//! Find a substring, ASCII case-insensitive, with a given implementation
+	template<class S>
+	const char* IFindWith(const char* s, uint len, const char* needle, uint nlen)
+	{
+		if (nlen > len)
+			return nullptr;
+
+		// the needle, lowercase
+		char stackbuffer[64];
+		char* lower = (nlen <= sizeof(stackbuffer)) ? stackbuffer : new char[nlen];
+		for (uint j = 0; j != nlen; ++j)
+			lower[j] = LowerASCII(needle[j]);
+
+		const char* result = S::IFindLower(s, len, lower, nlen);
+
+		if (lower != stackbuffer)
+			delete[] lower;
+		return result;
+	}
+
+
+
+
+} // anonymous namespace
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,61 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "search-kernels.hxx"
+#include <emmintrin.h>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+namespace // anonymous
+{
+
+	//! 128-bit vectors (see search-kernels.hxx)
+	struct SSE2 final
+	{
+		typedef __m128i Reg;
+		enum { width = 16 };
+
+		static inline Reg Zero() { return _mm_setzero_si128(); }
+		static inline Reg Load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+		static inline Reg Set1(char c) { return _mm_set1_epi8(c); }
+		static inline Reg Eq(Reg a, Reg b) { return _mm_cmpeq_epi8(a, b); }
+		static inline Reg Or(Reg a, Reg b) { return _mm_or_si128(a, b); }
+		static inline Reg And(Reg a, Reg b) { return _mm_and_si128(a, b); }
+		static inline Reg Sub(Reg a, Reg b) { return _mm_sub_epi8(a, b); }
+		static inline uint Mask(Reg a) { return static_cast<uint>(_mm_movemask_epi8(a)); }
+
+		static inline uint SumBytes(Reg a)
+		{
+			Reg sums = _mm_sad_epu8(a, _mm_setzero_si128());
+			return static_cast<uint>(_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+		}
+
+		static inline Reg Lower(Reg a)
+		{
+			// 'A'..'Z' are moved to -128..-103 for a signed comparison
+			Reg upper = _mm_cmplt_epi8(_mm_add_epi8(a, _mm_set1_epi8(128 - 'A')), _mm_set1_epi8(-128 + 26));
+			return _mm_or_si128(a, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		}
+	};
+
+
+
+
+} // anonymous namespace
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
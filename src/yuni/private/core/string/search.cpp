@@ -0,0 +1,155 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "search.h"
+#include "search-kernels.hxx"
+#include "../../../core/string/traits/traits.h"
+#if defined(__x86_64__) || defined(_M_X64)
+#	define YUNI_STRING_SEARCH_SSE2
+#	include "search-sse2.hxx"
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	namespace // anonymous
+	{
+
+		const SearchKernels scalarKernels =
+		{
+			"scalar",
+			&Scalar::FindChar,
+			&Scalar::IFindChar,
+			&Scalar::FindFirstOf,
+			&Scalar::Find,
+			&IFindWith<Scalar>,
+			&Scalar::CountChar,
+		};
+
+
+		# ifdef YUNI_STRING_SEARCH_SSE2
+		typedef Search<SSE2, Scalar> SearchSSE2;
+
+		const SearchKernels sse2Kernels =
+		{
+			"sse2",
+			&SearchSSE2::FindChar,
+			&SearchSSE2::IFindChar,
+			&SearchSSE2::FindFirstOf,
+			&SearchSSE2::Find,
+			&IFindWith<SearchSSE2>,
+			&SearchSSE2::CountChar,
+		};
+		# endif
+
+
+		const SearchKernels& SelectSearchKernels()
+		{
+			const SearchKernels* kernels = SearchKernelsFor(SearchISA::avx2);
+			if (not kernels)
+				kernels = SearchKernelsFor(SearchISA::sse2);
+			return (kernels) ? *kernels : scalarKernels;
+		}
+
+	} // anonymous namespace
+
+
+
+
+	bool CPUHasAVX2()
+	{
+		# if defined(YUNI_STRING_SEARCH_SSE2) && (defined(YUNI_OS_GCC) || defined(YUNI_OS_CLANG))
+		__builtin_cpu_init();
+		return 0 != __builtin_cpu_supports("avx2");
+		# elif defined(__AVX2__)
+		return true; // the whole program requires AVX2 anyway
+		# else
+		return false;
+		# endif
+	}
+
+
+	const SearchKernels* SearchKernelsFor(SearchISA isa)
+	{
+		switch (isa)
+		{
+			case SearchISA::scalar:
+				return &scalarKernels;
+			case SearchISA::sse2:
+			{
+				# ifdef YUNI_STRING_SEARCH_SSE2
+				return &sse2Kernels;
+				# else
+				return nullptr;
+				# endif
+			}
+			case SearchISA::avx2:
+				return (CPUHasAVX2()) ? SearchKernelsAVX2() : nullptr;
+		}
+		return nullptr;
+	}
+
+
+	const SearchKernels& BestSearchKernels()
+	{
+		static const SearchKernels& kernels = SelectSearchKernels();
+		return kernels;
+	}
+
+
+
+
+	const char* FindChar(const char* s, uint len, char c)
+	{
+		return BestSearchKernels().findChar(s, len, c);
+	}
+
+
+	const char* IFindChar(const char* s, uint len, char c)
+	{
+		return BestSearchKernels().ifindChar(s, len, LowerASCII(c));
+	}
+
+
+	const char* FindFirstOf(const char* s, uint len, const char* set, uint setlen)
+	{
+		return (setlen) ? BestSearchKernels().findFirstOf(s, len, set, setlen) : nullptr;
+	}
+
+
+	const char* Find(const char* s, uint len, const char* needle, uint nlen)
+	{
+		return (nlen) ? BestSearchKernels().find(s, len, needle, nlen) : nullptr;
+	}
+
+
+	const char* IFind(const char* s, uint len, const char* needle, uint nlen)
+	{
+		return (nlen) ? BestSearchKernels().ifind(s, len, needle, nlen) : nullptr;
+	}
+
+
+	uint CountChar(const char* s, uint len, char c)
+	{
+		return BestSearchKernels().countChar(s, len, c);
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,85 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	//! Instruction sets available for the search primitives
+	enum class SearchISA
+	{
+		//! Portable implementation
+		scalar,
+		//! SSE2 (x86-64 only, always available)
+		sse2,
+		//! AVX2 (x86-64 only, detected at runtime)
+		avx2,
+	};
+
+
+	/*!
+	** \brief Search primitives for a given instruction set
+	**
+	** All kernels return a pointer to the first match within the haystack `s`
+	** of `len` bytes, or null if not found. `s` may be null when `len` is 0.
+	** The case-insensitive kernels only fold ASCII letters (like CString::ToLower())
+	** and expect an already lowercase character.
+	*/
+	struct SearchKernels final
+	{
+		//! Name of the instruction set
+		const char* name;
+		//! Find a single byte
+		const char* (*findChar)(const char* s, uint len, char c);
+		//! Find a single byte (ASCII case-insensitive, `c` lowercase)
+		const char* (*ifindChar)(const char* s, uint len, char c);
+		//! Find any byte from a set (`setlen` > 0)
+		const char* (*findFirstOf)(const char* s, uint len, const char* set, uint setlen);
+		//! Find a substring (`nlen` > 0)
+		const char* (*find)(const char* s, uint len, const char* needle, uint nlen);
+		//! Find a substring (ASCII case-insensitive, `nlen` > 0)
+		const char* (*ifind)(const char* s, uint len, const char* needle, uint nlen);
+		//! Count the occurrences of a single byte
+		uint (*countChar)(const char* s, uint len, char c);
+	};
+
+
+	/*!
+	** \brief Get the search primitives for a given instruction set
+	**
+	** \return The kernels, or null if the instruction set is not supported by the CPU
+	**   or was not available at compile time
+	*/
+	YUNI_DECL const SearchKernels* SearchKernelsFor(SearchISA isa);
+
+	//! Get the fastest search primitives for the current CPU (selected once)
+	YUNI_DECL const SearchKernels& BestSearchKernels();
+
+
+	//! AVX2 kernels (see search-avx2.cpp, null if not compiled in)
+	const SearchKernels* SearchKernelsAVX2();
+
+	//! Get if the CPU (and the OS) supports AVX2
+	bool CPUHasAVX2();
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
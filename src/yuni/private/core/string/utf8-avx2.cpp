@@ -0,0 +1,333 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+// This file is compiled with AVX2 enabled when the compiler supports it (see core.cmake).
+// Its kernels must only be called after checking the CPU (see UTF8KernelsFor())
+#include "utf8.h"
+#ifdef __AVX2__
+#	include "utf8-kernels.hxx"
+#	include <immintrin.h>
+#	include <string.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	# ifdef __AVX2__
+	namespace // anonymous
+	{
+
+		/*
+		** Validation with lookup tables ("Validating UTF-8 In Less Than One
+		** Instruction Per Byte", J. Keiser, D. Lemire)
+		**
+		** Each pair of consecutive bytes is classified from 3 nibbles (the high and
+		** low nibbles of the first byte, the high nibble of the second one). The
+		** errors found by 3 table lookups (too short, too long, overlong, surrogate,
+		** too large, two continuations) are combined with a bitwise AND, and the
+		** 3rd / 4th continuation bytes are checked against the leads 2 and 3 bytes before.
+		*/
+		enum : uint8
+		{
+			tooShort     = 1 << 0, // lead byte or ASCII followed by a lead byte or ASCII
+			tooLong      = 1 << 1, // ASCII followed by a continuation byte
+			overlong3    = 1 << 2,
+			tooLarge     = 1 << 3,
+			surrogate    = 1 << 4,
+			overlong2    = 1 << 5,
+			tooLarge1000 = 1 << 6,
+			overlong4    = 1 << 6,
+			twoConts     = 1 << 7, // two continuation bytes
+			carry        = tooShort | tooLong | twoConts,
+		};
+
+
+		inline __m256i Lookup16(__m256i index, char t0, char t1, char t2, char t3, char t4, char t5, char t6,
+			char t7, char t8, char t9, char t10, char t11, char t12, char t13, char t14, char t15)
+		{
+			return _mm256_shuffle_epi8(_mm256_setr_epi8(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11,
+				t12, t13, t14, t15, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15), index);
+		}
+
+
+		//! The bytes of `input`, shifted by N bytes (the missing ones coming from `previous`)
+		template<int N> inline __m256i Previous(__m256i input, __m256i previous)
+		{
+			return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+		}
+
+
+		inline __m256i HighNibbles(__m256i v)
+		{
+			return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+		}
+
+
+		inline __m256i CheckSpecialCases(__m256i input, __m256i prev1)
+		{
+			const char c = static_cast<char>(carry);
+			__m256i byte1High = Lookup16(HighNibbles(prev1),
+				tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+				static_cast<char>(twoConts), static_cast<char>(twoConts),
+				static_cast<char>(twoConts), static_cast<char>(twoConts),
+				tooShort | overlong2,
+				tooShort,
+				tooShort | overlong3 | surrogate,
+				tooShort | tooLarge | tooLarge1000 | overlong4);
+
+			__m256i byte1Low = Lookup16(_mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)),
+				static_cast<char>(carry | overlong3 | overlong2 | overlong4),
+				static_cast<char>(carry | overlong2),
+				c, c,
+				static_cast<char>(carry | tooLarge),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000 | surrogate),
+				static_cast<char>(carry | tooLarge | tooLarge1000),
+				static_cast<char>(carry | tooLarge | tooLarge1000));
+
+			__m256i byte2High = Lookup16(HighNibbles(input),
+				tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+				static_cast<char>(tooLong | overlong2 | twoConts | overlong3 | tooLarge1000 | overlong4),
+				static_cast<char>(tooLong | overlong2 | twoConts | overlong3 | tooLarge),
+				static_cast<char>(tooLong | overlong2 | twoConts | surrogate | tooLarge),
+				static_cast<char>(tooLong | overlong2 | twoConts | surrogate | tooLarge),
+				tooShort, tooShort, tooShort, tooShort);
+
+			return _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+		}
+
+
+		inline __m256i CheckMultibyteLengths(__m256i input, __m256i previous, __m256i specialCases)
+		{
+			__m256i prev2 = Previous<2>(input, previous);
+			__m256i prev3 = Previous<3>(input, previous);
+			// only 111_____ (3rd byte) / 1111____ (4th byte) leads will be >= 0x80
+			__m256i isThirdByte  = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+			__m256i isFourthByte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			__m256i must23 = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+			return _mm256_xor_si256(must23, specialCases);
+		}
+
+
+		//! Non-null if the last bytes start an incomplete sequence
+		inline __m256i IsIncomplete(__m256i input)
+		{
+			const __m256i max = _mm256_setr_epi8(
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+			return _mm256_subs_epu8(input, max);
+		}
+
+
+		inline bool IsASCII32(__m256i block)
+		{
+			return 0 == _mm256_movemask_epi8(block);
+		}
+
+
+		//! Locate precisely the first error, from the beginning of a block where the error has been detected
+		UTF8::Error LocateError(const char* s, uint len, uint blockStart, uint& offset)
+		{
+			// Everything is valid before the sequences which may start in the 3 previous bytes
+			uint i = (blockStart >= 3) ? (blockStart - 3) : 0;
+			while (i != 0 and (static_cast<uchar>(s[i]) & 0xC0u) == 0x80u)
+				--i;
+			UTF8::Error error = ValidateUTF8Scalar(s, len, i, len);
+			offset = i;
+			return error;
+		}
+
+
+		UTF8::Error AVX2Validate(const char* s, uint len, uint& offset)
+		{
+			__m256i error = _mm256_setzero_si256();
+			__m256i previous = _mm256_setzero_si256();
+			__m256i previousIncomplete = _mm256_setzero_si256();
+
+			uint i = 0;
+			for (; ; i += 32)
+			{
+				if (i + 64 <= len)
+				{
+					// 2 blocks of ASCII characters at once
+					__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+					__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 32));
+					if (IsASCII32(_mm256_or_si256(a, b)))
+					{
+						if (not _mm256_testz_si256(previousIncomplete, previousIncomplete))
+							return LocateError(s, len, i, offset);
+						previous = b;
+						i += 32; // +32 by the loop
+						continue;
+					}
+				}
+
+				__m256i input;
+				if (i + 32 <= len)
+					input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+				else
+				{
+					if (i == len)
+						break;
+					// the last bytes, padded with ASCII characters
+					alignas(32) char buffer[32];
+					memset(buffer, 0x20, sizeof(buffer));
+					memcpy(buffer, s + i, len - i);
+					input = _mm256_load_si256(reinterpret_cast<const __m256i*>(buffer));
+				}
+
+				if (IsASCII32(input))
+				{
+					// only a sequence from the previous block may be incomplete
+					error = _mm256_or_si256(error, previousIncomplete);
+				}
+				else
+				{
+					__m256i prev1 = Previous<1>(input, previous);
+					__m256i specialCases = CheckSpecialCases(input, prev1);
+					error = _mm256_or_si256(error, CheckMultibyteLengths(input, previous, specialCases));
+					previousIncomplete = IsIncomplete(input);
+				}
+				previous = input;
+
+				if (not _mm256_testz_si256(error, error))
+					return LocateError(s, len, i, offset);
+				if (i + 32 >= len)
+				{
+					i = len;
+					break;
+				}
+			}
+
+			// a sequence may be incomplete at the very end
+			if (not _mm256_testz_si256(previousIncomplete, previousIncomplete) and (len % 32) == 0)
+				return LocateError(s, len, (len >= 32) ? (len - 32) : 0, offset);
+			offset = len;
+			return UTF8::errNone;
+		}
+
+
+		uint AVX2Count(const char* s, uint len)
+		{
+			// code points = bytes which are not continuation bytes (10xxxxxx, -128..-65)
+			uint continuations = 0;
+			uint i = 0;
+			const __m256i threshold = _mm256_set1_epi8(-64);
+			while (i + 32 <= len)
+			{
+				// one counter per byte (a match is -1), at most 255 rounds before overflowing
+				__m256i counters = _mm256_setzero_si256();
+				for (uint rounds = 0; i + 32 <= len and rounds != 255; i += 32, ++rounds)
+				{
+					__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+					counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(threshold, block));
+				}
+				__m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+				__m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+				continuations += static_cast<uint>(_mm_cvtsi128_si32(half) + _mm_cvtsi128_si32(_mm_srli_si128(half, 8)));
+			}
+			return (i - continuations) + CountUTF8Scalar(s + i, len - i);
+		}
+
+
+		size_t AVX2ToUTF32(uint32* out, const char* s, size_t len)
+		{
+			uint32* const start = out;
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 32 <= len)
+				{
+					__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+					if (IsASCII32(block))
+					{
+						__m128i lo = _mm256_castsi256_si128(block);
+						__m128i hi = _mm256_extracti128_si256(block, 1);
+						__m256i* dst = reinterpret_cast<__m256i*>(out);
+						_mm256_storeu_si256(dst,     _mm256_cvtepu8_epi32(lo));
+						_mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+						_mm256_storeu_si256(dst + 2, _mm256_cvtepu8_epi32(hi));
+						_mm256_storeu_si256(dst + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+						out += 32;
+						i += 32;
+						continue;
+					}
+				}
+				if (not DecodeUTF8Scalar(out, s, len, i, ((i + 32 < len) ? i + 32 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+
+		size_t AVX2ToUTF16(uint16* out, const char* s, size_t len)
+		{
+			uint16* const start = out;
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 32 <= len)
+				{
+					__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+					if (IsASCII32(block))
+					{
+						__m256i* dst = reinterpret_cast<__m256i*>(out);
+						_mm256_storeu_si256(dst,     _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+						_mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+						out += 32;
+						i += 32;
+						continue;
+					}
+				}
+				if (not DecodeUTF8Scalar(out, s, len, i, ((i + 32 < len) ? i + 32 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+	} // anonymous namespace
+	# endif
+
+
+	bool UTF8KernelsAVX2(UTF8Kernels& kernels)
+	{
+		# ifdef __AVX2__
+		kernels.name = "avx2";
+		kernels.validate = &AVX2Validate;
+		kernels.count = &AVX2Count;
+		kernels.toUTF32 = &AVX2ToUTF32;
+		kernels.toUTF16 = &AVX2ToUTF16;
+		return true;
+		# else
+		(void) kernels;
+		return false;
+		# endif
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
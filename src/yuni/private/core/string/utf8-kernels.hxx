@@ -0,0 +1,322 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "utf8.h"
+
+/*
+** Scalar UTF-8 routines, shared by all implementations (for the bytes which
+** can not be handled by the vector kernels, like the non-ASCII sequences).
+**
+** This file is included by each translation unit providing kernels for a given
+** instruction set. Everything is local to the translation unit (anonymous namespace).
+*/
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+namespace // anonymous
+{
+
+	//! Invalid size (error while transcoding)
+	const size_t invalidSize = static_cast<size_t>(-1);
+
+
+	//! Decode a single UTF-8 sequence, generic version reporting the exact error (see DecodeUTF8())
+	inline uint DecodeUTF8Generic(const uchar* s, size_t avail, uint32& cp, UTF8::Error& error)
+	{
+		uint32 lead = s[0];
+		uint need;
+		uint32 min;
+		if (lead < 0xC0 or lead >= 0xF8)
+		{
+			error = UTF8::errInvalidLead;
+			return 0;
+		}
+		if (lead < 0xE0)
+		{
+			need = 2;
+			cp = lead & 0x1Fu;
+			min = 0x80;
+		}
+		else if (lead < 0xF0)
+		{
+			need = 3;
+			cp = lead & 0x0Fu;
+			min = 0x800;
+		}
+		else
+		{
+			need = 4;
+			cp = lead & 0x07u;
+			min = 0x10000;
+		}
+
+		uint available = (avail < need) ? static_cast<uint>(avail) : need;
+		for (uint i = 1; i != available; ++i)
+		{
+			uint32 trail = s[i];
+			if ((trail & 0xC0u) != 0x80u)
+			{
+				error = UTF8::errIncompleteSequence;
+				return 0;
+			}
+			cp = (cp << 6) | (trail & 0x3Fu);
+		}
+		if (available != need)
+		{
+			error = UTF8::errNotEnoughData;
+			return 0;
+		}
+		if (cp < min or cp > 0x10FFFFu or (cp >= 0xD800u and cp <= 0xDFFFu))
+		{
+			error = UTF8::errInvalidCodePoint;
+			return 0;
+		}
+		return need;
+	}
+
+
+	/*!
+	** \brief Decode a single UTF-8 sequence (strict)
+	**
+	** \param s The sequence (the lead byte is not ASCII)
+	** \param avail Number of bytes available from `s`
+	** \param[out] cp The code point
+	** \param[out] error The error, if any
+	** \return The length of the sequence, 0 if invalid
+	*/
+	inline uint DecodeUTF8(const uchar* s, size_t avail, uint32& cp, UTF8::Error& error)
+	{
+		// straight-line code for the valid sequences, the most common case by far
+		uint32 lead = s[0];
+		if (lead >= 0xC2 and lead < 0xE0) // 0xC0 and 0xC1 are always overlong
+		{
+			if (avail >= 2 and (s[1] & 0xC0u) == 0x80u)
+			{
+				cp = ((lead & 0x1Fu) << 6) | (s[1] & 0x3Fu);
+				return 2;
+			}
+		}
+		else if (lead >= 0xE0 and lead < 0xF0)
+		{
+			if (avail >= 3 and (s[1] & 0xC0u) == 0x80u and (s[2] & 0xC0u) == 0x80u)
+			{
+				cp = ((lead & 0x0Fu) << 12) | ((s[1] & 0x3Fu) << 6) | (s[2] & 0x3Fu);
+				if (cp >= 0x800u and (cp < 0xD800u or cp > 0xDFFFu))
+					return 3;
+			}
+		}
+		else if (lead >= 0xF0 and lead < 0xF5)
+		{
+			if (avail >= 4 and (s[1] & 0xC0u) == 0x80u and (s[2] & 0xC0u) == 0x80u and (s[3] & 0xC0u) == 0x80u)
+			{
+				cp = ((lead & 0x07u) << 18) | ((s[1] & 0x3Fu) << 12) | ((s[2] & 0x3Fu) << 6) | (s[3] & 0x3Fu);
+				if (cp >= 0x10000u and cp <= 0x10FFFFu)
+					return 4;
+			}
+		}
+		return DecodeUTF8Generic(s, avail, cp, error);
+	}
+
+
+	//! Encode a code point into UTF-8 (0 if invalid)
+	inline uint EncodeUTF8(char* out, uint32 cp)
+	{
+		if (cp < 0x80u)
+		{
+			out[0] = static_cast<char>(cp);
+			return 1;
+		}
+		if (cp < 0x800u)
+		{
+			out[0] = static_cast<char>(0xC0u | (cp >> 6));
+			out[1] = static_cast<char>(0x80u | (cp & 0x3Fu));
+			return 2;
+		}
+		if (cp < 0x10000u)
+		{
+			if (cp >= 0xD800u and cp <= 0xDFFFu)
+				return 0;
+			out[0] = static_cast<char>(0xE0u | (cp >> 12));
+			out[1] = static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu));
+			out[2] = static_cast<char>(0x80u | (cp & 0x3Fu));
+			return 3;
+		}
+		if (cp <= 0x10FFFFu)
+		{
+			out[0] = static_cast<char>(0xF0u | (cp >> 18));
+			out[1] = static_cast<char>(0x80u | ((cp >> 12) & 0x3Fu));
+			out[2] = static_cast<char>(0x80u | ((cp >> 6) & 0x3Fu));
+			out[3] = static_cast<char>(0x80u | (cp & 0x3Fu));
+			return 4;
+		}
+		return 0;
+	}
+
+
+
+
+	/*!
+	** \brief Get the length of a valid UTF-8 sequence (Unicode 3.9, table 3-7)
+	**
+	** \param s The sequence (the lead byte is not ASCII)
+	** \param avail Number of bytes available from `s`
+	** \return The length of the sequence, 0 if invalid
+	*/
+	inline uint ValidSequenceLength(const uchar* s, size_t avail)
+	{
+		uint lead = s[0];
+		if (lead < 0xE0)
+			return (lead >= 0xC2 and avail >= 2 and (s[1] & 0xC0u) == 0x80u) ? 2 : 0;
+		if (lead < 0xF0)
+		{
+			if (avail < 3 or (s[2] & 0xC0u) != 0x80u)
+				return 0;
+			uint lo = (lead == 0xE0) ? 0xA0 : 0x80;
+			uint hi = (lead == 0xED) ? 0x9F : 0xBF;
+			return (s[1] >= lo and s[1] <= hi) ? 3 : 0;
+		}
+		if (lead < 0xF5)
+		{
+			if (avail < 4 or (s[2] & 0xC0u) != 0x80u or (s[3] & 0xC0u) != 0x80u)
+				return 0;
+			uint lo = (lead == 0xF0) ? 0x90 : 0x80;
+			uint hi = (lead == 0xF4) ? 0x8F : 0xBF;
+			return (s[1] >= lo and s[1] <= hi) ? 4 : 0;
+		}
+		return 0;
+	}
+
+
+	/*!
+	** \brief Validate a string from a given offset, up to a given offset at least
+	**
+	** \param[in,out] i The current offset (updated)
+	** \param end The offset to reach (the last sequence may go beyond)
+	*/
+	inline UTF8::Error ValidateUTF8Scalar(const char* s, uint len, uint& i, uint end)
+	{
+		const uchar* u = reinterpret_cast<const uchar*>(s);
+		while (i < end)
+		{
+			if (u[i] < 0x80)
+			{
+				++i;
+				continue;
+			}
+			uint n = ValidSequenceLength(u + i, len - i);
+			if (0 == n)
+			{
+				// the generic decoder knows the exact reason
+				uint32 cp;
+				UTF8::Error error = UTF8::errInvalidLead;
+				DecodeUTF8Generic(u + i, len - i, cp, error);
+				return error;
+			}
+			i += n;
+		}
+		return UTF8::errNone;
+	}
+
+
+	//! Count the code points from a given offset (non-continuation bytes)
+	inline uint CountUTF8Scalar(const char* s, uint len)
+	{
+		uint count = 0;
+		for (uint i = 0; i != len; ++i)
+		{
+			if ((static_cast<uchar>(s[i]) & 0xC0u) != 0x80u)
+				++count;
+		}
+		return count;
+	}
+
+
+	/*!
+	** \brief Decode some sequences to UTF-32 / UTF-16, up to a given offset at least
+	**
+	** \return False if the input is invalid
+	*/
+	template<class T>
+	inline bool DecodeUTF8Scalar(T*& out, const char* s, size_t len, size_t& i, size_t end)
+	{
+		const uchar* u = reinterpret_cast<const uchar*>(s);
+		while (i < end)
+		{
+			if (u[i] < 0x80)
+			{
+				*out++ = static_cast<T>(u[i++]);
+				continue;
+			}
+			uint32 cp;
+			UTF8::Error error;
+			uint n = DecodeUTF8(u + i, len - i, cp, error);
+			if (0 == n)
+				return false;
+			i += n;
+			if (sizeof(T) == 4 or cp < 0x10000u)
+				*out++ = static_cast<T>(cp);
+			else
+			{
+				// surrogate pair
+				cp -= 0x10000u;
+				*out++ = static_cast<T>(0xD800u + (cp >> 10));
+				*out++ = static_cast<T>(0xDC00u + (cp & 0x3FFu));
+			}
+		}
+		return true;
+	}
+
+
+	//! Encode some UTF-32 code points, up to a given offset
+	inline bool EncodeUTF32Scalar(char*& out, const uint32* s, size_t& i, size_t end)
+	{
+		for (; i < end; ++i)
+		{
+			uint n = EncodeUTF8(out, s[i]);
+			if (0 == n)
+				return false;
+			out += n;
+		}
+		return true;
+	}
+
+
+	//! Encode some UTF-16 code units, up to a given offset at least
+	inline bool EncodeUTF16Scalar(char*& out, const uint16* s, size_t len, size_t& i, size_t end)
+	{
+		while (i < end)
+		{
+			uint32 cp = s[i++];
+			if (cp >= 0xD800u and cp <= 0xDFFFu)
+			{
+				// surrogate pair (a high surrogate followed by a low one)
+				if (cp >= 0xDC00u or i == len or s[i] < 0xDC00u or s[i] > 0xDFFFu)
+					return false;
+				cp = 0x10000u + ((cp - 0xD800u) << 10) + (s[i++] - 0xDC00u);
+			}
+			out += EncodeUTF8(out, cp);
+		}
+		return true;
+	}
+
+
+
+
+} // anonymous namespace
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
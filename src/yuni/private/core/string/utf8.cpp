@@ -0,0 +1,389 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "utf8.h"
+#include "utf8-kernels.hxx"
+#include "../../../core/string/traits/traits.h"
+#if defined(__x86_64__) || defined(_M_X64)
+#	define YUNI_STRING_UTF8_SSE2
+#	include <emmintrin.h>
+#endif
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	namespace // anonymous
+	{
+
+		UTF8::Error ScalarValidate(const char* s, uint len, uint& offset)
+		{
+			uint i = 0;
+			UTF8::Error error = ValidateUTF8Scalar(s, len, i, len);
+			offset = i;
+			return error;
+		}
+
+
+		size_t ScalarToUTF32(uint32* out, const char* s, size_t len)
+		{
+			uint32* const start = out;
+			size_t i = 0;
+			return (DecodeUTF8Scalar(out, s, len, i, len)) ? static_cast<size_t>(out - start) : invalidSize;
+		}
+
+
+		size_t ScalarToUTF16(uint16* out, const char* s, size_t len)
+		{
+			uint16* const start = out;
+			size_t i = 0;
+			return (DecodeUTF8Scalar(out, s, len, i, len)) ? static_cast<size_t>(out - start) : invalidSize;
+		}
+
+
+		size_t ScalarFromUTF32(char* out, const uint32* s, size_t len)
+		{
+			char* const start = out;
+			size_t i = 0;
+			return (EncodeUTF32Scalar(out, s, i, len)) ? static_cast<size_t>(out - start) : invalidSize;
+		}
+
+
+		size_t ScalarFromUTF16(char* out, const uint16* s, size_t len)
+		{
+			char* const start = out;
+			size_t i = 0;
+			return (EncodeUTF16Scalar(out, s, len, i, len)) ? static_cast<size_t>(out - start) : invalidSize;
+		}
+
+
+		const UTF8Kernels scalarKernels =
+		{
+			"scalar",
+			&ScalarValidate,
+			&CountUTF8Scalar,
+			&ScalarToUTF32,
+			&ScalarToUTF16,
+			&ScalarFromUTF32,
+			&ScalarFromUTF16,
+		};
+
+
+
+
+		# ifdef YUNI_STRING_UTF8_SSE2
+		// SSE2 has no byte shuffle (required by the lookup-based validation, see utf8-avx2.cpp):
+		// the blocks of ASCII characters are handled 16 bytes at a time, the other ones
+		// by the scalar routines
+
+		inline bool IsASCII16(__m128i block)
+		{
+			return 0 == _mm_movemask_epi8(block);
+		}
+
+
+		UTF8::Error SSE2Validate(const char* s, uint len, uint& offset)
+		{
+			uint i = 0;
+			while (i < len)
+			{
+				if (i + 64 <= len)
+				{
+					// 4 blocks at once, the most common case by far for most texts
+					__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 16));
+					__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 32));
+					__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 48));
+					if (IsASCII16(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))
+					{
+						i += 64;
+						continue;
+					}
+				}
+				else if (i + 16 <= len)
+				{
+					if (IsASCII16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i))))
+					{
+						i += 16;
+						continue;
+					}
+				}
+				// not worth retrying the vector code too soon for non-latin texts
+				UTF8::Error error = ValidateUTF8Scalar(s, len, i, ((i + 64 < len) ? i + 64 : len));
+				if (error != UTF8::errNone)
+				{
+					offset = i;
+					return error;
+				}
+			}
+			offset = len;
+			return UTF8::errNone;
+		}
+
+
+		uint SSE2Count(const char* s, uint len)
+		{
+			// code points = bytes which are not continuation bytes (10xxxxxx, -128..-65)
+			uint continuations = 0;
+			uint i = 0;
+			const __m128i threshold = _mm_set1_epi8(-64);
+			while (i + 16 <= len)
+			{
+				// one counter per byte (a match is -1), at most 255 rounds before overflowing
+				__m128i counters = _mm_setzero_si128();
+				for (uint rounds = 0; i + 16 <= len and rounds != 255; i += 16, ++rounds)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					counters = _mm_sub_epi8(counters, _mm_cmplt_epi8(block, threshold));
+				}
+				__m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+				continuations += static_cast<uint>(_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+			}
+			return (i - continuations) + CountUTF8Scalar(s + i, len - i);
+		}
+
+
+		size_t SSE2ToUTF32(uint32* out, const char* s, size_t len)
+		{
+			uint32* const start = out;
+			const __m128i zero = _mm_setzero_si128();
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 16 <= len)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					if (IsASCII16(block))
+					{
+						__m128i lo = _mm_unpacklo_epi8(block, zero);
+						__m128i hi = _mm_unpackhi_epi8(block, zero);
+						__m128i* dst = reinterpret_cast<__m128i*>(out);
+						_mm_storeu_si128(dst,     _mm_unpacklo_epi16(lo, zero));
+						_mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+						_mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+						_mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+						out += 16;
+						i += 16;
+						continue;
+					}
+				}
+				if (not DecodeUTF8Scalar(out, s, len, i, ((i + 16 < len) ? i + 16 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+
+		size_t SSE2ToUTF16(uint16* out, const char* s, size_t len)
+		{
+			uint16* const start = out;
+			const __m128i zero = _mm_setzero_si128();
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 16 <= len)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+					if (IsASCII16(block))
+					{
+						__m128i* dst = reinterpret_cast<__m128i*>(out);
+						_mm_storeu_si128(dst,     _mm_unpacklo_epi8(block, zero));
+						_mm_storeu_si128(dst + 1, _mm_unpackhi_epi8(block, zero));
+						out += 16;
+						i += 16;
+						continue;
+					}
+				}
+				if (not DecodeUTF8Scalar(out, s, len, i, ((i + 16 < len) ? i + 16 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+
+		size_t SSE2FromUTF32(char* out, const uint32* s, size_t len)
+		{
+			char* const start = out;
+			const __m128i nonASCII = _mm_set1_epi32(static_cast<int>(0xFFFFFF80u));
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 16 <= len)
+				{
+					const __m128i* src = reinterpret_cast<const __m128i*>(s + i);
+					__m128i a = _mm_loadu_si128(src);
+					__m128i b = _mm_loadu_si128(src + 1);
+					__m128i c = _mm_loadu_si128(src + 2);
+					__m128i d = _mm_loadu_si128(src + 3);
+					__m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+					if (0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, nonASCII), _mm_setzero_si128())))
+					{
+						// all values are below 0x80, no saturation
+						__m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out), bytes);
+						out += 16;
+						i += 16;
+						continue;
+					}
+				}
+				if (not EncodeUTF32Scalar(out, s, i, ((i + 16 < len) ? i + 16 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+
+		size_t SSE2FromUTF16(char* out, const uint16* s, size_t len)
+		{
+			char* const start = out;
+			const __m128i nonASCII = _mm_set1_epi16(static_cast<short>(0xFF80u));
+			size_t i = 0;
+			while (i < len)
+			{
+				if (i + 16 <= len)
+				{
+					const __m128i* src = reinterpret_cast<const __m128i*>(s + i);
+					__m128i a = _mm_loadu_si128(src);
+					__m128i b = _mm_loadu_si128(src + 1);
+					__m128i any = _mm_and_si128(_mm_or_si128(a, b), nonASCII);
+					if (0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi16(any, _mm_setzero_si128())))
+					{
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(a, b));
+						out += 16;
+						i += 16;
+						continue;
+					}
+				}
+				if (not EncodeUTF16Scalar(out, s, len, i, ((i + 16 < len) ? i + 16 : len)))
+					return invalidSize;
+			}
+			return static_cast<size_t>(out - start);
+		}
+
+
+		const UTF8Kernels sse2Kernels =
+		{
+			"sse2",
+			&SSE2Validate,
+			&SSE2Count,
+			&SSE2ToUTF32,
+			&SSE2ToUTF16,
+			&SSE2FromUTF32,
+			&SSE2FromUTF16,
+		};
+		# endif
+
+
+		const UTF8Kernels& SelectUTF8Kernels()
+		{
+			const UTF8Kernels* kernels = UTF8KernelsFor(SearchISA::avx2);
+			if (not kernels)
+				kernels = UTF8KernelsFor(SearchISA::sse2);
+			return (kernels) ? *kernels : scalarKernels;
+		}
+
+	} // anonymous namespace
+
+
+
+
+	const UTF8Kernels* UTF8KernelsFor(SearchISA isa)
+	{
+		switch (isa)
+		{
+			case SearchISA::scalar:
+				return &scalarKernels;
+			case SearchISA::sse2:
+			{
+				# ifdef YUNI_STRING_UTF8_SSE2
+				return &sse2Kernels;
+				# else
+				return nullptr;
+				# endif
+			}
+			case SearchISA::avx2:
+			{
+				// the AVX2 kernels complete the SSE2 ones
+				# ifdef YUNI_STRING_UTF8_SSE2
+				struct AVX2Kernels final
+				{
+					AVX2Kernels() : kernels(sse2Kernels)
+					{
+						available = UTF8KernelsAVX2(kernels);
+					}
+					UTF8Kernels kernels;
+					bool available;
+				};
+				static const AVX2Kernels avx2;
+				return (avx2.available and CPUHasAVX2()) ? &avx2.kernels : nullptr;
+				# else
+				return nullptr;
+				# endif
+			}
+		}
+		return nullptr;
+	}
+
+
+	const UTF8Kernels& BestUTF8Kernels()
+	{
+		static const UTF8Kernels& kernels = SelectUTF8Kernels();
+		return kernels;
+	}
+
+
+
+
+	UTF8::Error UTF8Validate(const char* s, uint len, uint& offset)
+	{
+		return BestUTF8Kernels().validate(s, len, offset);
+	}
+
+
+	uint UTF8Count(const char* s, uint len)
+	{
+		return BestUTF8Kernels().count(s, len);
+	}
+
+
+	size_t UTF8ToUTF32(uint32* out, const char* s, size_t len)
+	{
+		return BestUTF8Kernels().toUTF32(out, s, len);
+	}
+
+
+	size_t UTF8ToUTF16(uint16* out, const char* s, size_t len)
+	{
+		return BestUTF8Kernels().toUTF16(out, s, len);
+	}
+
+
+	size_t UTF32ToUTF8(char* out, const uint32* s, size_t len)
+	{
+		return BestUTF8Kernels().fromUTF32(out, s, len);
+	}
+
+
+	size_t UTF16ToUTF8(char* out, const uint16* s, size_t len)
+	{
+		return BestUTF8Kernels().fromUTF16(out, s, len);
+	}
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
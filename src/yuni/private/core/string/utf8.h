@@ -0,0 +1,72 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../../yuni.h"
+#include "../../../core/string/utf8char.h"
+#include "search.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace CStringImpl
+{
+
+	/*!
+	** \brief UTF-8 primitives for a given instruction set
+	**
+	** The validation is strict (RFC 3629): overlong sequences, surrogates and
+	** code points beyond U+10FFFF are rejected. The transcoders return the number
+	** of code units written, or `(size_t) -1` if the input is invalid. The output
+	** buffer must be large enough for the worst case (see the public functions in traits.h).
+	*/
+	struct UTF8Kernels final
+	{
+		//! Name of the instruction set
+		const char* name;
+		//! Validate (`offset`: the first invalid sequence, or `len` if valid)
+		UTF8::Error (*validate)(const char* s, uint len, uint& offset);
+		//! Count the code points (the string is assumed valid)
+		uint (*count)(const char* s, uint len);
+		//! UTF-8 to UTF-32
+		size_t (*toUTF32)(uint32* out, const char* s, size_t len);
+		//! UTF-8 to UTF-16
+		size_t (*toUTF16)(uint16* out, const char* s, size_t len);
+		//! UTF-32 to UTF-8
+		size_t (*fromUTF32)(char* out, const uint32* s, size_t len);
+		//! UTF-16 to UTF-8
+		size_t (*fromUTF16)(char* out, const uint16* s, size_t len);
+	};
+
+
+	/*!
+	** \brief Get the UTF-8 primitives for a given instruction set
+	**
+	** \return The kernels, or null if the instruction set is not supported by the CPU
+	**   or was not available at compile time
+	*/
+	YUNI_DECL const UTF8Kernels* UTF8KernelsFor(SearchISA isa);
+
+	//! Get the fastest UTF-8 primitives for the current CPU (selected once)
+	YUNI_DECL const UTF8Kernels& BestUTF8Kernels();
+
+
+	//! Replace the kernels improved by AVX2 (see utf8-avx2.cpp, false if not compiled in)
+	bool UTF8KernelsAVX2(UTF8Kernels& kernels);
+
+
+
+
+} // namespace CStringImpl
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,221 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "allocator.h"
+#include "../../thread/mutex.h"
+#include <new>
+#include <cassert>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	namespace // anonymous
+	{
+
+		enum
+		{
+			//! Maximum number of batches kept by the depot, the other ones are released
+			maxDepotBatchCount = 64,
+		};
+
+
+		//! A free block
+		struct Block final
+		{
+			//! The next free block in the same list
+			Block* next;
+			//! The next batch of blocks (only for the first block of a batch in the depot)
+			Block* nextBatch;
+		};
+
+
+		//! Batches of free blocks shared by all threads
+		class Depot final
+		{
+		public:
+			~Depot()
+			{
+				while (pBatches)
+				{
+					Block* batch = pBatches;
+					pBatches = batch->nextBatch;
+					ReleaseList(batch);
+				}
+			}
+
+			//! Take a full batch of free blocks, null if none
+			Block* take()
+			{
+				MutexLocker locker(pMutex);
+				Block* batch = pBatches;
+				if (batch)
+				{
+					pBatches = batch->nextBatch;
+					--pBatchCount;
+				}
+				return batch;
+			}
+
+			//! Give a full batch of free blocks
+			void give(Block* batch)
+			{
+				{
+					MutexLocker locker(pMutex);
+					if (pBatchCount < (uint) maxDepotBatchCount)
+					{
+						batch->nextBatch = pBatches;
+						pBatches = batch;
+						++pBatchCount;
+						return;
+					}
+				}
+				// too many free blocks, giving them back to the system
+				ReleaseList(batch);
+			}
+
+			static void ReleaseList(Block* block)
+			{
+				while (block)
+				{
+					Block* next = block->next;
+					::operator delete(block);
+					block = next;
+				}
+			}
+
+		private:
+			Mutex pMutex;
+			Block* pBatches = nullptr;
+			uint pBatchCount = 0;
+
+		}; // class Depot
+
+
+		//! Detach a batch of blocks from the head of a list and return the remaining blocks
+		static inline Block* DetachBatch(Block* head)
+		{
+			Block* last = head;
+			for (uint i = 1; i != (uint) SmallJobAllocator::batchSize; ++i)
+				last = last->next;
+			Block* remaining = last->next;
+			last->next = nullptr;
+			return remaining;
+		}
+
+
+		static Depot& SharedDepot()
+		{
+			static Depot depot;
+			return depot;
+		}
+
+
+		/*!
+		** \brief Flag to know if the free blocks of the current thread have been destroyed
+		**
+		** Some jobs may still be allocated or released afterwards, by the destructors of
+		** other thread-local objects. A trivial type remains valid until the very end
+		** of the thread, unlike the cache itself.
+		*/
+		static thread_local bool gThreadCacheDestroyed = false;
+
+
+		//! Free blocks of the current thread
+		class ThreadCache final
+		{
+		public:
+			~ThreadCache()
+			{
+				// the thread is terminating - the remaining blocks can be reused by another one
+				if (count >= (uint) SmallJobAllocator::batchSize)
+				{
+					Block* batch = head;
+					head = DetachBatch(batch);
+					SharedDepot().give(batch);
+				}
+				Depot::ReleaseList(head);
+				head = nullptr;
+				count = 0;
+				// from now on, using the system allocator directly
+				gThreadCacheDestroyed = true;
+			}
+
+		public:
+			Block* head = nullptr;
+			uint count = 0;
+
+		}; // class ThreadCache
+
+
+		static thread_local ThreadCache gThreadCache;
+
+
+	} // anonymous namespace
+
+
+
+
+	void* SmallJobAllocator::Allocate()
+	{
+		if (YUNI_UNLIKELY(gThreadCacheDestroyed))
+			return ::operator new(blockSize);
+
+		ThreadCache& cache = gThreadCache;
+		if (YUNI_UNLIKELY(nullptr == cache.head))
+		{
+			cache.head = SharedDepot().take();
+			if (nullptr == cache.head)
+				return ::operator new(blockSize);
+			cache.count = batchSize;
+		}
+
+		Block* block = cache.head;
+		cache.head = block->next;
+		--cache.count;
+		return block;
+	}
+
+
+	void SmallJobAllocator::Release(void* p)
+	{
+		assert(p != nullptr);
+		if (YUNI_UNLIKELY(gThreadCacheDestroyed))
+		{
+			::operator delete(p);
+			return;
+		}
+
+		ThreadCache& cache = gThreadCache;
+		Block* block = reinterpret_cast<Block*>(p);
+		block->next = cache.head;
+		cache.head = block;
+
+		if (YUNI_UNLIKELY(++cache.count == 2 * batchSize))
+		{
+			// keeping a batch for the next allocations of this thread, and giving
+			// the other one to the threads which need it
+			cache.head = DetachBatch(block);
+			cache.count = batchSize;
+			SharedDepot().give(block);
+		}
+	}
+
+
+
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
@@ -0,0 +1,65 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	/*!
+	** \brief Allocator of fixed-size blocks for small jobs, recycling them via per-thread free lists
+	**
+	** Released blocks are kept in a free list local to the releasing thread. When
+	** a free list becomes too large, a batch of blocks is moved to a shared depot,
+	** where the other threads (usually the ones creating the jobs) can take them
+	** back with a single lock acquisition. In steady state, allocating and
+	** releasing a block does not require any call to the system allocator.
+	*/
+	class YUNI_DECL SmallJobAllocator final
+	{
+	public:
+		enum
+		{
+			//! Size of a single block (in bytes)
+			blockSize = 192,
+			//! Alignment of all blocks (the one guaranteed by the system allocator)
+			alignment = 2 * sizeof(void*),
+			//! Number of blocks moved at once between a thread and the shared depot
+			batchSize = 64,
+		};
+
+	public:
+		/*!
+		** \brief Allocate a new block of `blockSize` bytes
+		*/
+		static void* Allocate();
+
+		/*!
+		** \brief Release a block previously allocated by `Allocate()`, from any thread
+		*/
+		static void Release(void* block);
+
+	}; // class SmallJobAllocator
+
+
+
+
+
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
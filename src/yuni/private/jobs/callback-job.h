@@ -0,0 +1,75 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../../yuni.h"
+#include "../../job/job.h"
+#include "allocator.h"
+#include <cstddef>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	/*!
+	** \brief Job executing a callable object stored inline
+	**
+	** Unlike a job based on a `Bind<>`, the callable object is directly stored
+	** within the job itself. When the job is small enough (which is the case for
+	** most lambdas), the job is allocated via `SmallJobAllocator` and recycled
+	** when released.
+	*/
+	template<class CallbackT>
+	class CallbackJob final : public Yuni::Job::IJob
+	{
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		//! Constructor from the callable object
+		template<class C> explicit CallbackJob(C&& callback);
+		//! Destructor
+		virtual ~CallbackJob() {}
+		//@}
+
+		//! \name Memory management
+		//@{
+		static void* operator new(std::size_t size);
+		static void operator delete(void* p, std::size_t size);
+		//@}
+
+
+	protected:
+		virtual void onExecute() override;
+
+	private:
+		//! Get if a job of the given size can be provided by the small job allocator
+		static bool Pooled(std::size_t size);
+
+	private:
+		//! The callable object
+		CallbackT pCallback;
+
+	}; // class CallbackJob
+
+
+
+
+
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
+
+#include "callback-job.hxx"
@@ -0,0 +1,69 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "callback-job.h"
+#include <utility>
+
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	template<class CallbackT>
+	template<class C>
+	inline CallbackJob<CallbackT>::CallbackJob(C&& callback)
+		: pCallback(std::forward<C>(callback))
+	{}
+
+
+	template<class CallbackT>
+	inline bool CallbackJob<CallbackT>::Pooled(std::size_t size)
+	{
+		return size <= (std::size_t) SmallJobAllocator::blockSize
+			and alignof(CallbackJob<CallbackT>) <= (std::size_t) SmallJobAllocator::alignment;
+	}
+
+
+	template<class CallbackT>
+	inline void* CallbackJob<CallbackT>::operator new(std::size_t size)
+	{
+		return (Pooled(size)) ? SmallJobAllocator::Allocate() : ::operator new(size);
+	}
+
+
+	template<class CallbackT>
+	inline void CallbackJob<CallbackT>::operator delete(void* p, std::size_t size)
+	{
+		if (Pooled(size))
+			SmallJobAllocator::Release(p);
+		else
+			::operator delete(p);
+	}
+
+
+	template<class CallbackT>
+	void CallbackJob<CallbackT>::onExecute()
+	{
+		pCallback();
+	}
+
+
+
+
+
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
@@ -19,6 +19,16 @@ namespace Private
 namespace QueueService
 {
 
+	//! The worker executing the current thread, if any
+	static YUNI_THREAD_LOCAL_STORAGE(QueueThread*) gCurrentWorker = nullptr;
+
+
+
+	QueueThread* QueueThread::Current()
+	{
+		return gCurrentWorker;
+	}
+
 
 	inline void QueueThread::notifyEndOfWork()
 	{
@@ -29,28 +39,63 @@ namespace QueueService
 
 	bool QueueThread::onExecute()
 	{
-		// Notify the scheduler that this thread has begun its work
-		pQueueService.registerWorker(this);
+		gCurrentWorker = this;
 
-		// Asking for the next job
-		while (pQueueService.pWaitingRoom.pop(pJob))
+		do
 		{
-			// Execute the job, via a wrapper for symbol visibility issues
-			Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::Execute(*pJob, this);
-
-			// We must release our pointer to the job here to avoid its destruction
-			// in `pQueueService.nextJob()` (when `pJob` is re-assigned).
-			// This method uses a lock and the destruction of the job may take some time.
-			// Obviously, there is absolutely no guarantee that the job will be destroyed
-			// at this point but we don't really care
-			pJob = nullptr;
-
-			// Cancellation point
-			if (YUNI_UNLIKELY(shouldAbort())) // We have to stop as soon as possible, no need for hibernation
+			// Notify the scheduler that this thread has begun its work
+			pQueueService.registerWorker(this);
+
+			// Asking for the next job
+			// (from our own local queues first if the work-stealing mode is enabled)
+			while (pQueueService.pWaitingRoom.pop(pJob, pIndex))
+			{
+				// Execute the job, via a wrapper for symbol visibility issues
+				Yuni::Private::QueueService::JobAccessor<Yuni::Job::IJob>::Execute(*pJob, this);
+
+				// We must release our pointer to the job here to avoid its destruction
+				// in `pQueueService.nextJob()` (when `pJob` is re-assigned).
+				// This method uses a lock and the destruction of the job may take some time.
+				// Obviously, there is absolutely no guarantee that the job will be destroyed
+				// at this point but we don't really care
+				pJob = nullptr;
+
+				// Cancellation point
+				if (YUNI_UNLIKELY(shouldAbort())) // We have to stop as soon as possible, no need for hibernation
+				{
+					gCurrentWorker = nullptr;
+					return false;
+				}
+
+			} // loop for retrieving jobs to execute
+
+			if (not pElastic)
+				break; // hibernation
+
+			// An elastic worker only waits for new jobs for a limited amount of time.
+			// The signal must be reset _before_ unregistering, to not miss any notification
+			pSignalNewJobs.reset();
+			notifyEndOfWork();
+
+			if (not pSignalNewJobs.wait(pQueueService.idleTimeout()))
+			{
+				// idle for too long - the queue service may ask us to stop
+				if (pQueueService.retireWorker(this))
+				{
+					gCurrentWorker = nullptr;
+					return false;
+				}
+			}
+
+			if (YUNI_UNLIKELY(shouldAbort()))
+			{
+				gCurrentWorker = nullptr;
 				return false;
+			}
+		}
+		while (true);
 
-		} // loop for retrieving jobs to execute
-
+		gCurrentWorker = nullptr;
 		// Returning true, for hibernation
 		return true;
 	}
@@ -37,8 +37,12 @@ namespace QueueService
 		//@{
 		/*!
 		** \brief Default Constructor
+		**
+		** \param queueservice The attached queue service
+		** \param index Index of the worker within the thread pool
+		** \param elastic True if the worker may be retired when idle for too long
 		*/
-		explicit QueueThread(Yuni::Job::QueueService& queueservice);
+		QueueThread(Yuni::Job::QueueService& queueservice, uint index, bool elastic);
 		//! Destructor
 		virtual ~QueueThread();
 		//@}
@@ -48,6 +52,30 @@ namespace QueueService
 		*/
 		Yuni::Job::IJob::Ptr currentJob() const;
 
+		//! Get the index of the worker within the thread pool
+		uint index() const;
+
+		//! Get the attached queue service
+		Yuni::Job::QueueService& queueservice() const;
+
+		//! Get if the worker may be retired when idle for too long
+		bool elastic() const;
+
+		/*!
+		** \brief Wake up the worker, some jobs are waiting
+		**
+		** Contrary to `wakeUp()`, this method also interrupts an elastic
+		** worker waiting for new jobs.
+		*/
+		void notifyNewJobs();
+
+		/*!
+		** \brief Get the worker executing the calling thread
+		**
+		** \return The worker, or null if not called from a job
+		*/
+		static QueueThread* Current();
+
 
 	protected:
 		//! Implementation of the `onExecute` method to run the jobs from the waiting room
@@ -68,6 +96,12 @@ namespace QueueService
 		Yuni::Job::QueueService& pQueueService;
 		//! The current job
 		Yuni::Job::IJob::Ptr pJob;
+		//! Index of the worker
+		const uint pIndex;
+		//! Flag to know if the worker may be retired
+		const bool pElastic;
+		//! Signal for elastic workers waiting for new jobs
+		Yuni::Thread::Signal pSignalNewJobs;
 
 	}; // class QueueThread
 
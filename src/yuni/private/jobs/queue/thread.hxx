@@ -20,8 +20,10 @@ namespace Private
 namespace QueueService
 {
 
-	inline QueueThread::QueueThread(Yuni::Job::QueueService& queueservice)
+	inline QueueThread::QueueThread(Yuni::Job::QueueService& queueservice, uint index, bool elastic)
 		: pQueueService(queueservice)
+		, pIndex(index)
+		, pElastic(elastic)
 	{}
 
 
@@ -38,6 +40,31 @@ namespace QueueService
 	}
 
 
+	inline uint QueueThread::index() const
+	{
+		return pIndex;
+	}
+
+
+	inline Yuni::Job::QueueService& QueueThread::queueservice() const
+	{
+		return pQueueService;
+	}
+
+
+	inline bool QueueThread::elastic() const
+	{
+		return pElastic;
+	}
+
+
+	inline void QueueThread::notifyNewJobs()
+	{
+		pSignalNewJobs.notify();
+		wakeUp();
+	}
+
+
 	inline void WaitingRoom::add(const Yuni::Job::IJob::Ptr& job)
 	{
 		add(job, Yuni::Job::Priority::normal);
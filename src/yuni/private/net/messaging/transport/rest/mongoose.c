@@ -182,6 +182,7 @@ typedef struct DIR {
 #else    // UNIX  specific
 #include <sys/wait.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/select.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
@@ -1593,6 +1594,80 @@ int mg_write(struct mg_connection *conn, const void *buf, size_t len) {
   return (int) total;
 }
 
+#define MG_MAX_WRITEV_BUFFERS 16
+
+int mg_writev(struct mg_connection *conn, const struct mg_buffer *bufs,
+              int count) {
+  int64_t total = 0;
+  int i, n;
+
+  if (conn->ssl == NULL && conn->throttle <= 0 && count > 1 &&
+      count <= MG_MAX_WRITEV_BUFFERS) {
+#if defined(_WIN32)
+    WSABUF wsabufs[MG_MAX_WRITEV_BUFFERS];
+    DWORD sent = 0;
+    for (i = 0; i < count; i++) {
+      wsabufs[i].buf = (char *) bufs[i].ptr;
+      wsabufs[i].len = (ULONG) bufs[i].len;
+    }
+    // blocking socket: all buffers are sent, unless an error occurs
+    if (WSASend(conn->client.sock, wsabufs, (DWORD) count, &sent, 0, NULL,
+                NULL) != 0) {
+      return -1;
+    }
+    return (int) sent;
+#else
+    struct iovec iov[MG_MAX_WRITEV_BUFFERS];
+    struct msghdr msg;
+    ssize_t sent;
+    int first = 0;
+    for (i = 0; i < count; i++) {
+      iov[i].iov_base = (void *) bufs[i].ptr;
+      iov[i].iov_len = bufs[i].len;
+    }
+    while (first < count) {
+      // skipping the buffers already sent
+      if (iov[first].iov_len == 0) {
+        first++;
+        continue;
+      }
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_iov = iov + first;
+      msg.msg_iovlen = count - first;
+      sent = sendmsg(conn->client.sock, &msg, MSG_NOSIGNAL);
+      if (sent < 0) {
+        if (errno == EINTR)
+          continue;
+        return total == 0 ? -1 : (int) total;
+      }
+      total += sent;
+      while (first < count && (size_t) sent >= iov[first].iov_len) {
+        sent -= iov[first].iov_len;
+        first++;
+      }
+      if (first < count) {
+        iov[first].iov_base = (char *) iov[first].iov_base + sent;
+        iov[first].iov_len -= (size_t) sent;
+      }
+    }
+    return (int) total;
+#endif
+  }
+
+  // SSL, throttling: one buffer at a time
+  for (i = 0; i < count; i++) {
+    if (bufs[i].len == 0)
+      continue;
+    n = mg_write(conn, bufs[i].ptr, bufs[i].len);
+    if (n <= 0)
+      return total == 0 ? n : (int) total;
+    total += n;
+    if ((size_t) n != bufs[i].len)
+      break;
+  }
+  return (int) total;
+}
+
 int mg_printf(struct mg_connection *conn, const char *fmt, ...) {
   char mem[MG_BUF_LEN], *buf = mem;
   int len;
@@ -235,6 +235,18 @@ struct mg_request_info *mg_get_request_info(struct mg_connection *);
 int mg_write(struct mg_connection *, const void *buf, size_t len);
 
 
+// A buffer for mg_writev()
+struct mg_buffer {
+  const void *ptr;   // Data
+  size_t len;        // Size of the data in bytes
+};
+
+// Send several buffers to the client at once (gather write), without
+// copying them into a single buffer first.
+// Return: the same as mg_write(), for all buffers
+int mg_writev(struct mg_connection *, const struct mg_buffer *bufs, int count);
+
+
 // Send data to the browser using printf() semantics.
 //
 // Works exactly like mg_write(), but allows to do message formatting.
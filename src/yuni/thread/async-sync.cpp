@@ -14,6 +14,25 @@
 
 
 
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	void Dispatch(Yuni::Job::QueueService& queueservice, const Yuni::Job::IJob::Ptr& job)
+	{
+		queueservice += job;
+	}
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
+
+
+
+
 namespace Yuni
 {
 
@@ -0,0 +1,651 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#include "timer-service.h"
+#include "thread.h"
+#include "signal.h"
+#include "utility.h"
+#include "../core/smartptr/intrusive.h"
+#include "../datetime/timestamp.h"
+#include "../job/queue/service.h"
+#include <vector>
+
+
+
+namespace Yuni
+{
+namespace Thread
+{
+
+	namespace // anonymous
+	{
+
+		enum
+		{
+			//! Number of bits for the first level of the wheel (1ms per slot)
+			rootBits = 8,
+			//! Number of slots of the first level
+			rootSize = 1 << rootBits,
+			//! Number of bits for the other levels
+			levelBits = 6,
+			//! Number of slots of the other levels
+			levelSize = 1 << levelBits,
+			//! Number of levels (the last one covering up to 2^32ms)
+			levelCount = 5,
+			//! Total number of buckets
+			bucketCount = rootSize + (levelCount - 1) * levelSize,
+		};
+
+		//! Null index
+		static const uint nil = (uint) -1;
+
+	} // anonymous namespace
+
+
+
+
+	class TimerService::Wheel final : public IIntrusiveSmartPtr<TimerService::Wheel, false>
+	{
+	public:
+		//! Ancestor
+		typedef IIntrusiveSmartPtr<TimerService::Wheel, false>  Ancestor;
+		//! The most suitable smart pointer for the class
+		typedef Ancestor::SmartPtrType<TimerService::Wheel>::PtrThreadSafe Ptr;
+		//! The threading policy
+		typedef Ancestor::ThreadingPolicy ThreadingPolicy;
+
+		enum Mode
+		{
+			modeSimple,
+			modeElapsed,
+			modeElapsedPrecise,
+		};
+
+		enum EntryState
+		{
+			//! The slot is free
+			esFree,
+			//! The timer is waiting in a bucket of the wheel
+			esScheduled,
+			//! The callback is being executed
+			esRunning,
+			//! The timer has been canceled while its callback was being executed
+			esCanceled,
+		};
+
+		//! A single timer
+		struct Entry final
+		{
+			Bind<bool ()> callback;
+			Bind<bool (uint64)> callbackElapsed;
+			//! Tick of the next expiration
+			uint64 expiry;
+			//! Timestamp of the last call, for the elapsed time
+			sint64 lastTimestamp;
+			//! The interval, in ms
+			uint interval;
+			//! Generation of the slot, to detect outdated identifiers
+			uint generation;
+			//! Siblings within the same bucket (or the next free slot)
+			uint prev, next;
+			//! The current bucket
+			uint bucket;
+			Mode mode;
+			EntryState state;
+		};
+
+
+	public:
+		explicit Wheel(Job::QueueService* queueservice);
+
+		ID add(uint ms, Mode mode, const Bind<bool ()>& callback, const Bind<bool (uint64)>& callbackElapsed);
+		bool cancel(ID id);
+		bool exists(ID id) const;
+		void clear();
+
+		//! Current tick, according to the clock
+		uint64 now() const;
+		//! Move the wheel to a given tick and collect all expired timers
+		void advanceWL(uint64 target, std::vector<uint>& expired);
+		//! Number of ticks before the next event of the wheel (nil if nothing to do)
+		uint nextWakeupWL() const;
+		//! Execute or dispatch the callbacks of all expired timers
+		void execute(const std::vector<uint>& expired);
+		//! The callback of a timer has been executed
+		void terminated(uint index, bool shouldContinue, sint64 lastTimestamp);
+
+	public:
+		//! The queueservice executing the callbacks, if any
+		Job::QueueService* const queueservice;
+		//! Signal to interrupt the worker
+		Signal signal;
+		//! Tick at which the worker will wake up
+		uint64 plannedWakeup;
+		//! Number of active timers
+		uint count;
+
+	private:
+		void insertWL(uint index);
+		void unlinkWL(uint index);
+		void releaseWL(uint index);
+		void cascadeWL(uint bucket);
+		static ID MakeID(uint index, uint generation);
+
+	private:
+		//! Reference time
+		const sint64 pOrigin;
+		//! Current tick of the wheel
+		uint64 pCurrent;
+		//! Heads of all buckets
+		uint pBuckets[bucketCount];
+		//! All timers
+		std::vector<Entry> pEntries;
+		//! First free slot
+		uint pFreeList;
+
+	}; // class TimerService::Wheel
+
+
+
+
+	class TimerService::Worker final : public IThread
+	{
+	public:
+		explicit Worker(TimerService::Wheel& wheel)
+			: pWheel(wheel)
+		{}
+
+		virtual ~Worker() {}
+
+	protected:
+		virtual bool onExecute() override
+		{
+			std::vector<uint> expired;
+			while (not shouldAbort())
+			{
+				uint delay;
+				{
+					TimerService::Wheel::ThreadingPolicy::MutexLocker locker(pWheel);
+					pWheel.advanceWL(pWheel.now(), expired);
+					delay = (expired.empty()) ? pWheel.nextWakeupWL() : 0;
+					pWheel.plannedWakeup = (delay != nil) ? pWheel.now() + delay : (uint64) -1;
+					pWheel.signal.reset();
+					// checking again, the signal may have been notified for stopping
+					if (shouldAbort())
+						break;
+				}
+
+				if (not expired.empty())
+				{
+					pWheel.execute(expired);
+					expired.clear();
+					continue;
+				}
+
+				if (delay != nil)
+					pWheel.signal.wait(delay);
+				else
+					pWheel.signal.wait();
+			}
+			return false;
+		}
+
+	private:
+		TimerService::Wheel& pWheel;
+
+	}; // class TimerService::Worker
+
+
+
+
+
+
+	TimerService::Wheel::Wheel(Job::QueueService* queueservice)
+		: queueservice(queueservice)
+		, plannedWakeup((uint64) -1)
+		, count(0)
+		, pOrigin(DateTime::NowMilliSeconds())
+		, pCurrent(0)
+		, pFreeList(nil)
+	{
+		for (uint i = 0; i != (uint) bucketCount; ++i)
+			pBuckets[i] = nil;
+	}
+
+
+	inline TimerService::ID TimerService::Wheel::MakeID(uint index, uint generation)
+	{
+		return (static_cast<ID>(generation) << 32) | static_cast<ID>(index + 1);
+	}
+
+
+	inline uint64 TimerService::Wheel::now() const
+	{
+		return static_cast<uint64>(DateTime::NowMilliSeconds() - pOrigin);
+	}
+
+
+	void TimerService::Wheel::insertWL(uint index)
+	{
+		Entry& entry = pEntries[index];
+		uint64 expiry = entry.expiry;
+		if (expiry <= pCurrent)
+			expiry = entry.expiry = pCurrent + 1;
+
+		uint64 delta = expiry - pCurrent;
+		uint bucket;
+		if (delta < (uint64) rootSize)
+		{
+			bucket = static_cast<uint>(expiry & (rootSize - 1));
+		}
+		else
+		{
+			uint level = 1;
+			uint shift = rootBits;
+			while (level < (uint) levelCount - 1 and delta >= (1ull << (shift + levelBits)))
+			{
+				++level;
+				shift += levelBits;
+			}
+			bucket = rootSize + (level - 1) * levelSize + static_cast<uint>((expiry >> shift) & (levelSize - 1));
+		}
+
+		entry.bucket = bucket;
+		entry.prev = nil;
+		entry.next = pBuckets[bucket];
+		if (entry.next != nil)
+			pEntries[entry.next].prev = index;
+		pBuckets[bucket] = index;
+		entry.state = esScheduled;
+	}
+
+
+	void TimerService::Wheel::unlinkWL(uint index)
+	{
+		Entry& entry = pEntries[index];
+		if (entry.prev != nil)
+			pEntries[entry.prev].next = entry.next;
+		else
+			pBuckets[entry.bucket] = entry.next;
+		if (entry.next != nil)
+			pEntries[entry.next].prev = entry.prev;
+	}
+
+
+	void TimerService::Wheel::releaseWL(uint index)
+	{
+		Entry& entry = pEntries[index];
+		entry.state = esFree;
+		entry.callback.clear();
+		entry.callbackElapsed.clear();
+		++entry.generation;
+		entry.next = pFreeList;
+		pFreeList = index;
+		--count;
+	}
+
+
+	void TimerService::Wheel::cascadeWL(uint bucket)
+	{
+		uint index = pBuckets[bucket];
+		pBuckets[bucket] = nil;
+		while (index != nil)
+		{
+			uint next = pEntries[index].next;
+			insertWL(index);
+			index = next;
+		}
+	}
+
+
+	void TimerService::Wheel::advanceWL(uint64 target, std::vector<uint>& expired)
+	{
+		if (0 == count)
+		{
+			pCurrent = (target > pCurrent) ? target : pCurrent;
+			return;
+		}
+
+		while (pCurrent < target)
+		{
+			++pCurrent;
+			uint slot = static_cast<uint>(pCurrent & (rootSize - 1));
+			if (0 == slot)
+			{
+				// the first level has been fully consumed, getting the timers of the
+				// next period from the upper levels
+				uint shift = rootBits;
+				for (uint level = 1; level != (uint) levelCount; ++level)
+				{
+					uint index = static_cast<uint>((pCurrent >> shift) & (levelSize - 1));
+					cascadeWL(rootSize + (level - 1) * levelSize + index);
+					if (index != 0)
+						break;
+					shift += levelBits;
+				}
+			}
+
+			uint index = pBuckets[slot];
+			pBuckets[slot] = nil;
+			while (index != nil)
+			{
+				Entry& entry = pEntries[index];
+				uint next = entry.next;
+				if (entry.expiry <= pCurrent)
+				{
+					entry.state = esRunning;
+					expired.push_back(index);
+				}
+				else
+					insertWL(index); // should not happen
+				index = next;
+			}
+		}
+	}
+
+
+	uint TimerService::Wheel::nextWakeupWL() const
+	{
+		if (0 == count)
+			return nil;
+		// looking for the next timer within the first level
+		uint64 tick = pCurrent;
+		uint64 end = (pCurrent | (rootSize - 1)) + 1;
+		while (++tick < end)
+		{
+			if (pBuckets[tick & (rootSize - 1)] != nil)
+				return static_cast<uint>(tick - pCurrent);
+		}
+		// waiting for the next cascade
+		return static_cast<uint>(end - pCurrent);
+	}
+
+
+	TimerService::ID TimerService::Wheel::add(uint ms, Mode mode, const Bind<bool ()>& callback,
+		const Bind<bool (uint64)>& callbackElapsed)
+	{
+		if (0 == ms)
+			ms = 1;
+
+		ThreadingPolicy::MutexLocker locker(*this);
+		uint index = pFreeList;
+		if (index != nil)
+		{
+			pFreeList = pEntries[index].next;
+		}
+		else
+		{
+			index = static_cast<uint>(pEntries.size());
+			pEntries.emplace_back();
+			pEntries.back().generation = 0;
+		}
+
+		Entry& entry = pEntries[index];
+		entry.callback = callback;
+		entry.callbackElapsed = callbackElapsed;
+		entry.mode = mode;
+		entry.interval = ms;
+		entry.lastTimestamp = DateTime::NowMilliSeconds();
+		entry.expiry = now() + ms;
+		++count;
+		insertWL(index);
+
+		// the worker may have to wake up earlier than expected
+		if (entry.expiry < plannedWakeup)
+		{
+			plannedWakeup = entry.expiry;
+			signal.notify();
+		}
+		return MakeID(index, entry.generation);
+	}
+
+
+	bool TimerService::Wheel::cancel(ID id)
+	{
+		uint index = static_cast<uint>(id & 0xFFFFFFFFu) - 1;
+		uint generation = static_cast<uint>(id >> 32);
+
+		ThreadingPolicy::MutexLocker locker(*this);
+		if (not (index < (uint) pEntries.size()) or pEntries[index].generation != generation)
+			return false;
+
+		Entry& entry = pEntries[index];
+		switch (entry.state)
+		{
+			case esScheduled:
+			{
+				unlinkWL(index);
+				releaseWL(index);
+				return true;
+			}
+			case esRunning:
+			{
+				// will be released once the callback has returned
+				entry.state = esCanceled;
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+
+
+	bool TimerService::Wheel::exists(ID id) const
+	{
+		uint index = static_cast<uint>(id & 0xFFFFFFFFu) - 1;
+		uint generation = static_cast<uint>(id >> 32);
+
+		ThreadingPolicy::MutexLocker locker(*this);
+		return index < (uint) pEntries.size() and pEntries[index].generation == generation
+			and (pEntries[index].state == esScheduled or pEntries[index].state == esRunning);
+	}
+
+
+	void TimerService::Wheel::clear()
+	{
+		ThreadingPolicy::MutexLocker locker(*this);
+		for (uint i = 0; i != (uint) pEntries.size(); ++i)
+		{
+			switch (pEntries[i].state)
+			{
+				case esScheduled: unlinkWL(i); releaseWL(i); break;
+				case esRunning: pEntries[i].state = esCanceled; break;
+				default: break;
+			}
+		}
+	}
+
+
+	void TimerService::Wheel::execute(const std::vector<uint>& expired)
+	{
+		for (auto index: expired)
+		{
+			// copying the callback, since the entries may be reallocated meanwhile
+			Mode mode;
+			Bind<bool ()> callback;
+			Bind<bool (uint64)> callbackElapsed;
+			sint64 lastTimestamp;
+			{
+				ThreadingPolicy::MutexLocker locker(*this);
+				const Entry& entry = pEntries[index];
+				mode = entry.mode;
+				lastTimestamp = entry.lastTimestamp;
+				if (mode == modeSimple)
+					callback = entry.callback;
+				else
+					callbackElapsed = entry.callbackElapsed;
+			}
+
+			auto run = [=]()
+			{
+				sint64 start = DateTime::NowMilliSeconds();
+				bool shouldContinue = false;
+				try
+				{
+					shouldContinue = (mode == modeSimple)
+						? callback()
+						: callbackElapsed((uint64)(start - lastTimestamp));
+				}
+				catch (...) {}
+
+				// the time spent in the callback is only taken into consideration
+				// for the next elapsed time if not precise
+				sint64 last = (mode == modeElapsedPrecise) ? DateTime::NowMilliSeconds() : start;
+				terminated(index, shouldContinue, last);
+			};
+
+			if (queueservice)
+			{
+				// keeping a reference, since the service may be destroyed meanwhile
+				Ptr self = this;
+				async(*queueservice, [self, run]() { run(); });
+			}
+			else
+				run();
+		}
+	}
+
+
+	void TimerService::Wheel::terminated(uint index, bool shouldContinue, sint64 lastTimestamp)
+	{
+		ThreadingPolicy::MutexLocker locker(*this);
+		Entry& entry = pEntries[index];
+		if (entry.state != esRunning or not shouldContinue)
+		{
+			releaseWL(index);
+			return;
+		}
+
+		entry.lastTimestamp = lastTimestamp;
+		// the interval starts again once the callback has returned
+		entry.expiry = now() + entry.interval;
+		insertWL(index);
+		if (entry.expiry < plannedWakeup)
+		{
+			plannedWakeup = entry.expiry;
+			signal.notify();
+		}
+	}
+
+
+
+
+
+
+	TimerService::TimerService()
+		: pWheel(new Wheel(nullptr))
+		, pWorker(nullptr)
+	{
+		pWheel->addRef();
+	}
+
+
+	TimerService::TimerService(Job::QueueService& queueservice)
+		: pWheel(new Wheel(&queueservice))
+		, pWorker(nullptr)
+	{
+		pWheel->addRef();
+	}
+
+
+	TimerService::~TimerService()
+	{
+		stop();
+		pWheel->clear();
+		if (pWheel->release())
+			delete pWheel;
+	}
+
+
+	bool TimerService::start()
+	{
+		Wheel::ThreadingPolicy::MutexLocker locker(*pWheel);
+		if (pWorker)
+			return true;
+		pWorker = new Worker(*pWheel);
+		pWorker->addRef();
+		if (pWorker->start() == errNone)
+			return true;
+
+		if (pWorker->release())
+			delete pWorker;
+		pWorker = nullptr;
+		return false;
+	}
+
+
+	void TimerService::stop(uint timeout)
+	{
+		Worker* worker;
+		{
+			Wheel::ThreadingPolicy::MutexLocker locker(*pWheel);
+			worker = pWorker;
+			pWorker = nullptr;
+			if (not worker)
+				return;
+			worker->gracefulStop();
+			pWheel->signal.notify();
+		}
+
+		worker->stop(timeout);
+		if (worker->release())
+			delete worker;
+	}
+
+
+	bool TimerService::started() const
+	{
+		Wheel::ThreadingPolicy::MutexLocker locker(*pWheel);
+		return pWorker != nullptr;
+	}
+
+
+	TimerService::ID TimerService::every(uint ms, const Bind<bool ()>& callback)
+	{
+		return pWheel->add(ms, Wheel::modeSimple, callback, Bind<bool (uint64)>());
+	}
+
+
+	TimerService::ID TimerService::every(uint ms, bool precise, const Bind<bool (uint64)>& callback)
+	{
+		return pWheel->add(ms, (precise ? Wheel::modeElapsedPrecise : Wheel::modeElapsed), Bind<bool ()>(), callback);
+	}
+
+
+	bool TimerService::cancel(ID timer)
+	{
+		return pWheel->cancel(timer);
+	}
+
+
+	bool TimerService::exists(ID timer) const
+	{
+		return pWheel->exists(timer);
+	}
+
+
+	uint TimerService::size() const
+	{
+		Wheel::ThreadingPolicy::MutexLocker locker(*pWheel);
+		return pWheel->count;
+	}
+
+
+	void TimerService::clear()
+	{
+		pWheel->clear();
+	}
+
+
+
+
+
+} // namespace Thread
+} // namespace Yuni
@@ -0,0 +1,149 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "../yuni.h"
+#include "../core/bind.h"
+#include "../core/noncopyable.h"
+
+namespace Yuni { namespace Job { class QueueService; }}
+
+
+
+namespace Yuni
+{
+namespace Thread
+{
+
+	/*!
+	** \brief Shared service for periodic callbacks, based on a hierarchical timing wheel
+	**
+	** Unlike `every()`, which creates a new thread for each timer, all timers of
+	** the service share a single thread. The callbacks are either executed by this
+	** thread, or dispatched as jobs to a queueservice when provided.
+	**
+	** \code
+	** Thread::TimerService timers;
+	** timers.start();
+	**
+	** auto id = timers.every(1000, [&]() -> bool {
+	**	std::cout << "health check" << std::endl;
+	**	return true; // false to stop the timer
+	** });
+	** ...
+	** timers.cancel(id);
+	** \endcode
+	**
+	** The semantics of the callbacks are the same as for `every()`: the interval
+	** starts again once the callback has returned, a callback is never executed
+	** twice at the same time, and the timer is removed when the callback returns false.
+	** The resolution is 1ms. Scheduling and canceling a timer have a constant complexity.
+	**
+	** \note When executed by the thread of the service, a slow callback delays all
+	**   other timers. A queueservice should be preferred for such callbacks.
+	*/
+	class YUNI_DECL TimerService final : private NonCopyable<TimerService>
+	{
+	public:
+		//! Identifier of a timer (0 is an invalid value)
+		typedef uint64 ID;
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Default constructor, the callbacks being executed by the thread of the service
+		*/
+		TimerService();
+		/*!
+		** \brief Constructor, the callbacks being executed by a queueservice
+		*/
+		explicit TimerService(Job::QueueService& queueservice);
+		//! Destructor (will stop the service)
+		~TimerService();
+		//@}
+
+
+		//! \name Service
+		//@{
+		//! Start the service
+		bool start();
+		//! Stop the service (the timers are kept, but no callback will be executed until restarted)
+		void stop(uint timeout = 5000);
+		//! Get if the service is running
+		bool started() const;
+		//@}
+
+
+		//! \name Timers
+		//@{
+		/*!
+		** \brief Execute a callback every X milliseconds
+		**
+		** \param ms The interval in milliseconds (at least 1)
+		** \param callback The callback to execute, which returns false to stop the timer
+		** \return The identifier of the new timer
+		** \see every()
+		*/
+		ID every(uint ms, const Bind<bool ()>& callback);
+
+		/*!
+		** \brief Execute a callback every X milliseconds, with the time elapsed since the last call
+		**
+		** \param ms The interval in milliseconds (at least 1)
+		** \param precise True to not take into consideration the time spent in the callback
+		**   for computing the elapsed time
+		** \param callback The callback to execute, which returns false to stop the timer
+		** \return The identifier of the new timer
+		** \see every()
+		*/
+		ID every(uint ms, bool precise, const Bind<bool (uint64 /*elapsed*/)>& callback);
+
+		/*!
+		** \brief Cancel a timer
+		**
+		** If the callback is being executed, it will not be executed again. This
+		** method does not wait for the end of its execution.
+		** \return True if the timer existed
+		*/
+		bool cancel(ID timer);
+
+		//! Get if a timer still exists
+		bool exists(ID timer) const;
+
+		//! Get the number of timers
+		uint size() const;
+
+		//! Cancel all timers
+		void clear();
+		//@}
+
+
+	private:
+		//! Internal data, shared with the jobs
+		class Wheel;
+		//! The thread of the service
+		class Worker;
+
+	private:
+		//! Internal data (always valid, with its own reference)
+		Wheel* pWheel;
+		//! The thread of the service, if started
+		Worker* pWorker;
+
+	}; // class TimerService
+
+
+
+
+
+
+} // namespace Thread
+} // namespace Yuni
@@ -13,6 +13,7 @@
 #include "timer.h"
 #include "../job/job.h"
 #include "../core/bind.h"
+#include "../private/jobs/callback-job.h"
 
 namespace Yuni { namespace Job { class QueueService; }}
 namespace Yuni { namespace Job { class Taskgroup; }}
@@ -91,6 +92,9 @@ namespace Yuni
 	** \param ms An amount of time, in milliseconds
 	** \param callback The callback to execute
 	** \param autostart True to automatically start the timer
+	**
+	** \note Each timer has its own thread. `Thread::TimerService` should be preferred
+	**   when a lot of timers are required
 	*/
 	Thread::Timer::Ptr  every(uint ms, const Bind<bool ()>& callback, bool autostart = true);
 
@@ -123,6 +127,9 @@ namespace Yuni
 	** \param precise True to not take into consideration the time spent in the callback (with performance penalty)
 	** \param callback The callback to execute
 	** \param autostart True to automatically start the timer
+	**
+	** \note Each timer has its own thread. `Thread::TimerService` should be preferred
+	**   when a lot of timers are required
 	*/
 	Thread::Timer::Ptr  every(uint ms, bool precise, const Bind<bool (uint64 /*elapsed*/)>& callback, bool autostart = true);
 
@@ -153,6 +160,20 @@ namespace Yuni
 	*/
 	Job::IJob::Ptr  async(Job::QueueService& queueservice, const Bind<void ()>& callback);
 
+	/*!
+	** \brief Convenient wrapper for executing a new job from any callable object (lambda, functor...)
+	**
+	** The callable object is directly stored within the job (no `Bind<>` holder)
+	** and small jobs are recycled by a per-thread free list. Submitting a
+	** lambda with a few captured variables does not require any heap allocation
+	** in steady state.
+	**
+	** \param queueservice The queueservice to dispatch the new job
+	** \param callback The callable object to execute (`void ()`)
+	*/
+	template<class CallbackT>
+	Job::IJob::Ptr  async(Job::QueueService& queueservice, CallbackT&& callback);
+
 
 	/*!
 	** \brief Convenient wrapper for creating a job from a lambda
@@ -174,3 +195,5 @@ namespace Yuni
 
 
 } // namespace Yuni
+
+#include "utility.hxx"
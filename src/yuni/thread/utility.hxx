@@ -0,0 +1,49 @@
+/*
+** This file is part of libyuni, a cross-platform C++ framework (http://libyuni.org).
+**
+** This Source Code Form is subject to the terms of the Mozilla Public License
+** v.2.0. If a copy of the MPL was not distributed with this file, You can
+** obtain one at http://mozilla.org/MPL/2.0/.
+**
+** github: https://github.com/libyuni/libyuni/
+** gitlab: https://gitlab.com/libyuni/libyuni/ (mirror)
+*/
+#pragma once
+#include "utility.h"
+#include <type_traits>
+#include <utility>
+
+
+namespace Yuni
+{
+namespace Private
+{
+namespace Jobs
+{
+
+	//! Add a job into a queueservice (the queueservice may not be fully defined here)
+	YUNI_DECL void Dispatch(Yuni::Job::QueueService& queueservice, const Yuni::Job::IJob::Ptr& job);
+
+} // namespace Jobs
+} // namespace Private
+} // namespace Yuni
+
+
+
+
+namespace Yuni
+{
+
+	template<class CallbackT>
+	inline Job::IJob::Ptr  async(Job::QueueService& queueservice, CallbackT&& callback)
+	{
+		typedef typename std::decay<CallbackT>::type  Callable;
+		Job::IJob::Ptr job = new Private::Jobs::CallbackJob<Callable>(std::forward<CallbackT>(callback));
+		Private::Jobs::Dispatch(queueservice, job);
+		return job;
+	}
+
+
+
+
+} // namespace Yuni